@@ -126,3 +126,36 @@ enum class EAGX_ROS2QosHistory
 	KeepLastHistoryQos,
 	KeepAllHistoryQos
 };
+
+/**
+ * What a ROS2 Publisher with asynchronous publishing does when a message is sent while its queue
+ * is full.
+ */
+UENUM()
+enum class EAGX_ROS2PublishDropPolicy
+{
+	/** Discard the oldest queued message, so that the most recent messages are always sent. */
+	DropOldest,
+
+	/** Discard the message being sent. */
+	DropNewest,
+
+	/** Wait on the Game Thread until there is room in the queue. */
+	Block
+};
+
+/**
+ * How a ROS2 Subscriber hands out the messages it has received on a Topic.
+ */
+UENUM()
+enum class EAGX_ROS2ReceiveMode
+{
+	/** Every message is received, oldest first, up to the History Depth of the Qos settings. */
+	Queued,
+
+	/**
+	 * Only the most recent message is received and older ones are discarded. The native queue
+	 * keeps a single message.
+	 */
+	LatestOnly
+};
@@ -0,0 +1,116 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "ROS2/AGX_ROS2Enums.h"
+#include "ROS2/AGX_ROS2Messages.h"
+
+/**
+ * Maps a ROS2 message struct to its EAGX_ROS2MessageType. Value is Invalid for types that are not
+ * complete ROS2 messages, such as FAGX_ROS2Message itself or the multi-array layout helpers.
+ */
+template <typename MessageType>
+struct TAGX_ROS2MessageType
+{
+	static constexpr EAGX_ROS2MessageType Value = EAGX_ROS2MessageType::Invalid;
+};
+
+#define AGX_ROS2_MESSAGE_TYPE(Name)                                               \
+	template <>                                                                   \
+	struct TAGX_ROS2MessageType<FAGX_##Name>                                      \
+	{                                                                             \
+		static constexpr EAGX_ROS2MessageType Value = EAGX_ROS2MessageType::Name; \
+	};
+
+AGX_ROS2_MESSAGE_TYPE(AgxMsgsAny)
+AGX_ROS2_MESSAGE_TYPE(AgxMsgsAnySequence)
+AGX_ROS2_MESSAGE_TYPE(BuiltinInterfacesTime)
+AGX_ROS2_MESSAGE_TYPE(BuiltinInterfacesDuration)
+AGX_ROS2_MESSAGE_TYPE(RosgraphMsgsClock)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsBool)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsByte)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsByteMultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsChar)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsColorRGBA)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsEmpty)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsFloat32)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsFloat32MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsFloat64)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsFloat64MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt16)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt16MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt32)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt32MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt64)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt64MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt8)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsInt8MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsString)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt16)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt16MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt32)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt32MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt64)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt64MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt8)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsUInt8MultiArray)
+AGX_ROS2_MESSAGE_TYPE(StdMsgsHeader)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsVector3)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsQuaternion)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsAccel)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsAccelStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsAccelWithCovariance)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsAccelWithCovarianceStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsInertia)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsInertiaStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPoint)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPoint32)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPointStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPolygon)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPolygonStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPose)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPose2D)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPoseArray)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPoseStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPoseWithCovariance)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsPoseWithCovarianceStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsQuaternionStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsTransform)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsTransformStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsTwist)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsTwistStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsTwistWithCovariance)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsTwistWithCovarianceStamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsVector3Stamped)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsWrench)
+AGX_ROS2_MESSAGE_TYPE(GeometryMsgsWrenchStamped)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsBatteryState)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsChannelFloat32)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsCompressedImage)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsFluidPressure)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsIlluminance)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsImage)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsImu)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsJointState)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsJoy)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsJoyFeedback)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsJoyFeedbackArray)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsLaserEcho)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsLaserScan)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsMagneticField)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsMultiDOFJointState)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsMultiEchoLaserScan)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsNavSatStatus)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsNavSatFix)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsPointCloud)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsPointField)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsPointCloud2)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsRange)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsRegionOfInterest)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsCameraInfo)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsRelativeHumidity)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsTemperature)
+AGX_ROS2_MESSAGE_TYPE(SensorMsgsTimeReference)
+
+#undef AGX_ROS2_MESSAGE_TYPE
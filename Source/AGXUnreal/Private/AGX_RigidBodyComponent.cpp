@@ -21,6 +21,7 @@
 #include "Math/Rotator.h"
 #include "Math/Quat.h"
 #include "Misc/EngineVersionComparison.h"
+#include "UObject/UnrealType.h"
 
 // Sets default values for this component's properties
 UAGX_RigidBodyComponent::UAGX_RigidBodyComponent()
@@ -420,21 +421,175 @@ namespace
 			GetShapesRecursive(*C, OutFoundShapes);
 		}
 	}
+
+	// True if all properties declared by Base Class, or a subclass of it, are unchanged from the
+	// archetype, i.e. the template, of the object. Transient properties describe runtime state
+	// and are not compared.
+	bool HasArchetypeProperties(const UObject& Object, const UClass& BaseClass)
+	{
+		const UObject* Archetype = Object.GetArchetype();
+		if (Archetype == nullptr || Archetype->GetClass() != Object.GetClass())
+		{
+			return false;
+		}
+
+		for (TFieldIterator<FProperty> PropIt(Object.GetClass()); PropIt; ++PropIt)
+		{
+			const FProperty* Property = *PropIt;
+			if (Property->HasAnyPropertyFlags(CPF_Transient) ||
+				!Property->GetOwnerClass()->IsChildOf(&BaseClass))
+			{
+				continue;
+			}
+
+			if (!Property->Identical_InContainer(
+					&Object, Archetype, 0, PPF_DeepCompareInstances))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// True if the Rigid Body and its Shapes are configured as their templates and none of the
+	// Shapes has a native yet, i.e. the native Rigid Body may be a clone of another one created
+	// from the same template.
+	bool CanCloneNative(
+		const UAGX_RigidBodyComponent& Body, const TArray<UAGX_ShapeComponent*>& Shapes)
+	{
+		if (!HasArchetypeProperties(Body, *UAGX_RigidBodyComponent::StaticClass()))
+		{
+			return false;
+		}
+
+		for (const UAGX_ShapeComponent* Shape : Shapes)
+		{
+			if (Shape->HasNative() ||
+				!HasArchetypeProperties(*Shape, *UAGX_ShapeComponent::StaticClass()))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// True if Shape is placed relative to Body as Prototype Shape is relative to Prototype Body,
+	// and its collision data is created from the same data.
+	bool IsShapeLike(
+		const UAGX_RigidBodyComponent& Body, const UAGX_ShapeComponent& Shape,
+		const UAGX_RigidBodyComponent& PrototypeBody, const UAGX_ShapeComponent& PrototypeShape)
+	{
+		if (Shape.GetArchetype() != PrototypeShape.GetArchetype() || !PrototypeShape.HasNative())
+		{
+			return false;
+		}
+
+		const double Tolerance = FAGX_ShapeInstancingKey::TransformTolerance;
+		const FTransform Relative =
+			Shape.GetComponentTransform().GetRelativeTransform(Body.GetComponentTransform());
+		const FTransform& PrototypeBodyTransform = PrototypeBody.GetComponentTransform();
+		const FTransform PrototypeRelative =
+			PrototypeShape.GetComponentTransform().GetRelativeTransform(PrototypeBodyTransform);
+		if (!Relative.Equals(PrototypeRelative, Tolerance) ||
+			!Shape.GetComponentScale().Equals(PrototypeShape.GetComponentScale(), Tolerance))
+		{
+			return false;
+		}
+
+		const FAGX_ShapeInstancingKey Key = Shape.GetInstancingKey();
+		const FAGX_ShapeInstancingKey PrototypeKey = PrototypeShape.GetInstancingKey();
+		return Key.IsValid() == PrototypeKey.IsValid() &&
+			   (!Key.IsValid() || Key.Matches(PrototypeKey));
+	}
+}
+
+bool UAGX_RigidBodyComponent::InitializeNativeFromPrototype(
+	const UAGX_Simulation& Simulation, const TArray<UAGX_ShapeComponent*>& Shapes)
+{
+	const UObject* Archetype = GetArchetype();
+	const UAGX_RigidBodyComponent* Prototype =
+		Archetype != nullptr ? Simulation.FindInstancedBodyPrototype(*Archetype) : nullptr;
+	if (Prototype == nullptr || Prototype == this || !Prototype->HasNative())
+	{
+		return false;
+	}
+
+	const TArray<UAGX_ShapeComponent*> PrototypeShapes = Prototype->GetShapes();
+	if (PrototypeShapes.Num() != Shapes.Num())
+	{
+		return false;
+	}
+
+	TArray<const FShapeBarrier*> PrototypeBarriers;
+	PrototypeBarriers.Reserve(PrototypeShapes.Num());
+	for (int32 I = 0; I < Shapes.Num(); ++I)
+	{
+		if (!IsShapeLike(*this, *Shapes[I], *Prototype, *PrototypeShapes[I]))
+		{
+			return false;
+		}
+		PrototypeBarriers.Add(PrototypeShapes[I]->GetNative());
+	}
+
+	TArray<uintptr_t> ShapeAddresses;
+	NativeBarrier.AllocateNativeClone(Prototype->NativeBarrier, PrototypeBarriers, ShapeAddresses);
+	check(HasNative()); /// \todo Consider better error handling than 'check'.
+	WriteTransformToNative();
+
+	for (int32 I = 0; I < Shapes.Num(); ++I)
+	{
+		UAGX_ShapeComponent* Shape = Shapes[I];
+		if (ShapeAddresses[I] == 0)
+		{
+			// Not part of the Prototype's native, so it is created and added as usual.
+			FShapeBarrier* NativeShape = Shape->GetOrCreateNative();
+			if (NativeShape != nullptr && NativeShape->HasNative())
+			{
+				Shape->UpdateNativeLocalTransform();
+				NativeBarrier.AddShape(NativeShape);
+			}
+			continue;
+		}
+
+		// The cloned native already has the Prototype Shape's material, so the Shape Material
+		// instance the Prototype resolved is shared instead of being looked up again.
+		Shape->SetNativeAddress(static_cast<uint64>(ShapeAddresses[I]));
+		Shape->ShapeMaterial = PrototypeShapes[I]->ShapeMaterial;
+	}
+
+	return true;
 }
 
 void UAGX_RigidBodyComponent::InitializeNative()
 {
 	check(!GIsReconstructingBlueprintInstances);
 	check(!HasNative());
-	NativeBarrier.AllocateNative();
-	check(HasNative()); /// \todo Consider better error handling than 'check'.
 
-	WritePropertiesToNative();
-	WriteTransformToNative();
+	// Rigid Bodies created from the same template by SpawnInstances get a clone of the first
+	// one's native instead of each creating and configuring their own.
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
+	const bool bSpawningInstances = Simulation != nullptr && Simulation->IsSpawningInstances();
+	const TArray<UAGX_ShapeComponent*> Shapes =
+		bSpawningInstances ? GetShapes() : TArray<UAGX_ShapeComponent*>();
+	const bool bCanClone = bSpawningInstances && CanCloneNative(*this, Shapes);
+	if (!bCanClone || !InitializeNativeFromPrototype(*Simulation, Shapes))
+	{
+		NativeBarrier.AllocateNative();
+		check(HasNative()); /// \todo Consider better error handling than 'check'.
 
-	SynchronizeShapes();
+		WritePropertiesToNative();
+		WriteTransformToNative();
+
+		SynchronizeShapes();
+
+		if (bCanClone)
+		{
+			Simulation->RegisterInstancedBodyPrototype(*this);
+		}
+	}
 
-	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
 	if (Simulation == nullptr)
 	{
 		UE_LOG(
@@ -17,13 +17,17 @@
 #include "Materials/AGX_ContactMaterial.h"
 #include "Materials/AGX_ShapeMaterial.h"
 #include "Materials/AGX_TerrainMaterial.h"
+#include "Shapes/AGX_HeightFieldShapeComponent.h"
 #include "Shapes/AGX_ShapeComponent.h"
+#include "Shapes/AGX_ShapeInstanceRenderer.h"
+#include "Shapes/AGX_TrimeshShapeComponent.h"
 #include "Shapes/AnyShapeBarrier.h"
 #include "Shapes/ShapeBarrier.h"
 #include "Terrain/AGX_ShovelComponent.h"
 #include "Terrain/AGX_ShovelProperties.h"
 #include "Terrain/AGX_Terrain.h"
 #include "Tires/AGX_TireComponent.h"
+#include "Vehicle/AGX_TrackComponent.h"
 #include "Vehicle/AGX_TrackInternalMergeProperties.h"
 #include "Vehicle/AGX_TrackProperties.h"
 #include "Utilities/AGX_ObjectUtilities.h"
@@ -35,12 +39,14 @@
 #include "Wire/AGX_WireController.h"
 
 // Unreal Engine includes.
+#include "Async/ParallelFor.h"
 #include "CoreMinimal.h"
 #if WITH_EDITOR
 #include "Editor.h"
 #endif
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "EngineUtils.h"
 #include "HAL/PlatformTime.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/Paths.h"
@@ -225,19 +231,29 @@ namespace AGX_Simulation_helpers
 
 void UAGX_Simulation::Add(UAGX_ConstraintComponent& Constraint)
 {
-	EnsureStepperCreated();
+	PrepareAdd();
 	AGX_Simulation_helpers::Add(*this, Constraint);
 }
 
 void UAGX_Simulation::Add(UAGX_RigidBodyComponent& Body)
 {
 	EnsureStepperCreated();
+	if (IsDeferringAdds())
+	{
+		DeferredBodies.Add(&Body);
+		return;
+	}
 	AGX_Simulation_helpers::Add(*this, Body);
 }
 
 void UAGX_Simulation::Add(UAGX_ShapeComponent& Shape)
 {
 	EnsureStepperCreated();
+	if (IsDeferringAdds())
+	{
+		DeferredShapes.Add(&Shape);
+		return;
+	}
 	AGX_Simulation_helpers::Add(*this, Shape);
 }
 
@@ -277,7 +293,7 @@ void UAGX_Simulation::Add(UAGX_ShapeMaterial& Shape)
 
 void UAGX_Simulation::Add(UAGX_ShovelComponent& Shovel)
 {
-	EnsureStepperCreated();
+	PrepareAdd();
 	AGX_Simulation_helpers::Add(*this, Shovel);
 }
 
@@ -289,7 +305,7 @@ void UAGX_Simulation::Add(UAGX_StaticMeshComponent& Body)
 
 void UAGX_Simulation::Add(AAGX_Terrain& Terrain)
 {
-	EnsureStepperCreated();
+	PrepareAdd();
 
 	if (!HasNative())
 	{
@@ -330,16 +346,58 @@ void UAGX_Simulation::Add(AAGX_Terrain& Terrain)
 
 void UAGX_Simulation::Add(UAGX_TireComponent& Tire)
 {
-	EnsureStepperCreated();
+	PrepareAdd();
 	AGX_Simulation_helpers::Add(*this, Tire);
 }
 
+void UAGX_Simulation::Add(UAGX_TrackComponent& Track)
+{
+	PrepareAdd();
+
+	if (!HasNative() || !Track.HasNative())
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Tried to add Track '%s' in '%s' to Simulation but either the Track or the "
+				 "Simulation does not have a native."),
+			*Track.GetName(), *GetLabelSafe(Track.GetOwner()));
+		return;
+	}
+
+	// There is no FSimulationBarrier::Add taking a Track, so we use a work-around in the
+	// TrackBarrier.
+	if (!Track.GetNative()->AddToSimulation(*GetNative()))
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Failed to add '%s' in '%s' to Simulation. Add() returned false. The Log "
+				 "category AGXDynamicsLog may contain more information about the failure."),
+			*Track.GetName(), *GetLabelSafe(Track.GetOwner()));
+	}
+}
+
 void UAGX_Simulation::Add(UAGX_WireComponent& Wire)
 {
-	EnsureStepperCreated();
+	PrepareAdd();
 	AGX_Simulation_helpers::Add(*this, Wire);
 }
 
+bool UAGX_Simulation::Add(FShovelBarrier& Shovel)
+{
+	PrepareAdd();
+
+	if (!HasNative() || !Shovel.HasNative())
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Tried to add a Shovel to Simulation but either the Shovel or the Simulation "
+				 "does not have a native."));
+		return false;
+	}
+
+	return GetNative()->Add(Shovel);
+}
+
 void UAGX_Simulation::Remove(UAGX_ConstraintComponent& Constraint)
 {
 	AGX_Simulation_helpers::Remove(*this, Constraint);
@@ -347,11 +405,21 @@ void UAGX_Simulation::Remove(UAGX_ConstraintComponent& Constraint)
 
 void UAGX_Simulation::Remove(UAGX_RigidBodyComponent& Body)
 {
+	if (DeferredBodies.Remove(&Body) > 0)
+	{
+		// Never made it into the simulation.
+		return;
+	}
 	AGX_Simulation_helpers::Remove(*this, Body);
 }
 
 void UAGX_Simulation::Remove(UAGX_ShapeComponent& Shape)
 {
+	if (DeferredShapes.Remove(&Shape) > 0)
+	{
+		// Never made it into the simulation.
+		return;
+	}
 	AGX_Simulation_helpers::Remove(*this, Shape);
 }
 
@@ -449,6 +517,229 @@ void UAGX_Simulation::Remove(UAGX_WireComponent& Wire)
 	AGX_Simulation_helpers::Remove(*this, Wire);
 }
 
+void UAGX_Simulation::AddVisualSyncJob(
+	const UObject& Owner, TFunction<bool()> Prepare, TFunction<void()> Extract,
+	TFunction<void()> Apply)
+{
+	FAGX_VisualSyncJob& Job = bSyncingVisuals ? PendingVisualSyncJobs.AddDefaulted_GetRef()
+											  : VisualSyncJobs.AddDefaulted_GetRef();
+	Job.Owner = &Owner;
+	Job.Prepare = MoveTemp(Prepare);
+	Job.Extract = MoveTemp(Extract);
+	Job.Apply = MoveTemp(Apply);
+}
+
+void UAGX_Simulation::RemoveVisualSyncJobs(const UObject& Owner)
+{
+	auto IsOwnedBy = [&Owner](const FAGX_VisualSyncJob& Job) { return Job.Owner.Get() == &Owner; };
+	PendingVisualSyncJobs.RemoveAll(IsOwnedBy);
+
+	if (!bSyncingVisuals)
+	{
+		VisualSyncJobs.RemoveAll(IsOwnedBy);
+		return;
+	}
+
+	// SyncVisuals is iterating over the jobs, so only mark them as removed. They are skipped from
+	// now on and removed when SyncVisuals is done.
+	for (FAGX_VisualSyncJob& Job : VisualSyncJobs)
+	{
+		if (IsOwnedBy(Job))
+			Job.Owner.Reset();
+	}
+}
+
+TArray<AActor*> UAGX_Simulation::SpawnInstances(
+	TSubclassOf<AActor> ActorClass, const TArray<FTransform>& Transforms)
+{
+	TArray<AActor*> Actors;
+	UWorld* World = GetWorld();
+	if (World == nullptr || ActorClass == nullptr)
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("SpawnInstances called without a World or without an Actor Class. Nothing will "
+				 "be spawned."));
+		return Actors;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AGXU_SpawnInstances);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride =
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	Actors.Reserve(Transforms.Num());
+	++SpawnInstancesDepth;
+	for (const FTransform& Transform : Transforms)
+	{
+		if (AActor* Actor = World->SpawnActor<AActor>(ActorClass, Transform, SpawnParameters))
+		{
+			Actors.Add(Actor);
+		}
+	}
+	--SpawnInstancesDepth;
+
+	if (!IsSpawningInstances())
+	{
+		FlushDeferredAdds();
+		InstancedShapePrototypes.Empty();
+		InstancedBodyPrototypes.Empty();
+	}
+
+	return Actors;
+}
+
+bool UAGX_Simulation::IsSpawningInstances() const
+{
+	return SpawnInstancesDepth > 0;
+}
+
+bool UAGX_Simulation::IsDeferringAdds() const
+{
+	return IsSpawningInstances() || BeginPlayWorld.IsValid();
+}
+
+UAGX_ShapeComponent* UAGX_Simulation::FindInstancedShapePrototype(
+	const FAGX_ShapeInstancingKey& Key) const
+{
+	if (!IsSpawningInstances() || !Key.IsValid())
+	{
+		return nullptr;
+	}
+
+	for (const auto& Prototype : InstancedShapePrototypes)
+	{
+		if (Prototype.Key.Matches(Key) && Prototype.Value.IsValid())
+		{
+			return Prototype.Value.Get();
+		}
+	}
+
+	return nullptr;
+}
+
+void UAGX_Simulation::RegisterInstancedShapePrototype(
+	const FAGX_ShapeInstancingKey& Key, UAGX_ShapeComponent& Shape)
+{
+	if (!IsSpawningInstances() || !Key.IsValid())
+	{
+		return;
+	}
+
+	InstancedShapePrototypes.Emplace(Key, &Shape);
+}
+
+void UAGX_Simulation::PrepareAdd()
+{
+	EnsureStepperCreated();
+	// The object being added may reference Rigid Bodies and Shapes whose addition has been
+	// deferred by an ongoing SpawnInstances, so they must be in the simulation first.
+	FlushDeferredAdds();
+}
+
+UAGX_RigidBodyComponent* UAGX_Simulation::FindInstancedBodyPrototype(
+	const UObject& Archetype) const
+{
+	if (!IsSpawningInstances())
+	{
+		return nullptr;
+	}
+
+	const TWeakObjectPtr<UAGX_RigidBodyComponent>* Prototype =
+		InstancedBodyPrototypes.Find(&Archetype);
+	return Prototype != nullptr ? Prototype->Get() : nullptr;
+}
+
+void UAGX_Simulation::RegisterInstancedBodyPrototype(UAGX_RigidBodyComponent& Body)
+{
+	if (!IsSpawningInstances())
+	{
+		return;
+	}
+
+	InstancedBodyPrototypes.Add(Body.GetArchetype(), &Body);
+}
+
+void UAGX_Simulation::FlushDeferredAdds()
+{
+	if (DeferredBodies.Num() == 0 && DeferredShapes.Num() == 0)
+	{
+		return;
+	}
+
+	// Move the lists out first since adding may trigger callbacks that spawn more instances.
+	TArray<TWeakObjectPtr<UAGX_RigidBodyComponent>> Bodies = MoveTemp(DeferredBodies);
+	TArray<TWeakObjectPtr<UAGX_ShapeComponent>> Shapes = MoveTemp(DeferredShapes);
+	DeferredBodies.Reset();
+	DeferredShapes.Reset();
+
+	if (!HasNative())
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Tried to add %d deferred Rigid Bodies and %d deferred Shapes to a Simulation "
+				 "that does not have a native."),
+			Bodies.Num(), Shapes.Num());
+		return;
+	}
+
+	// Collect the barriers so that everything is added in a single pass.
+	TArray<UAGX_RigidBodyComponent*> BodyComponents;
+	TArray<FRigidBodyBarrier*> BodyBarriers;
+	BodyComponents.Reserve(Bodies.Num());
+	BodyBarriers.Reserve(Bodies.Num());
+	for (const TWeakObjectPtr<UAGX_RigidBodyComponent>& Body : Bodies)
+	{
+		if (Body.IsValid() && Body->HasNative())
+		{
+			BodyComponents.Add(Body.Get());
+			BodyBarriers.Add(Body->GetNative());
+		}
+	}
+
+	TArray<UAGX_ShapeComponent*> ShapeComponents;
+	TArray<FShapeBarrier*> ShapeBarriers;
+	ShapeComponents.Reserve(Shapes.Num());
+	ShapeBarriers.Reserve(Shapes.Num());
+	for (const TWeakObjectPtr<UAGX_ShapeComponent>& Shape : Shapes)
+	{
+		if (Shape.IsValid() && Shape->HasNative())
+		{
+			ShapeComponents.Add(Shape.Get());
+			ShapeBarriers.Add(Shape->GetNative());
+		}
+	}
+
+	TArray<int32> FailedBodies;
+	TArray<int32> FailedShapes;
+	if (GetNative()->Add(BodyBarriers, ShapeBarriers, FailedBodies, FailedShapes))
+	{
+		return;
+	}
+
+	for (int32 Index : FailedBodies)
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Failed to add '%s' in '%s' to Simulation. FSimulationBarrier::Add returned "
+				 "false. The Log category AGXDynamicsLog may contain more information about the "
+				 "failure."),
+			*BodyComponents[Index]->GetName(), *GetLabelSafe(BodyComponents[Index]->GetOwner()));
+	}
+
+	for (int32 Index : FailedShapes)
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Failed to add '%s' in '%s' to Simulation. FSimulationBarrier::Add returned "
+				 "false. The Log category AGXDynamicsLog may contain more information about the "
+				 "failure."),
+			*ShapeComponents[Index]->GetName(),
+			*GetLabelSafe(ShapeComponents[Index]->GetOwner()));
+	}
+}
+
 void UAGX_Simulation::Register(UAGX_ContactMaterial& Material)
 {
 	EnsureStepperCreated();
@@ -644,6 +935,8 @@ void UAGX_Simulation::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	CreateNative();
+	WorldInitializedActorsHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(
+		this, &UAGX_Simulation::OnWorldInitializedActors);
 }
 
 void UAGX_Simulation::Deinitialize()
@@ -675,6 +968,9 @@ void UAGX_Simulation::Deinitialize()
 	}
 #endif
 
+	FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedActorsHandle);
+	WorldInitializedActorsHandle.Reset();
+
 	Super::Deinitialize();
 	if (HasNative())
 		ReleaseNative();
@@ -825,6 +1121,87 @@ void UAGX_Simulation::OnLevelTransition()
 	ReleaseNative();
 }
 
+void UAGX_Simulation::OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params)
+{
+	if (!bParallelNativePreparation || Params.World == nullptr ||
+		Params.World->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	// Rigid Bodies and Shapes are added in a single pass, in OnWorldBeginPlay or when something
+	// that may reference them is added, instead of one by one from their Begin Play.
+	if (!BeginPlayWorld.IsValid())
+	{
+		BeginPlayWorld = Params.World;
+		WorldBeginPlayHandle =
+			Params.World->OnWorldBeginPlay.AddUObject(this, &UAGX_Simulation::OnWorldBeginPlay);
+	}
+
+	// Gather the preparation tasks on the game thread since finding the source data may require
+	// walking the component hierarchy.
+	TArray<TFunction<void()>> Tasks;
+	auto AddTask = [&Tasks](TFunction<void()>&& Task)
+	{
+		if (Task)
+		{
+			Tasks.Add(MoveTemp(Task));
+		}
+	};
+	for (TActorIterator<AActor> It(Params.World); It; ++It)
+	{
+		if (AAGX_Terrain* Terrain = Cast<AAGX_Terrain>(*It))
+		{
+			AddTask(Terrain->CreatePrepareHeightsTask());
+		}
+
+		TArray<UAGX_TrimeshShapeComponent*> Trimeshes;
+		It->GetComponents(Trimeshes);
+		for (UAGX_TrimeshShapeComponent* Trimesh : Trimeshes)
+		{
+			AddTask(Trimesh->CreatePrepareCollisionDataTask());
+		}
+
+		TArray<UAGX_HeightFieldShapeComponent*> HeightFields;
+		It->GetComponents(HeightFields);
+		for (UAGX_HeightFieldShapeComponent* HeightField : HeightFields)
+		{
+			AddTask(HeightField->CreatePrepareHeightsTask());
+		}
+	}
+
+	if (Tasks.Num() == 0)
+		return;
+
+	// A single Landscape may take much longer to read than a Trimesh to weld.
+	const double StartTime = FPlatformTime::Seconds();
+	ParallelFor(
+		Tasks.Num(), [&Tasks](int32 Index) { Tasks[Index](); }, EParallelForFlags::Unbalanced);
+	UE_LOG(
+		LogAGX, Verbose, TEXT("Prepared %d native objects in parallel in %f seconds."), Tasks.Num(),
+		FPlatformTime::Seconds() - StartTime);
+}
+
+void UAGX_Simulation::OnWorldBeginPlay()
+{
+	if (UWorld* World = BeginPlayWorld.Get())
+	{
+		World->OnWorldBeginPlay.Remove(WorldBeginPlayHandle);
+	}
+	BeginPlayWorld.Reset();
+	WorldBeginPlayHandle.Reset();
+
+	// The commit step of the level's native initialization. Everything that may reference the
+	// deferred Rigid Bodies and Shapes has already flushed them, so what remains is only
+	// referenced by the simulation itself.
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumDeferred = DeferredBodies.Num() + DeferredShapes.Num();
+	FlushDeferredAdds();
+	UE_LOG(
+		LogAGX, Verbose, TEXT("Added %d deferred native objects in %f seconds."), NumDeferred,
+		FPlatformTime::Seconds() - StartTime);
+}
+
 bool UAGX_Simulation::WriteAGXArchive(const FString& Filename) const
 {
 	if (!HasNative())
@@ -850,6 +1227,8 @@ FSimulationBarrier* UAGX_Simulation::GetNative()
 		return nullptr;
 	}
 
+	// The caller may reference Rigid Bodies and Shapes whose addition has been deferred.
+	FlushDeferredAdds();
 	return &NativeBarrier;
 }
 
@@ -1003,6 +1382,10 @@ void UAGX_Simulation::Step(double DeltaTime)
 
 	SET_DWORD_STAT(STAT_AGXU_NumSteps, NumSteps);
 
+	// Nothing has moved if no step was taken, so the visuals are already up to date.
+	if (NumSteps > 0)
+		SyncVisuals();
+
 	// Unreal Engine will zero the stat counters every frame. If we can run the game loop faster
 	// than the step-forward time then some frames won't do any stepping. That is, the above switch
 	// will be a no-op and run in basically zero time. In those cases we want to report the time it
@@ -1172,6 +1555,8 @@ void UAGX_Simulation::StepOnce()
 	const auto SimTime = NativeBarrier.GetTimeStamp();
 	PostStepForwardInternal.Broadcast(SimTime);
 	PostStepForward.Broadcast(SimTime);
+
+	SyncVisuals();
 }
 
 double UAGX_Simulation::GetTimeStamp() const
@@ -1309,6 +1694,16 @@ void UAGX_Simulation::EnsureStepperCreated()
 	}
 }
 
+AAGX_ShapeInstanceRenderer* UAGX_Simulation::GetOrCreateShapeInstanceRenderer()
+{
+	if (!ShapeInstanceRenderer.IsValid() && GetWorld() != nullptr)
+	{
+		ShapeInstanceRenderer = GetWorld()->SpawnActor<AAGX_ShapeInstanceRenderer>();
+	}
+
+	return ShapeInstanceRenderer.Get();
+}
+
 namespace
 {
 	void InvalidLicenseMessage(const FString& Status)
@@ -1400,6 +1795,18 @@ void UAGX_Simulation::ReleaseNative()
 	PreStepForwardInternal.Clear();
 	PostStepForward.Clear();
 	PostStepForwardInternal.Clear();
+	VisualSyncJobs.Empty();
+	PendingVisualSyncJobs.Empty();
+	ActiveVisualSyncJobs.Empty();
+
+	if (UWorld* World = BeginPlayWorld.Get())
+	{
+		World->OnWorldBeginPlay.Remove(WorldBeginPlayHandle);
+	}
+	BeginPlayWorld.Reset();
+	WorldBeginPlayHandle.Reset();
+	DeferredBodies.Empty();
+	DeferredShapes.Empty();
 }
 
 void UAGX_Simulation::PreStep()
@@ -1427,6 +1834,67 @@ void UAGX_Simulation::PostStep()
 	PostStepForward.Broadcast(SimTime);
 }
 
+void UAGX_Simulation::SyncVisuals()
+{
+	if (VisualSyncJobs.IsEmpty())
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:UAGX_Simulation::SyncVisuals"));
+
+	VisualSyncJobs.RemoveAll([](const FAGX_VisualSyncJob& Job) { return !Job.Owner.IsValid(); });
+
+	// Prepare and Apply may run arbitrary game code that adds or removes jobs. From here on
+	// VisualSyncJobs is neither grown nor shrunk, so the indices in ActiveVisualSyncJobs remain
+	// valid. See AddVisualSyncJob and RemoveVisualSyncJobs.
+	bSyncingVisuals = true;
+
+	ActiveVisualSyncJobs.Reset();
+	for (int32 Index = 0; Index < VisualSyncJobs.Num(); ++Index)
+	{
+		FAGX_VisualSyncJob& Job = VisualSyncJobs[Index];
+		if (Job.Owner.IsValid() && (!Job.Prepare || Job.Prepare()))
+			ActiveVisualSyncJobs.Add(Index);
+	}
+
+	// A job may have been removed by the Prepare of a later job.
+	ActiveVisualSyncJobs.RemoveAll([this](int32 Index)
+								   { return !VisualSyncJobs[Index].Owner.IsValid(); });
+
+	{
+		// The game thread waits here, so nothing steps or modifies the native objects while the
+		// Extract functions run.
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:UAGX_Simulation::SyncVisuals Extract"));
+		const EParallelForFlags Flags =
+			bParallelVisualSync ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+		ParallelFor(
+			ActiveVisualSyncJobs.Num(),
+			[this](int32 Index)
+			{
+				FAGX_VisualSyncJob& Job = VisualSyncJobs[ActiveVisualSyncJobs[Index]];
+				if (Job.Extract)
+					Job.Extract();
+			},
+			Flags);
+	}
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:UAGX_Simulation::SyncVisuals Apply"));
+		for (int32 Index : ActiveVisualSyncJobs)
+		{
+			// The owner may have been removed by the Apply of an earlier job.
+			FAGX_VisualSyncJob& Job = VisualSyncJobs[Index];
+			if (Job.Owner.IsValid() && Job.Apply)
+				Job.Apply();
+		}
+	}
+
+	bSyncingVisuals = false;
+	ActiveVisualSyncJobs.Reset();
+	VisualSyncJobs.RemoveAll([](const FAGX_VisualSyncJob& Job) { return !Job.Owner.IsValid(); });
+	VisualSyncJobs.Append(MoveTemp(PendingVisualSyncJobs));
+	PendingVisualSyncJobs.Reset();
+}
+
 EAGX_KeepContactPolicy UAGX_Simulation::ImpactCallback(
 	double TimeStamp, FShapeContactBarrier& Contact)
 {
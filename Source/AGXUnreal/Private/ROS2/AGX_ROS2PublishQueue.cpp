@@ -0,0 +1,151 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "ROS2/AGX_ROS2PublishQueue.h"
+
+// Unreal Engine includes.
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+FAGX_ROS2PublishQueue::FAGX_ROS2PublishQueue(
+	int32 InCapacity, EAGX_ROS2PublishDropPolicy InDropPolicy, const FString& ThreadName)
+	: Capacity(FMath::Max(InCapacity, 1))
+	, DropPolicy(InDropPolicy)
+{
+	Ring.SetNum(Capacity);
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	SpaceEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	IdleEvent = FPlatformProcess::GetSynchEventFromPool(true);
+	IdleEvent->Trigger();
+	Thread = FRunnableThread::Create(this, *ThreadName, 0, TPri_Normal);
+}
+
+FAGX_ROS2PublishQueue::~FAGX_ROS2PublishQueue()
+{
+	if (Thread != nullptr)
+	{
+		// Run drains the queue before returning.
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	FPlatformProcess::ReturnSynchEventToPool(SpaceEvent);
+	FPlatformProcess::ReturnSynchEventToPool(IdleEvent);
+	WorkEvent = nullptr;
+	SpaceEvent = nullptr;
+	IdleEvent = nullptr;
+}
+
+bool FAGX_ROS2PublishQueue::Enqueue(TUniqueFunction<void()>&& Send)
+{
+	if (Thread == nullptr)
+	{
+		// Thread creation failed, or the platform is single threaded. Send right away.
+		Send();
+		return true;
+	}
+
+	if (DropPolicy == EAGX_ROS2PublishDropPolicy::Block)
+	{
+		// There is a single producer, so once there is room nobody else can take it. A trigger
+		// between the test and the wait is not lost since the event stays signaled.
+		while (GetNumQueued() >= Capacity)
+		{
+			SpaceEvent->Wait();
+		}
+	}
+
+	// Destroyed after the lock has been released, the message may be large.
+	TUniqueFunction<void()> Dropped;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (NumQueued >= Capacity)
+		{
+			if (DropPolicy == EAGX_ROS2PublishDropPolicy::DropNewest)
+			{
+				NumDropped.fetch_add(1);
+				return false;
+			}
+
+			// DropOldest.
+			Dropped = MoveTemp(Ring[Head]);
+			Head = (Head + 1) % Capacity;
+			--NumQueued;
+			NumDropped.fetch_add(1);
+		}
+
+		Ring[(Head + NumQueued) % Capacity] = MoveTemp(Send);
+		++NumQueued;
+		bIdle = false;
+		IdleEvent->Reset();
+	}
+
+	WorkEvent->Trigger();
+	return true;
+}
+
+void FAGX_ROS2PublishQueue::Flush()
+{
+	if (Thread == nullptr)
+		return;
+
+	IdleEvent->Wait();
+}
+
+int32 FAGX_ROS2PublishQueue::GetNumQueued() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumQueued;
+}
+
+int64 FAGX_ROS2PublishQueue::GetNumDropped() const
+{
+	return NumDropped.load();
+}
+
+uint32 FAGX_ROS2PublishQueue::Run()
+{
+	TUniqueFunction<void()> Send;
+	while (true)
+	{
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (NumQueued > 0)
+			{
+				Send = MoveTemp(Ring[Head]);
+				Head = (Head + 1) % Capacity;
+				--NumQueued;
+			}
+			else if (!bIdle)
+			{
+				bIdle = true;
+				IdleEvent->Trigger();
+			}
+		}
+
+		if (Send)
+		{
+			SpaceEvent->Trigger();
+			Send();
+			Send = nullptr;
+			continue;
+		}
+
+		if (bStopping.load())
+			break;
+
+		WorkEvent->Wait();
+	}
+
+	return 0;
+}
+
+void FAGX_ROS2PublishQueue::Stop()
+{
+	bStopping.store(true);
+	WorkEvent->Trigger();
+}
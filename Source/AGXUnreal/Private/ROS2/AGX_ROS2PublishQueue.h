@@ -0,0 +1,84 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "ROS2/AGX_ROS2Enums.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+
+// Standard library includes.
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+/**
+ * A bounded queue of pending ROS2 sends, executed in order on a dedicated background thread.
+ *
+ * The queue never holds more than its capacity. When it is full the drop policy decides whether
+ * the oldest queued send or the new one is discarded, or whether the caller waits for room.
+ *
+ * There must be a single producer thread, normally the Game Thread. Destroying the queue blocks
+ * until all queued sends have been executed.
+ *
+ * The queue is a ring buffer guarded by a lock rather than a lock-free single-producer,
+ * single-consumer queue such as TCircularQueue. With the DropOldest policy the producer removes
+ * the oldest send from a full queue, so both threads dequeue and the single-consumer requirement
+ * of those queues would not hold. The lock is only held while one closure is moved in or out of
+ * the ring, never while a send is executed or a dropped message is destroyed, so the producer is
+ * never blocked by DDS.
+ */
+class FAGX_ROS2PublishQueue : public FRunnable
+{
+public:
+	FAGX_ROS2PublishQueue(
+		int32 InCapacity, EAGX_ROS2PublishDropPolicy InDropPolicy, const FString& ThreadName);
+	virtual ~FAGX_ROS2PublishQueue() override;
+
+	/**
+	 * Queue a send. Returns false if the send was discarded because the queue is full and the drop
+	 * policy is DropNewest.
+	 */
+	bool Enqueue(TUniqueFunction<void()>&& Send);
+
+	/// Block until every send queued so far has been executed or dropped.
+	void Flush();
+
+	int32 GetNumQueued() const;
+	int64 GetNumDropped() const;
+
+	// ~Begin FRunnable interface.
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// ~End FRunnable interface.
+
+private:
+	const int32 Capacity;
+	const EAGX_ROS2PublishDropPolicy DropPolicy;
+
+	// Ring buffer of Capacity slots holding the queued sends, oldest at Head. See the class comment
+	// for why this is guarded by a lock.
+	mutable FCriticalSection Lock;
+	TArray<TUniqueFunction<void()>> Ring;
+	int32 Head {0};
+	int32 NumQueued {0};
+	bool bIdle {true};
+
+	std::atomic<int64> NumDropped {0};
+	std::atomic<bool> bStopping {false};
+
+	// Triggered when a send is queued, and on Stop.
+	FEvent* WorkEvent {nullptr};
+
+	// Triggered when the publish thread takes a send out of the queue.
+	FEvent* SpaceEvent {nullptr};
+
+	// Manual reset, signaled while the queue is empty and no send is being executed.
+	FEvent* IdleEvent {nullptr};
+
+	FRunnableThread* Thread {nullptr};
+};
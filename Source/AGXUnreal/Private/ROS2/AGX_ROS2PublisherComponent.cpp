@@ -5,6 +5,7 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_Check.h"
 #include "AGX_LogCategory.h"
+#include "ROS2/AGX_ROS2PublishQueue.h"
 #include "Utilities/AGX_StringUtilities.h"
 
 // Unreal Engine includes.
@@ -21,17 +22,13 @@ UAGX_ROS2PublisherComponent::UAGX_ROS2PublisherComponent()
 
 bool UAGX_ROS2PublisherComponent::SendAgxMsgsAny(const FAGX_AgxMsgsAny& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAny, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::AgxMsgsAny, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnySequence(
 	const FAGX_AgxMsgsAnySequence& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAnySequence, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::AgxMsgsAnySequence, Topic, Msg);
 }
 
 //
@@ -41,17 +38,13 @@ bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnySequence(
 bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesTime(
 	const FAGX_BuiltinInterfacesTime& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesTime, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesTime, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesDuration(
 	const FAGX_BuiltinInterfacesDuration& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Topic, Msg);
 }
 
 //
@@ -61,9 +54,7 @@ bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesDuration(
 bool UAGX_ROS2PublisherComponent::SendRosgraphMsgsClock(
 	const FAGX_RosgraphMsgsClock& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::RosgraphMsgsClock, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::RosgraphMsgsClock, Topic, Msg);
 }
 
 //
@@ -72,222 +63,166 @@ bool UAGX_ROS2PublisherComponent::SendRosgraphMsgsClock(
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsBool(const FAGX_StdMsgsBool& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsBool, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsBool, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsByte(const FAGX_StdMsgsByte& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByte, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsByte, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsByteMultiArray(
 	const FAGX_StdMsgsByteMultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsChar(const FAGX_StdMsgsChar& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsChar, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsChar, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsColorRGBA(
 	const FAGX_StdMsgsColorRGBA& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsColorRGBA, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsColorRGBA, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsEmpty(
 	const FAGX_StdMsgsEmpty& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsEmpty, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsEmpty, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32(
 	const FAGX_StdMsgsFloat32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32MultiArray(
 	const FAGX_StdMsgsFloat32MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64(
 	const FAGX_StdMsgsFloat64& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64MultiArray(
 	const FAGX_StdMsgsFloat64MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16(
 	const FAGX_StdMsgsInt16& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16MultiArray(
 	const FAGX_StdMsgsInt16MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32(
 	const FAGX_StdMsgsInt32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32MultiArray(
 	const FAGX_StdMsgsInt32MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64(
 	const FAGX_StdMsgsInt64& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64MultiArray(
 	const FAGX_StdMsgsInt64MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8(const FAGX_StdMsgsInt8& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8MultiArray(
 	const FAGX_StdMsgsInt8MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsString(
 	const FAGX_StdMsgsString& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsString, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsString, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16(
 	const FAGX_StdMsgsUInt16& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16MultiArray(
 	const FAGX_StdMsgsUInt16MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32(
 	const FAGX_StdMsgsUInt32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32MultiArray(
 	const FAGX_StdMsgsUInt32MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64(
 	const FAGX_StdMsgsUInt64& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64MultiArray(
 	const FAGX_StdMsgsUInt64MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8(
 	const FAGX_StdMsgsUInt8& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8MultiArray(
 	const FAGX_StdMsgsUInt8MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsHeader(
 	const FAGX_StdMsgsHeader& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsHeader, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsHeader, Topic, Msg);
 }
 
 //
@@ -297,241 +232,175 @@ bool UAGX_ROS2PublisherComponent::SendStdMsgsHeader(
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3(
 	const FAGX_GeometryMsgsVector3& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternion(
 	const FAGX_GeometryMsgsQuaternion& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccel(
 	const FAGX_GeometryMsgsAccel& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccel, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccel, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelStamped(
 	const FAGX_GeometryMsgsAccelStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovariance(
 	const FAGX_GeometryMsgsAccelWithCovariance& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovarianceStamped(
 	const FAGX_GeometryMsgsAccelWithCovarianceStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertia(
 	const FAGX_GeometryMsgsInertia& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertia, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertia, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertiaStamped(
 	const FAGX_GeometryMsgsInertiaStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint(
 	const FAGX_GeometryMsgsPoint& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint32(
 	const FAGX_GeometryMsgsPoint32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint32, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPointStamped(
 	const FAGX_GeometryMsgsPointStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygon(
 	const FAGX_GeometryMsgsPolygon& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygon, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygon, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygonStamped(
 	const FAGX_GeometryMsgsPolygonStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose(
 	const FAGX_GeometryMsgsPose& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose2D(
 	const FAGX_GeometryMsgsPose2D& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose2D, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose2D, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseArray(
 	const FAGX_GeometryMsgsPoseArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseStamped(
 	const FAGX_GeometryMsgsPoseStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovariance(
 	const FAGX_GeometryMsgsPoseWithCovariance& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovarianceStamped(
 	const FAGX_GeometryMsgsPoseWithCovarianceStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternionStamped(
 	const FAGX_GeometryMsgsQuaternionStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransform(
 	const FAGX_GeometryMsgsTransform& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransform, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransform, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransformStamped(
 	const FAGX_GeometryMsgsTransformStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwist(
 	const FAGX_GeometryMsgsTwist& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwist, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwist, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistStamped(
 	const FAGX_GeometryMsgsTwistStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovariance(
 	const FAGX_GeometryMsgsTwistWithCovariance& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovarianceStamped(
 	const FAGX_GeometryMsgsTwistWithCovarianceStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3Stamped(
 	const FAGX_GeometryMsgsVector3Stamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrench(
 	const FAGX_GeometryMsgsWrench& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrench, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrench, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchStamped(
 	const FAGX_GeometryMsgsWrenchStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Topic, Msg);
 }
 
 //
@@ -541,263 +410,376 @@ bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchStamped(
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsBatteryState(
 	const FAGX_SensorMsgsBatteryState& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsBatteryState, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsBatteryState, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsChannelFloat32(
 	const FAGX_SensorMsgsChannelFloat32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsCompressedImage(
 	const FAGX_SensorMsgsCompressedImage& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsFluidPressure(
 	const FAGX_SensorMsgsFluidPressure& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsIlluminance(
 	const FAGX_SensorMsgsIlluminance& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsIlluminance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsIlluminance, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsImage(
 	const FAGX_SensorMsgsImage& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImage, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsImage, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsImu(
 	const FAGX_SensorMsgsImu& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImu, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsImu, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJointState(
 	const FAGX_SensorMsgsJointState& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJointState, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJointState, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoy(
 	const FAGX_SensorMsgsJoy& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoy, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoy, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedback(
 	const FAGX_SensorMsgsJoyFeedback& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedbackArray(
 	const FAGX_SensorMsgsJoyFeedbackArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserEcho(
 	const FAGX_SensorMsgsLaserEcho& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserScan(
 	const FAGX_SensorMsgsLaserScan& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserScan, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserScan, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsMagneticField(
 	const FAGX_SensorMsgsMagneticField& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMagneticField, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsMagneticField, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiDOFJointState(
 	const FAGX_SensorMsgsMultiDOFJointState& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiEchoLaserScan(
 	const FAGX_SensorMsgsMultiEchoLaserScan& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatStatus(
 	const FAGX_SensorMsgsNavSatStatus& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatFix(
 	const FAGX_SensorMsgsNavSatFix& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud(
 	const FAGX_SensorMsgsPointCloud& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointField(
 	const FAGX_SensorMsgsPointField& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointField, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointField, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud2(
 	const FAGX_SensorMsgsPointCloud2& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsRange(
 	const FAGX_SensorMsgsRange& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRange, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsRange, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsRegionOfInterest(
 	const FAGX_SensorMsgsRegionOfInterest& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsCameraInfo(
 	const FAGX_SensorMsgsCameraInfo& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsRelativeHumidity(
 	const FAGX_SensorMsgsRelativeHumidity& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsTemperature(
 	const FAGX_SensorMsgsTemperature& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTemperature, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsTemperature, Topic, Msg);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsTimeReference(
 	const FAGX_SensorMsgsTimeReference& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTimeReference, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsTimeReference, Topic, Msg);
+}
+
+//
+// Lidar
+//
+
+bool UAGX_ROS2PublisherComponent::SendLidarOutputPositionIntensity(
+	FAGX_LidarOutputPositionIntensity& Output, double TimeStamp, const FString& Topic,
+	const FString& FrameId)
+{
+	if (!Output.HasNative())
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("SendLidarOutputPositionIntensity called on ROS2 Publisher Component '%s' in "
+				 "Actor '%s' with a Lidar Output that has not been added to a Lidar. Nothing will "
+				 "be sent."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return false;
+	}
+
+	auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic);
+	if (Barrier == nullptr)
+		return false;
+
+	// The native of a Lidar Output Position Intensity is always a Position Intensity Barrier.
+	const auto* OutputBarrier =
+		static_cast<const FLidarOutputPositionIntensityBarrier*>(Output.GetNative());
+	return Barrier->SendPointCloud2XYZI(*OutputBarrier, TimeStamp, FrameId);
+}
+
+bool UAGX_ROS2PublisherComponent::SendLidarOutputPositionIntensityData(
+	const TArray<FAGX_LidarOutputPositionIntensityData>& Data, double TimeStamp,
+	const FString& Topic, const FString& FrameId)
+{
+	auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic);
+	if (Barrier == nullptr)
+		return false;
+
+	if (!bAsyncPublish)
+		return Barrier->SendPointCloud2XYZI(Data, TimeStamp, FrameId);
+
+	return EnqueueSend([Barrier, Data, TimeStamp, FrameId]()
+					   { Barrier->SendPointCloud2XYZI(Data, TimeStamp, FrameId); });
+}
+
+bool UAGX_ROS2PublisherComponent::SendLidarPointCloudFrame(
+	const FAGX_LidarPointCloudFrameRef& Frame, const FString& Topic, const FString& FrameId)
+{
+	auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic);
+	if (Barrier == nullptr)
+		return false;
+
+	auto SendFrame = [Barrier, Frame, FrameId]()
+	{
+		return Barrier->SendPointCloud2XYZI(
+			Frame->X.GetData(), Frame->Y.GetData(), Frame->Z.GetData(), Frame->Intensity.GetData(),
+			Frame->Num(), Frame->TimeStamp, FrameId);
+	};
+
+	if (!bAsyncPublish)
+		return SendFrame();
+
+	return EnqueueSend(MoveTemp(SendFrame));
+}
+
+//
+// Async publish and Topic handles.
+//
+
+int64 UAGX_ROS2PublisherComponent::GetNumDroppedMessages() const
+{
+	return PublishQueue.IsValid() ? PublishQueue->GetNumDropped() : 0;
+}
+
+void UAGX_ROS2PublisherComponent::FlushAsyncPublish()
+{
+	if (PublishQueue.IsValid())
+		PublishQueue->Flush();
+}
+
+FAGX_ROS2TopicHandle UAGX_ROS2PublisherComponent::GetSensorMsgsPointCloud2TopicHandle(
+	const FString& Topic)
+{
+	return GetTopicHandle(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic);
+}
+
+FAGX_ROS2TopicHandle UAGX_ROS2PublisherComponent::GetSensorMsgsImageTopicHandle(
+	const FString& Topic)
+{
+	return GetTopicHandle(EAGX_ROS2MessageType::SensorMsgsImage, Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud2ByHandle(
+	const FAGX_SensorMsgsPointCloud2& Msg, const FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(Handle, Msg);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsImageByHandle(
+	const FAGX_SensorMsgsImage& Msg, const FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(Handle, Msg);
+}
+
+bool UAGX_ROS2PublisherComponent::EnqueueSend(TUniqueFunction<void()>&& SendFunction)
+{
+	if (!PublishQueue.IsValid())
+	{
+		PublishQueue = MakeShared<FAGX_ROS2PublishQueue>(
+			AsyncQueueCapacity, AsyncDropPolicy,
+			FString::Printf(TEXT("AGX ROS2 Publisher %s"), *GetName()));
+	}
+
+	return PublishQueue->Enqueue(MoveTemp(SendFunction));
+}
+
+void UAGX_ROS2PublisherComponent::StopAsyncPublish()
+{
+	// Destroying the queue sends all queued messages and stops the publish thread.
+	PublishQueue.Reset();
+}
+
+void UAGX_ROS2PublisherComponent::EndPlay(const EEndPlayReason::Type Reason)
+{
+	StopAsyncPublish();
+	Super::EndPlay(Reason);
+}
+
+void UAGX_ROS2PublisherComponent::BeginDestroy()
+{
+	StopAsyncPublish();
+	Super::BeginDestroy();
 }
 
 FROS2PublisherBarrier* UAGX_ROS2PublisherComponent::GetOrCreateBarrier(
 	EAGX_ROS2MessageType Type, const FString& Topic)
 {
-	FROS2PublisherBarrier* Barrier = NativeBarriers.Find(Topic);
-	if (Barrier == nullptr)
+	return GetBarrier(GetTopicHandle(Type, Topic));
+}
+
+FAGX_ROS2TopicHandle UAGX_ROS2PublisherComponent::GetTopicHandle(
+	EAGX_ROS2MessageType Type, const FString& Topic)
+{
+	FAGX_ROS2TopicHandle Handle;
+	if (const int32* Index = TopicToBarrier.Find(Topic))
 	{
-		if (Topic.IsEmpty())
+		if (NativeBarriers[*Index]->GetMessageType() != Type)
 		{
 			UE_LOG(
 				LogAGX, Error,
-				TEXT("GetOrCreateBarrier was called on ROS2 Publisher Component '%s' in Actor '%s' "
-					 "whith an empty Topic String. Ensure a Topic has been set."),
-				*GetName(), *GetLabelSafe(GetOwner()));
-			return nullptr;
+				TEXT("Existing Native ROS2 Publisher with different message type found in "
+					 "UAGX_ROS2Publisher::GetTopicHandle for Topic: '%s', Publisher Component "
+					 "'%s' in Actor '%s'. Ensure only single message types are used for a "
+					 "specific Topic."),
+				*Topic, *GetName(), *GetLabelSafe(GetOwner()));
+			return Handle;
 		}
 
-		bool bIsPlaying = GetWorld() != nullptr && GetWorld()->IsGameWorld();
-		if (!bIsPlaying)
-		{
-			UE_LOG(
-				LogAGX, Error,
-				TEXT("GetOrCreateBarrier was called on ROS2 Publisher Component '%s' in Actor '%s' "
-					 "when not inPlay. Only call this function during Play."),
-				*GetName(), *GetLabelSafe(GetOwner()));
-			return nullptr;
-		}
+		Handle.Index = *Index;
+		Handle.MessageType = Type;
+		return Handle;
+	}
 
-		Barrier = &NativeBarriers.Add(Topic, FROS2PublisherBarrier());
-		Barrier->AllocateNative(Type, Topic, Qos);
+	if (Topic.IsEmpty())
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("GetTopicHandle was called on ROS2 Publisher Component '%s' in Actor '%s' "
+				 "whith an empty Topic String. Ensure a Topic has been set."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return Handle;
 	}
-	else if (Barrier->GetMessageType() != Type)
+
+	bool bIsPlaying = GetWorld() != nullptr && GetWorld()->IsGameWorld();
+	if (!bIsPlaying)
 	{
 		UE_LOG(
 			LogAGX, Error,
-			TEXT("Existing Native ROS2 Publisher with different message type found in "
-				 "UAGX_ROS2Publisher::GetOrCreateBarrier for Topic: '%s', Publisher Component '%s' "
-				 "in Actor '%s'. Ensure only single message types are used for a specific Topic."),
-			*Topic, *GetName(), *GetLabelSafe(GetOwner()));
-		return nullptr;
+			TEXT("GetTopicHandle was called on ROS2 Publisher Component '%s' in Actor '%s' "
+				 "when not inPlay. Only call this function during Play."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return Handle;
 	}
 
+	TUniquePtr<FROS2PublisherBarrier> Barrier = MakeUnique<FROS2PublisherBarrier>();
+	Barrier->AllocateNative(Type, Topic, Qos);
 	AGX_CHECK(Barrier->HasNative());
+
+	Handle.Index = NativeBarriers.Add(MoveTemp(Barrier));
+	Handle.MessageType = Type;
+	TopicToBarrier.Add(Topic, Handle.Index);
+	return Handle;
+}
+
+FROS2PublisherBarrier* UAGX_ROS2PublisherComponent::GetBarrier(
+	const FAGX_ROS2TopicHandle& Handle) const
+{
+	if (!NativeBarriers.IsValidIndex(Handle.Index))
+		return nullptr;
+
+	FROS2PublisherBarrier* Barrier = NativeBarriers[Handle.Index].Get();
+	if (Barrier->GetMessageType() != Handle.MessageType)
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("ROS2 Publisher Component '%s' in Actor '%s' got a Topic handle that does not "
+				 "match the message type of the Topic. Topic handles may only be used with the "
+				 "Component that created them."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return nullptr;
+	}
+
 	return Barrier;
 }
 
@@ -810,7 +792,13 @@ bool UAGX_ROS2PublisherComponent::CanEditChange(const FProperty* InProperty) con
 
 	if (InProperty->GetFName().IsEqual(GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, Qos)) ||
 		InProperty->GetFName().IsEqual(
-			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, DomainID)))
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, DomainID)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, bAsyncPublish)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, AsyncQueueCapacity)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, AsyncDropPolicy)))
 	{
 		UWorld* World = GetWorld();
 		return World == nullptr || !World->IsGameWorld();
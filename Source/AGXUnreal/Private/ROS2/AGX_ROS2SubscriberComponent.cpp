@@ -15,6 +15,52 @@ UAGX_ROS2SubscriberComponent::UAGX_ROS2SubscriberComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+EAGX_ROS2ReceiveMode UAGX_ROS2SubscriberComponent::GetReceiveMode(const FString& Topic) const
+{
+	if (const EAGX_ROS2ReceiveMode* Mode = TopicReceiveModes.Find(Topic))
+		return *Mode;
+	return ReceiveMode;
+}
+
+template <typename MessageType>
+bool UAGX_ROS2SubscriberComponent::Receive(
+	EAGX_ROS2MessageType Type, const FString& Topic, MessageType& OutMessage)
+{
+	FROS2SubscriberBarrier* Barrier = GetOrCreateBarrier(Type, Topic);
+	if (Barrier == nullptr)
+		return false;
+
+	if (GetReceiveMode(Topic) == EAGX_ROS2ReceiveMode::LatestOnly)
+		return Barrier->ReceiveLatestMessage(OutMessage);
+
+	return Barrier->ReceiveMessage(OutMessage);
+}
+
+template <typename MessageType>
+int32 UAGX_ROS2SubscriberComponent::ReceiveAll(
+	EAGX_ROS2MessageType Type, const FString& Topic, TArray<MessageType>& OutMessages)
+{
+	OutMessages.Reset();
+	FROS2SubscriberBarrier* Barrier = GetOrCreateBarrier(Type, Topic);
+	if (Barrier == nullptr)
+		return 0;
+
+	MessageType Message;
+	if (GetReceiveMode(Topic) == EAGX_ROS2ReceiveMode::LatestOnly)
+	{
+		if (Barrier->ReceiveLatestMessage(Message))
+			OutMessages.Add(MoveTemp(Message));
+		return OutMessages.Num();
+	}
+
+	while (Barrier->ReceiveMessage(Message))
+	{
+		OutMessages.Add(MoveTemp(Message));
+	}
+
+	return OutMessages.Num();
+}
+
 //
 // AgxMsgs
 //
@@ -22,17 +68,25 @@ UAGX_ROS2SubscriberComponent::UAGX_ROS2SubscriberComponent()
 bool UAGX_ROS2SubscriberComponent::ReceiveAgxMsgsAny(
 	FAGX_AgxMsgsAny& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAny, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::AgxMsgsAny, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllAgxMsgsAny(
+	TArray<FAGX_AgxMsgsAny>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::AgxMsgsAny, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveAgxMsgsAnySequence(
 	FAGX_AgxMsgsAnySequence& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAnySequence, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::AgxMsgsAnySequence, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllAgxMsgsAnySequence(
+	TArray<FAGX_AgxMsgsAnySequence>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::AgxMsgsAnySequence, Topic, OutMessages);
 }
 
 //
@@ -42,17 +96,25 @@ bool UAGX_ROS2SubscriberComponent::ReceiveAgxMsgsAnySequence(
 bool UAGX_ROS2SubscriberComponent::ReceiveBuiltinInterfacesTime(
 	FAGX_BuiltinInterfacesTime& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesTime, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::BuiltinInterfacesTime, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllBuiltinInterfacesTime(
+	TArray<FAGX_BuiltinInterfacesTime>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::BuiltinInterfacesTime, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveBuiltinInterfacesDuration(
 	FAGX_BuiltinInterfacesDuration& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllBuiltinInterfacesDuration(
+	TArray<FAGX_BuiltinInterfacesDuration>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Topic, OutMessages);
 }
 
 //
@@ -62,9 +124,13 @@ bool UAGX_ROS2SubscriberComponent::ReceiveBuiltinInterfacesDuration(
 bool UAGX_ROS2SubscriberComponent::ReceiveRosgraphMsgsClock(
 	FAGX_RosgraphMsgsClock& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::RosgraphMsgsClock, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::RosgraphMsgsClock, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllRosgraphMsgsClock(
+	TArray<FAGX_RosgraphMsgsClock>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::RosgraphMsgsClock, Topic, OutMessages);
 }
 
 //
@@ -74,225 +140,337 @@ bool UAGX_ROS2SubscriberComponent::ReceiveRosgraphMsgsClock(
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsBool(
 	FAGX_StdMsgsBool& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsBool, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsBool, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsBool(
+	TArray<FAGX_StdMsgsBool>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsBool, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsByte(
 	FAGX_StdMsgsByte& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByte, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsByte, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsByte(
+	TArray<FAGX_StdMsgsByte>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsByte, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsByteMultiArray(
 	FAGX_StdMsgsByteMultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsByteMultiArray(
+	TArray<FAGX_StdMsgsByteMultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsChar(
 	FAGX_StdMsgsChar& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsChar, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsChar, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsChar(
+	TArray<FAGX_StdMsgsChar>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsChar, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsColorRGBA(
 	FAGX_StdMsgsColorRGBA& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsColorRGBA, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsColorRGBA, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsColorRGBA(
+	TArray<FAGX_StdMsgsColorRGBA>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsColorRGBA, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsEmpty(
 	FAGX_StdMsgsEmpty& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsEmpty, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsEmpty, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsEmpty(
+	TArray<FAGX_StdMsgsEmpty>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsEmpty, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat32(
 	FAGX_StdMsgsFloat32& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsFloat32, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsFloat32(
+	TArray<FAGX_StdMsgsFloat32>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsFloat32, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat32MultiArray(
 	FAGX_StdMsgsFloat32MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsFloat32MultiArray(
+	TArray<FAGX_StdMsgsFloat32MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat64(
 	FAGX_StdMsgsFloat64& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsFloat64, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsFloat64(
+	TArray<FAGX_StdMsgsFloat64>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsFloat64, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat64MultiArray(
 	FAGX_StdMsgsFloat64MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsFloat64MultiArray(
+	TArray<FAGX_StdMsgsFloat64MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt16(
 	FAGX_StdMsgsInt16& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt16, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt16(
+	TArray<FAGX_StdMsgsInt16>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt16, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt16MultiArray(
 	FAGX_StdMsgsInt16MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt16MultiArray(
+	TArray<FAGX_StdMsgsInt16MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt32(
 	FAGX_StdMsgsInt32& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt32, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt32(
+	TArray<FAGX_StdMsgsInt32>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt32, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt32MultiArray(
 	FAGX_StdMsgsInt32MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt32MultiArray(
+	TArray<FAGX_StdMsgsInt32MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt64(
 	FAGX_StdMsgsInt64& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt64, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt64(
+	TArray<FAGX_StdMsgsInt64>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt64, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt64MultiArray(
 	FAGX_StdMsgsInt64MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt64MultiArray(
+	TArray<FAGX_StdMsgsInt64MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt8(
 	FAGX_StdMsgsInt8& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt8, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt8(
+	TArray<FAGX_StdMsgsInt8>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt8, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt8MultiArray(
 	FAGX_StdMsgsInt8MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsInt8MultiArray(
+	TArray<FAGX_StdMsgsInt8MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsString(
 	FAGX_StdMsgsString& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsString, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsString, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsString(
+	TArray<FAGX_StdMsgsString>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsString, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt16(
 	FAGX_StdMsgsUInt16& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt16, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt16(
+	TArray<FAGX_StdMsgsUInt16>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt16, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt16MultiArray(
 	FAGX_StdMsgsUInt16MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt16MultiArray(
+	TArray<FAGX_StdMsgsUInt16MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt32(
 	FAGX_StdMsgsUInt32& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt32, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt32(
+	TArray<FAGX_StdMsgsUInt32>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt32, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt32MultiArray(
 	FAGX_StdMsgsUInt32MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt32MultiArray(
+	TArray<FAGX_StdMsgsUInt32MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt64(
 	FAGX_StdMsgsUInt64& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt64, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt64(
+	TArray<FAGX_StdMsgsUInt64>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt64, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt64MultiArray(
 	FAGX_StdMsgsUInt64MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt64MultiArray(
+	TArray<FAGX_StdMsgsUInt64MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt8(
 	FAGX_StdMsgsUInt8& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt8, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt8(
+	TArray<FAGX_StdMsgsUInt8>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt8, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt8MultiArray(
 	FAGX_StdMsgsUInt8MultiArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsUInt8MultiArray(
+	TArray<FAGX_StdMsgsUInt8MultiArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsHeader(
 	FAGX_StdMsgsHeader& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsHeader, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::StdMsgsHeader, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllStdMsgsHeader(
+	TArray<FAGX_StdMsgsHeader>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::StdMsgsHeader, Topic, OutMessages);
 }
 
 //
@@ -302,241 +480,349 @@ bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsHeader(
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsVector3(
 	FAGX_GeometryMsgsVector3& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsVector3, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsVector3(
+	TArray<FAGX_GeometryMsgsVector3>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsVector3, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsQuaternion(
 	FAGX_GeometryMsgsQuaternion& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsQuaternion(
+	TArray<FAGX_GeometryMsgsQuaternion>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccel(
 	FAGX_GeometryMsgsAccel& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccel, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsAccel, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsAccel(
+	TArray<FAGX_GeometryMsgsAccel>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsAccel, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelStamped(
 	FAGX_GeometryMsgsAccelStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsAccelStamped(
+	TArray<FAGX_GeometryMsgsAccelStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelWithCovariance(
 	FAGX_GeometryMsgsAccelWithCovariance& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsAccelWithCovariance(
+	TArray<FAGX_GeometryMsgsAccelWithCovariance>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelWithCovarianceStamped(
 	FAGX_GeometryMsgsAccelWithCovarianceStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsAccelWithCovarianceStamped(
+	TArray<FAGX_GeometryMsgsAccelWithCovarianceStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsInertia(
 	FAGX_GeometryMsgsInertia& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertia, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsInertia, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsInertia(
+	TArray<FAGX_GeometryMsgsInertia>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsInertia, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsInertiaStamped(
 	FAGX_GeometryMsgsInertiaStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsInertiaStamped(
+	TArray<FAGX_GeometryMsgsInertiaStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoint(
 	FAGX_GeometryMsgsPoint& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPoint, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPoint(
+	TArray<FAGX_GeometryMsgsPoint>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPoint, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoint32(
 	FAGX_GeometryMsgsPoint32& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint32, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPoint32, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPoint32(
+	TArray<FAGX_GeometryMsgsPoint32>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPoint32, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPointStamped(
 	FAGX_GeometryMsgsPointStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPointStamped(
+	TArray<FAGX_GeometryMsgsPointStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPolygon(
 	FAGX_GeometryMsgsPolygon& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygon, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPolygon, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPolygon(
+	TArray<FAGX_GeometryMsgsPolygon>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPolygon, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPolygonStamped(
 	FAGX_GeometryMsgsPolygonStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPolygonStamped(
+	TArray<FAGX_GeometryMsgsPolygonStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPose(
 	FAGX_GeometryMsgsPose& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPose, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPose(
+	TArray<FAGX_GeometryMsgsPose>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPose, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPose2D(
 	FAGX_GeometryMsgsPose2D& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose2D, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPose2D, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPose2D(
+	TArray<FAGX_GeometryMsgsPose2D>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPose2D, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseArray(
 	FAGX_GeometryMsgsPoseArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPoseArray(
+	TArray<FAGX_GeometryMsgsPoseArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseStamped(
 	FAGX_GeometryMsgsPoseStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPoseStamped(
+	TArray<FAGX_GeometryMsgsPoseStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseWithCovariance(
 	FAGX_GeometryMsgsPoseWithCovariance& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPoseWithCovariance(
+	TArray<FAGX_GeometryMsgsPoseWithCovariance>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseWithCovarianceStamped(
 	FAGX_GeometryMsgsPoseWithCovarianceStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsPoseWithCovarianceStamped(
+	TArray<FAGX_GeometryMsgsPoseWithCovarianceStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsQuaternionStamped(
 	FAGX_GeometryMsgsQuaternionStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsQuaternionStamped(
+	TArray<FAGX_GeometryMsgsQuaternionStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTransform(
 	FAGX_GeometryMsgsTransform& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransform, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsTransform, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsTransform(
+	TArray<FAGX_GeometryMsgsTransform>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsTransform, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTransformStamped(
 	FAGX_GeometryMsgsTransformStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsTransformStamped(
+	TArray<FAGX_GeometryMsgsTransformStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwist(
 	FAGX_GeometryMsgsTwist& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwist, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsTwist, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsTwist(
+	TArray<FAGX_GeometryMsgsTwist>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsTwist, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistStamped(
 	FAGX_GeometryMsgsTwistStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsTwistStamped(
+	TArray<FAGX_GeometryMsgsTwistStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistWithCovariance(
 	FAGX_GeometryMsgsTwistWithCovariance& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsTwistWithCovariance(
+	TArray<FAGX_GeometryMsgsTwistWithCovariance>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistWithCovarianceStamped(
 	FAGX_GeometryMsgsTwistWithCovarianceStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsTwistWithCovarianceStamped(
+	TArray<FAGX_GeometryMsgsTwistWithCovarianceStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsVector3Stamped(
 	FAGX_GeometryMsgsVector3Stamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsVector3Stamped(
+	TArray<FAGX_GeometryMsgsVector3Stamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsWrench(
 	FAGX_GeometryMsgsWrench& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrench, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsWrench, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsWrench(
+	TArray<FAGX_GeometryMsgsWrench>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsWrench, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsWrenchStamped(
 	FAGX_GeometryMsgsWrenchStamped& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllGeometryMsgsWrenchStamped(
+	TArray<FAGX_GeometryMsgsWrenchStamped>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Topic, OutMessages);
 }
 
 //
@@ -546,219 +832,325 @@ bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsWrenchStamped(
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsBatteryState(
 	FAGX_SensorMsgsBatteryState& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsBatteryState, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsBatteryState, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsBatteryState(
+	TArray<FAGX_SensorMsgsBatteryState>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsBatteryState, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsChannelFloat32(
 	FAGX_SensorMsgsChannelFloat32& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsChannelFloat32(
+	TArray<FAGX_SensorMsgsChannelFloat32>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsCompressedImage(
 	FAGX_SensorMsgsCompressedImage& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsCompressedImage(
+	TArray<FAGX_SensorMsgsCompressedImage>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsFluidPressure(
 	FAGX_SensorMsgsFluidPressure& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsFluidPressure(
+	TArray<FAGX_SensorMsgsFluidPressure>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsIlluminance(
 	FAGX_SensorMsgsIlluminance& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsIlluminance, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsIlluminance, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsIlluminance(
+	TArray<FAGX_SensorMsgsIlluminance>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsIlluminance, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsImage(
 	FAGX_SensorMsgsImage& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImage, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsImage, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsImage(
+	TArray<FAGX_SensorMsgsImage>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsImage, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsImu(
 	FAGX_SensorMsgsImu& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImu, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsImu, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsImu(
+	TArray<FAGX_SensorMsgsImu>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsImu, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJointState(
 	FAGX_SensorMsgsJointState& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJointState, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsJointState, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsJointState(
+	TArray<FAGX_SensorMsgsJointState>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsJointState, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoy(
 	FAGX_SensorMsgsJoy& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoy, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsJoy, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsJoy(
+	TArray<FAGX_SensorMsgsJoy>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsJoy, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyFeedback(
 	FAGX_SensorMsgsJoyFeedback& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsJoyFeedback(
+	TArray<FAGX_SensorMsgsJoyFeedback>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyFeedbackArray(
 	FAGX_SensorMsgsJoyFeedbackArray& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsJoyFeedbackArray(
+	TArray<FAGX_SensorMsgsJoyFeedbackArray>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsLaserEcho(
 	FAGX_SensorMsgsLaserEcho& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsLaserEcho(
+	TArray<FAGX_SensorMsgsLaserEcho>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsLaserScan(
 	FAGX_SensorMsgsLaserScan& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserScan, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsLaserScan, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsLaserScan(
+	TArray<FAGX_SensorMsgsLaserScan>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsLaserScan, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMagneticField(
 	FAGX_SensorMsgsMagneticField& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMagneticField, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsMagneticField, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsMagneticField(
+	TArray<FAGX_SensorMsgsMagneticField>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsMagneticField, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMultiDOFJointState(
 	FAGX_SensorMsgsMultiDOFJointState& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsMultiDOFJointState(
+	TArray<FAGX_SensorMsgsMultiDOFJointState>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMultiEchoLaserScan(
 	FAGX_SensorMsgsMultiEchoLaserScan& OutMessage, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsMultiEchoLaserScan(
+	TArray<FAGX_SensorMsgsMultiEchoLaserScan>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsNavSatStatus(
 	FAGX_SensorMsgsNavSatStatus& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsNavSatStatus(
+	TArray<FAGX_SensorMsgsNavSatStatus>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsNavSatFix(
 	FAGX_SensorMsgsNavSatFix& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsNavSatFix(
+	TArray<FAGX_SensorMsgsNavSatFix>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointCloud(
 	FAGX_SensorMsgsPointCloud& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsPointCloud, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsPointCloud(
+	TArray<FAGX_SensorMsgsPointCloud>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsPointCloud, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointField(
 	FAGX_SensorMsgsPointField& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointField, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsPointField, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsPointField(
+	TArray<FAGX_SensorMsgsPointField>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsPointField, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointCloud2(
 	FAGX_SensorMsgsPointCloud2& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsPointCloud2(
+	TArray<FAGX_SensorMsgsPointCloud2>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRange(
 	FAGX_SensorMsgsRange& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRange, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsRange, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsRange(
+	TArray<FAGX_SensorMsgsRange>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsRange, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRegionOfInterest(
 	FAGX_SensorMsgsRegionOfInterest& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsRegionOfInterest(
+	TArray<FAGX_SensorMsgsRegionOfInterest>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsCameraInfo(
 	FAGX_SensorMsgsCameraInfo& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsCameraInfo(
+	TArray<FAGX_SensorMsgsCameraInfo>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRelativeHumidity(
 	FAGX_SensorMsgsRelativeHumidity& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsRelativeHumidity(
+	TArray<FAGX_SensorMsgsRelativeHumidity>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsTemperature(
 	FAGX_SensorMsgsTemperature& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTemperature, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsTemperature, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsTemperature(
+	TArray<FAGX_SensorMsgsTemperature>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsTemperature, Topic, OutMessages);
 }
 
 bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsTimeReference(
 	FAGX_SensorMsgsTimeReference& OutMessage, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTimeReference, Topic))
-		return Barrier->ReceiveMessage(OutMessage);
-	return false;
+	return Receive(EAGX_ROS2MessageType::SensorMsgsTimeReference, Topic, OutMessage);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAllSensorMsgsTimeReference(
+	TArray<FAGX_SensorMsgsTimeReference>& OutMessages, const FString& Topic)
+{
+	return ReceiveAll(EAGX_ROS2MessageType::SensorMsgsTimeReference, Topic, OutMessages);
 }
 
 FROS2SubscriberBarrier* UAGX_ROS2SubscriberComponent::GetOrCreateBarrier(
@@ -790,8 +1182,16 @@ FROS2SubscriberBarrier* UAGX_ROS2SubscriberComponent::GetOrCreateBarrier(
 			return nullptr;
 		}
 
+		FAGX_ROS2Qos TopicQos = Qos;
+		if (GetReceiveMode(Topic) == EAGX_ROS2ReceiveMode::LatestOnly)
+		{
+			// Let the native Subscriber discard old messages as new ones arrive.
+			TopicQos.History = EAGX_ROS2QosHistory::KeepLastHistoryQos;
+			TopicQos.HistoryDepth = 1;
+		}
+
 		Barrier = &NativeBarriers.Add(Topic, FROS2SubscriberBarrier());
-		Barrier->AllocateNative(Type, Topic, Qos);
+		Barrier->AllocateNative(Type, Topic, TopicQos);
 	}
 	else if (Barrier->GetMessageType() != Type)
 	{
@@ -818,7 +1218,11 @@ bool UAGX_ROS2SubscriberComponent::CanEditChange(const FProperty* InProperty) co
 	if (InProperty->GetFName().IsEqual(
 			GET_MEMBER_NAME_CHECKED(UAGX_ROS2SubscriberComponent, Qos)) ||
 		InProperty->GetFName().IsEqual(
-			GET_MEMBER_NAME_CHECKED(UAGX_ROS2SubscriberComponent, DomainID)))
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2SubscriberComponent, DomainID)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2SubscriberComponent, ReceiveMode)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2SubscriberComponent, TopicReceiveModes)))
 	{
 		UWorld* World = GetWorld();
 		return World == nullptr || !World->IsGameWorld();
@@ -0,0 +1,196 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Sensors/AGX_LidarPointCloudFrame.h"
+
+// Unreal Engine includes.
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeLock.h"
+
+void FAGX_LidarPointCloudFrame::Reserve(int32 NumPoints, bool bRayIndices)
+{
+	X.Reserve(NumPoints);
+	Y.Reserve(NumPoints);
+	Z.Reserve(NumPoints);
+	Intensity.Reserve(NumPoints);
+	TimeOffset.Reserve(NumPoints);
+	if (bRayIndices)
+	{
+		Ring.Reserve(NumPoints);
+		Column.Reserve(NumPoints);
+	}
+}
+
+int32 FAGX_LidarPointCloudFrame::AddUninitialized(int32 NumPoints, bool bRayIndices)
+{
+	const int32 First = Num();
+	X.AddUninitialized(NumPoints);
+	Y.AddUninitialized(NumPoints);
+	Z.AddUninitialized(NumPoints);
+	Intensity.AddUninitialized(NumPoints);
+	TimeOffset.AddUninitialized(NumPoints);
+	if (bRayIndices)
+	{
+		Ring.AddUninitialized(NumPoints);
+		Column.AddUninitialized(NumPoints);
+	}
+	return First;
+}
+
+void FAGX_LidarPointCloudFrame::Compact(int32 First, TConstArrayView<uint8> Keep)
+{
+	check(First + Keep.Num() == Num());
+	const bool bRayIndices = Ring.Num() == Num() && Column.Num() == Num();
+	int32 Write = First;
+	for (int32 I = 0; I < Keep.Num(); ++I)
+	{
+		if (Keep[I] == 0)
+			continue;
+
+		const int32 Read = First + I;
+		if (Read != Write)
+		{
+			X[Write] = X[Read];
+			Y[Write] = Y[Read];
+			Z[Write] = Z[Read];
+			Intensity[Write] = Intensity[Read];
+			TimeOffset[Write] = TimeOffset[Read];
+			if (bRayIndices)
+			{
+				Ring[Write] = Ring[Read];
+				Column[Write] = Column[Read];
+			}
+		}
+		++Write;
+	}
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+	const bool AllowShrinking = false;
+#else
+	const EAllowShrinking AllowShrinking = EAllowShrinking::No;
+#endif
+	X.SetNum(Write, AllowShrinking);
+	Y.SetNum(Write, AllowShrinking);
+	Z.SetNum(Write, AllowShrinking);
+	Intensity.SetNum(Write, AllowShrinking);
+	TimeOffset.SetNum(Write, AllowShrinking);
+	if (bRayIndices)
+	{
+		Ring.SetNum(Write, AllowShrinking);
+		Column.SetNum(Write, AllowShrinking);
+	}
+}
+
+void FAGX_LidarPointCloudFrame::Append(const FAGX_LidarPointCloudFrame& Other)
+{
+	if (Other.Num() == 0)
+		return;
+
+	if (Num() == 0)
+		TimeStamp = Other.TimeStamp;
+
+	const bool bRayIndices = HasRayIndices() && Other.HasRayIndices();
+	const int32 First = Num();
+	X.Append(Other.X);
+	Y.Append(Other.Y);
+	Z.Append(Other.Z);
+	Intensity.Append(Other.Intensity);
+	TimeOffset.Append(Other.TimeOffset);
+
+	const float Shift = static_cast<float>(Other.TimeStamp - TimeStamp);
+	if (Shift != 0.f)
+	{
+		for (int32 I = First; I < Num(); ++I)
+			TimeOffset[I] += Shift;
+	}
+
+	if (bRayIndices)
+	{
+		Ring.Append(Other.Ring);
+		Column.Append(Other.Column);
+	}
+	else
+	{
+		Ring.Reset();
+		Column.Reset();
+	}
+}
+
+void FAGX_LidarPointCloudFrame::Reset()
+{
+	TimeStamp = 0.0;
+	X.Reset();
+	Y.Reset();
+	Z.Reset();
+	Intensity.Reset();
+	TimeOffset.Reset();
+	Ring.Reset();
+	Column.Reset();
+}
+
+FAGX_LidarPointCloudFramePool::FAGX_LidarPointCloudFramePool(int32 InMaxFreeFrames)
+	: MaxFreeFrames(FMath::Max(InMaxFreeFrames, 0))
+{
+}
+
+FAGX_LidarPointCloudFramePool::~FAGX_LidarPointCloudFramePool()
+{
+	for (FAGX_LidarPointCloudFrame* Frame : FreeFrames)
+	{
+		delete Frame;
+	}
+}
+
+TSharedRef<FAGX_LidarPointCloudFrame, ESPMode::ThreadSafe> FAGX_LidarPointCloudFramePool::Acquire()
+{
+	FAGX_LidarPointCloudFrame* Frame = nullptr;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (FreeFrames.Num() > 0)
+		{
+			Frame = FreeFrames.Pop();
+		}
+	}
+
+	if (Frame == nullptr)
+	{
+		Frame = new FAGX_LidarPointCloudFrame();
+	}
+
+	// The pool may be destroyed before all frames are released, in which case the frame is simply
+	// deleted.
+	TWeakPtr<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe> WeakPool = AsShared();
+	return MakeShareable(
+		Frame,
+		[WeakPool](FAGX_LidarPointCloudFrame* ReleasedFrame)
+		{
+			if (TSharedPtr<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe> Pool =
+					WeakPool.Pin())
+			{
+				Pool->Release(ReleasedFrame);
+			}
+			else
+			{
+				delete ReleasedFrame;
+			}
+		});
+}
+
+int32 FAGX_LidarPointCloudFramePool::GetNumFree() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return FreeFrames.Num();
+}
+
+void FAGX_LidarPointCloudFramePool::Release(FAGX_LidarPointCloudFrame* Frame)
+{
+	Frame->Reset();
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (FreeFrames.Num() < MaxFreeFrames)
+		{
+			FreeFrames.Add(Frame);
+			return;
+		}
+	}
+	delete Frame;
+}
@@ -0,0 +1,81 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Sensors/AGX_LidarRayDirectionTable.h"
+
+void FAGX_LidarRayDirectionTable::Build(
+	const FVector2D& InFOV, const FVector2D& InResolution,
+	EAGX_LidarLineTraceScanPattern InScanPattern)
+{
+	FOV = InFOV;
+	Resolution = InResolution;
+	ScanPattern = InScanPattern;
+
+	const bool bValidResolution = Resolution.X > 0.0 && Resolution.Y > 0.0;
+	NumRaysX = bValidResolution ? static_cast<int32>(FOV.X / Resolution.X) : 0;
+	NumRaysY = bValidResolution ? static_cast<int32>(FOV.Y / Resolution.Y) : 0;
+	const int32 NumRays = NumRaysX > 0 && NumRaysY > 0 ? NumRaysX * NumRaysY : 0;
+
+	X.SetNumUninitialized(NumRays);
+	Y.SetNumUninitialized(NumRays);
+	Z.SetNumUninitialized(NumRays);
+
+	// The trigonometry is per column and per row, not per ray.
+	TArray<double> SinX, CosX, SinY, CosY;
+	SinX.SetNumUninitialized(NumRaysX);
+	CosX.SetNumUninitialized(NumRaysX);
+	SinY.SetNumUninitialized(NumRaysY);
+	CosY.SetNumUninitialized(NumRaysY);
+	for (int32 I = 0; I < NumRaysX; ++I)
+	{
+		FMath::SinCos(&SinX[I], &CosX[I], FMath::DegreesToRadians(GetAngleX(I)));
+	}
+	for (int32 I = 0; I < NumRaysY; ++I)
+	{
+		FMath::SinCos(&SinY[I], &CosY[I], FMath::DegreesToRadians(GetAngleY(I)));
+	}
+
+	for (int32 Ray = 0; Ray < NumRays; ++Ray)
+	{
+		int32 IndexX, IndexY;
+		GetRayIndices(Ray, IndexX, IndexY);
+
+		// With the angles in a frame where X is horizontal and Y vertical, the ray is
+		// (Sin(X) * Cos(Y), Sin(Y), Cos(X) * Cos(Y)). Reordered here to the Lidar's frame with x
+		// forward, y right and z up.
+		X[Ray] = static_cast<float>(CosX[IndexX] * CosY[IndexY]);
+		Y[Ray] = static_cast<float>(SinX[IndexX] * CosY[IndexY]);
+		Z[Ray] = static_cast<float>(-SinY[IndexY]);
+	}
+}
+
+bool FAGX_LidarRayDirectionTable::IsValidFor(
+	const FVector2D& InFOV, const FVector2D& InResolution,
+	EAGX_LidarLineTraceScanPattern InScanPattern) const
+{
+	return FOV == InFOV && Resolution == InResolution && ScanPattern == InScanPattern;
+}
+
+void FAGX_LidarRayDirectionTable::GetWindowIndexRanges(
+	const FVector2D& WindowX, const FVector2D& WindowY, FIntPoint& OutRangeX,
+	FIntPoint& OutRangeY) const
+{
+	// Evaluating the angle per index, rather than solving for the index, gives exactly the same
+	// inclusion test as comparing the angle of every ray against the window.
+	auto FindRange = [](int32 Num, const FVector2D& Window, auto GetAngle)
+	{
+		FIntPoint Range(Num, -1);
+		for (int32 I = 0; I < Num; ++I)
+		{
+			const double Angle = GetAngle(I);
+			if (Angle >= Window.X && Angle <= Window.Y)
+			{
+				Range.X = FMath::Min(Range.X, I);
+				Range.Y = FMath::Max(Range.Y, I);
+			}
+		}
+		return Range;
+	};
+
+	OutRangeX = FindRange(NumRaysX, WindowX, [this](int32 I) { return GetAngleX(I); });
+	OutRangeY = FindRange(NumRaysY, WindowY, [this](int32 I) { return GetAngleY(I); });
+}
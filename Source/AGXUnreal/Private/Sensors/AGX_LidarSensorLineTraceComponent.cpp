@@ -20,10 +20,10 @@
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 #include "Materials/MaterialInterface.h"
+#include "Tasks/Task.h"
 
 // Standard library includes.
 #include <algorithm>
-#include <tuple>
 
 UAGX_LidarSensorLineTraceComponent::UAGX_LidarSensorLineTraceComponent()
 {
@@ -49,6 +49,42 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 		}
 	}
 
+	void DrawDebugPoints(
+		const FAGX_LidarPointCloudFrame& Frame, int32 First, UWorld* World,
+		const FTransform& LocalFrame, float Size, float Lifetime)
+	{
+		if (World == nullptr)
+			return;
+
+		for (int32 I = First; I < Frame.Num(); ++I)
+		{
+			const FVector PGlobal =
+				LocalFrame.TransformPositionNoScale(FVector(Frame.X[I], Frame.Y[I], Frame.Z[I]));
+			DrawDebugPoint(World, PGlobal, Size, FColor::Red, false, Lifetime);
+		}
+	}
+
+	// Reads the material, so must only be called from the game thread.
+	double GetRoughnessFactor(const UPrimitiveComponent* Component)
+	{
+		check(IsInGameThread());
+		if (Component == nullptr)
+			return 1.0;
+
+		UMaterialInterface* MaterialInterf = Component->GetMaterial(0);
+		if (MaterialInterf == nullptr)
+			return 1.0;
+
+		FMaterialParameterInfo Info;
+		Info.Name = TEXT("Roughness");
+		float Roughness;
+		if (!MaterialInterf->GetScalarParameterValue(Info, Roughness))
+			return 1.0;
+
+		return 1.0 - FMath::Clamp(static_cast<double>(Roughness), 0.0, 1.0);
+	}
+
+	// Intensity without the material's roughness, see GetRoughnessFactor. Thread safe.
 	double ApproximateIntensity(
 		const FHitResult& HitResult, const FVector_NetQuantizeNormal& Direction,
 		double BeamExitRadius, double BeamDivergenceRad)
@@ -56,22 +92,6 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 		// Intensity based on angle of incident.
 		double Intensity = std::max(0.0, -Direction.Dot(HitResult.Normal));
 
-		// Take material Roughness into account.
-		if (HitResult.Component != nullptr)
-		{
-			UMaterialInterface* MaterialInterf = HitResult.Component->GetMaterial(0);
-			if (MaterialInterf != nullptr)
-			{
-				FMaterialParameterInfo Info;
-				Info.Name = TEXT("Roughness");
-				float Roughness;
-				if (MaterialInterf->GetScalarParameterValue(Info, Roughness))
-				{
-					Intensity *= (1.0 - FMath::Clamp(static_cast<double>(Roughness), 0.0, 1.0));
-				}
-			}
-		}
-
 		// Take beam divergence (drop off over distance) into account.
 		// The beam is shaped like a cone. Here we simply take the beam area as it exists the Lidar
 		// Sensor in relation to the beam area at the target.
@@ -115,38 +135,129 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 		bool bCalculateIntensity {true};
 	};
 
-	TArrayView<FAGX_LidarScanPoint> PerformPartialScanCPU(
-		UWorld* World, const LidarScanRequestParams& Params, TArray<FAGX_LidarScanPoint>& OutData)
+	// The range of rays in the scan pattern covered by the given scan request.
+	bool GetRayRange(
+		const LidarScanRequestParams& Params, const FAGX_LidarRayDirectionTable& RayDirections,
+		int32& OutFirstRay, int32& OutNumRays)
 	{
-		if (World == nullptr || Params.FractionEnd <= Params.FractionStart || Params.Range <= 0.0)
-			return {};
-
-		// The scan pattern implemented below is row-wise linear sweep.
+		if (Params.FractionEnd <= Params.FractionStart || Params.Range <= 0.0)
+			return false;
 
-		const int32 NumRaysCycleX = static_cast<int32>(Params.FOV.X / Params.Resolution.X);
-		const int32 NumRaysCycleY = static_cast<int32>(Params.FOV.Y / Params.Resolution.Y);
-		if (NumRaysCycleX <= 0 || NumRaysCycleY <= 0)
-			return {};
+		AGX_CHECK(RayDirections.IsValidFor(Params.FOV, Params.Resolution, Params.ScanPattern));
+		const int32 NumRaysCycle = RayDirections.Num();
+		if (NumRaysCycle <= 0)
+			return false;
 
-		const int32 NumRaysCycle = NumRaysCycleX * NumRaysCycleY;
 		const double NumRaysCycled = static_cast<double>(NumRaysCycle);
-		const int32 FirstRay =
-			std::max(static_cast<int32>(NumRaysCycled * Params.FractionStart), 0);
+		OutFirstRay = std::max(static_cast<int32>(NumRaysCycled * Params.FractionStart), 0);
 		const int32 LastRay =
 			std::min(FMath::RoundToInt32(NumRaysCycled * Params.FractionEnd), NumRaysCycle - 1);
+		OutNumRays = LastRay - OutFirstRay + 1;
+		return OutNumRays > 0;
+	}
 
-		const FVector StartGlobal = Params.Origin.GetLocation();
-		const int32 NumPointsPreAppend = OutData.Num();
-		const int32 NumRays = LastRay - FirstRay + 1;
-		if (NumRays <= 0)
-			return {};
+	// Where PerformPartialScanCPU writes its result. Either output may be null.
+	struct FScanOutput
+	{
+		// One point per ray, including misses.
+		TArray<FAGX_LidarScanPoint>* Points {nullptr};
+
+		// Hits only, written directly into the frame's arrays.
+		FAGX_LidarPointCloudFrame* Frame {nullptr};
+		bool bRayIndices {false};
+
+		// Set by PerformPartialScanCPU, the points added by the scan.
+		TArrayView<FAGX_LidarScanPoint> NewPoints;
+		int32 NewFrameFirst {0};
+	};
+
+	void DrawDebugPoints(
+		const FScanOutput& Output, UWorld* World, const FTransform& LocalFrame, float Size,
+		float Lifetime)
+	{
+		if (Output.Points != nullptr)
+			DrawDebugPoints(Output.NewPoints, World, LocalFrame, Size, Lifetime);
+		else if (Output.Frame != nullptr)
+			DrawDebugPoints(*Output.Frame, Output.NewFrameFirst, World, LocalFrame, Size, Lifetime);
+	}
 
-		// Make room for the new points.
+	// Per-scan state shared by BeginScan, TraceRays and FinishScan.
+	struct FScanState
+	{
+		int32 FirstRay {0};
+		int32 NumRays {0};
+		int32 NumPointsPreAppend {0};
+		int32 FrameFirst {0};
+		float FrameTimeOffset {0.f};
+
+		// The component hit by each ray, for the roughness lookup on the game thread.
+		TArray<TWeakObjectPtr<UPrimitiveComponent>> HitComponents;
+
+		// Whether each of the frame slots added by BeginScan got a hit.
+		TArray<uint8> FrameHits;
+	};
+
+	/**
+	 * Make room in Output for one point per ray of the scan request. Must be called from the game
+	 * thread.
+	 *
+	 * @return False if the scan request covers no rays.
+	 */
+	bool BeginScan(
+		const LidarScanRequestParams& Params, const FAGX_LidarRayDirectionTable& RayDirections,
+		FScanOutput& Output, FScanState& State)
+	{
+		check(IsInGameThread());
+		if (!GetRayRange(Params, RayDirections, State.FirstRay, State.NumRays))
+			return false;
+
+		if (Params.bCalculateIntensity)
+			State.HitComponents.SetNum(State.NumRays);
+
+		TArray<FAGX_LidarScanPoint>* OutData = Output.Points;
+		State.NumPointsPreAppend = OutData != nullptr ? OutData->Num() : 0;
+		if (OutData != nullptr)
+		{
 #if UE_VERSION_OLDER_THAN(5, 5, 0)
-		OutData.SetNumUninitialized(NumPointsPreAppend + NumRays, false);
+			OutData->SetNumUninitialized(State.NumPointsPreAppend + State.NumRays, false);
 #else
-		OutData.SetNumUninitialized(NumPointsPreAppend + NumRays, EAllowShrinking::No);
+			OutData->SetNumUninitialized(
+				State.NumPointsPreAppend + State.NumRays, EAllowShrinking::No);
 #endif
+		}
+
+		// The frame gets one slot per ray, misses are removed by FinishScan.
+		if (FAGX_LidarPointCloudFrame* Frame = Output.Frame)
+		{
+			if (Frame->Num() == 0)
+				Frame->TimeStamp = Params.TimeStamp;
+			State.FrameTimeOffset = static_cast<float>(Params.TimeStamp - Frame->TimeStamp);
+			State.FrameFirst = Frame->AddUninitialized(State.NumRays, Output.bRayIndices);
+			State.FrameHits.SetNumZeroed(State.NumRays);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Trace the rays of a scan started with BeginScan, writing to the slots it added. Doesn't read
+	 * any materials and may be called from any thread, as long as neither the outputs nor the ray
+	 * direction table are modified until it returns.
+	 */
+	void TraceRays(
+		UWorld* World, const LidarScanRequestParams& Params,
+		const FAGX_LidarRayDirectionTable& RayDirections, FScanOutput& Output, FScanState& State)
+	{
+		const int32 FirstRay = State.FirstRay;
+		const int32 NumRays = State.NumRays;
+		const int32 LastRay = FirstRay + NumRays - 1;
+		const int32 NumPointsPreAppend = State.NumPointsPreAppend;
+		const FVector StartGlobal = Params.Origin.GetLocation();
+		TArray<FAGX_LidarScanPoint>* OutData = Output.Points;
+		FAGX_LidarPointCloudFrame* Frame = Output.Frame;
+		const int32 FrameFirst = State.FrameFirst;
+		const float FrameTimeOffset = State.FrameTimeOffset;
+		const bool bRayIndices = Output.bRayIndices;
 
 		// This number is somewhat arbitrary, but a good starting point.
 		// The cost of starting several threads will at some point make single threaded execution
@@ -154,79 +265,81 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 		static constexpr int32 MinRaysForMultithread = 300;
 		const bool RunMultithreaded =
 			FPlatformProcess::SupportsMultithreading() && NumRays >= MinRaysForMultithread;
-		const int32 NumThreads =
-			RunMultithreaded ? FPlatformMisc::NumberOfWorkerThreadsToSpawn() : 1;
-		const int32 NumRaysPerThread = NumRays / NumThreads;
+
+		// The rays are traced in small chunks that are handed out to the worker threads as they
+		// become idle, instead of an even split of the rays over the threads. The cost of a ray
+		// varies a lot, a ray towards empty sky is much cheaper than one hitting complex geometry,
+		// so an even split leaves threads idle while waiting for the slowest one.
+		static constexpr int32 RaysPerChunk = 256;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumRays, RaysPerChunk);
 		FCollisionQueryParams CollParams;
 		CollParams.bTraceComplex = true;
 
-		auto RayToAngles = [&](int32 Ray) -> std::tuple<double, double>
+		// The FOV window as ranges of column and row indices, so that the per-ray test is integer
+		// comparisons only.
+		FIntPoint WindowRangeX, WindowRangeY;
+		RayDirections.GetWindowIndexRanges(
+			Params.FOVWindowX, Params.FOVWindowY, WindowRangeX, WindowRangeY);
+
+		// Rotation part of the Lidar's transform. Unreal Engine uses row vectors, so the world
+		// direction is Local * M.
+		const FMatrix Rotation = Params.Origin.ToMatrixNoScale();
+		const float M00 = static_cast<float>(Rotation.M[0][0]);
+		const float M01 = static_cast<float>(Rotation.M[0][1]);
+		const float M02 = static_cast<float>(Rotation.M[0][2]);
+		const float M10 = static_cast<float>(Rotation.M[1][0]);
+		const float M11 = static_cast<float>(Rotation.M[1][1]);
+		const float M12 = static_cast<float>(Rotation.M[1][2]);
+		const float M20 = static_cast<float>(Rotation.M[2][0]);
+		const float M21 = static_cast<float>(Rotation.M[2][1]);
+		const float M22 = static_cast<float>(Rotation.M[2][2]);
+
+		auto TraceChunk = [&](int32 Chunk)
 		{
-			switch (Params.ScanPattern)
+			const int32 ChunkFirstRay = FirstRay + Chunk * RaysPerChunk;
+			const int32 ChunkLastRayPlusOne = std::min(ChunkFirstRay + RaysPerChunk, LastRay + 1);
+			const int32 ChunkNumRays = ChunkLastRayPlusOne - ChunkFirstRay;
+
+			// Transform the chunk's ray directions to world space in one pass over the table.
+			alignas(16) float DirX[RaysPerChunk];
+			alignas(16) float DirY[RaysPerChunk];
+			alignas(16) float DirZ[RaysPerChunk];
 			{
-				case EAGX_LidarLineTraceScanPattern::HorizontalSweep:
+				const float* RESTRICT LocalX = RayDirections.X.GetData() + ChunkFirstRay;
+				const float* RESTRICT LocalY = RayDirections.Y.GetData() + ChunkFirstRay;
+				const float* RESTRICT LocalZ = RayDirections.Z.GetData() + ChunkFirstRay;
+				for (int32 I = 0; I < ChunkNumRays; ++I)
 				{
-					const int32 IndexX = Ray / NumRaysCycleY;
-					const int32 IndexY = Ray % NumRaysCycleY;
-					return {
-						-Params.FOV.X / 2.0 + Params.Resolution.X * static_cast<double>(IndexX),
-						-Params.FOV.Y / 2.0 + Params.Resolution.Y * static_cast<double>(IndexY)};
-				}
-				case EAGX_LidarLineTraceScanPattern::VerticalSweep:
-				{
-					const int32 IndexX = Ray % NumRaysCycleX;
-					const int32 IndexY = Ray / NumRaysCycleX;
-					return {
-						-Params.FOV.X / 2.0 + Params.Resolution.X * static_cast<double>(IndexX),
-						-Params.FOV.Y / 2.0 + Params.Resolution.Y * static_cast<double>(IndexY)};
+					DirX[I] = LocalX[I] * M00 + LocalY[I] * M10 + LocalZ[I] * M20;
+					DirY[I] = LocalX[I] * M01 + LocalY[I] * M11 + LocalZ[I] * M21;
+					DirZ[I] = LocalX[I] * M02 + LocalY[I] * M12 + LocalZ[I] * M22;
 				}
 			}
 
-			UE_LOG(LogAGX, Warning, TEXT("Unknown Scan Pattern used in Lidar Sensor."));
-			return {0.0, 0.0};
-		};
-
-		auto MultiThreadRayCasts = [&](int32 Thread)
-		{
-			const int32 ThreadFirstRay = FirstRay + Thread * NumRaysPerThread;
-			int32 ThreadLastRayPlusOne = FirstRay + (Thread + 1) * NumRaysPerThread;
-
-			// The last thread takes any extra rays that couldn't be evenly distributed over all
-			// thread.
-			if (Thread == NumThreads - 1)
-				ThreadLastRayPlusOne = LastRay + 1;
-
 			FHitResult HitResult;
-			for (int32 Ray = ThreadFirstRay; Ray < ThreadLastRayPlusOne; Ray++)
+			for (int32 I = 0; I < ChunkNumRays; I++)
 			{
+				const int32 Ray = ChunkFirstRay + I;
 				const int32 OutDataIndex = Ray - FirstRay + NumPointsPreAppend;
-				const auto [AngX, AngY] = RayToAngles(Ray);
-				if (AngX < Params.FOVWindowX.X || AngX > Params.FOVWindowX.Y ||
-					AngY < Params.FOVWindowY.X || AngY > Params.FOVWindowY.Y)
+				int32 IndexX, IndexY;
+				RayDirections.GetRayIndices(Ray, IndexX, IndexY);
+				if (IndexX < WindowRangeX.X || IndexX > WindowRangeX.Y ||
+					IndexY < WindowRangeY.X || IndexY > WindowRangeY.Y)
 				{
 					// Outside the FOVWindow, no need to scan this direction.
-					OutData[OutDataIndex] = FAGX_LidarScanPoint(false);
+					if (OutData != nullptr)
+						(*OutData)[OutDataIndex] = FAGX_LidarScanPoint(false);
 					continue;
 				}
 
-				const double AngRadX = FMath::DegreesToRadians(AngX);
-				const double AngRadY = FMath::DegreesToRadians(AngY);
-
-				// Dir is the normalized vector following the current laser ray. Here X is
-				// horizontal and Y vertical.
-				const FVector Dir(
-					FMath::Sin(AngRadX) * FMath::Cos(AngRadY), FMath::Sin(AngRadY),
-					FMath::Cos(AngRadX) * FMath::Cos(AngRadY));
-
-				// Lidar sensors local coordinate system is x forwards, y to the right and z up.
-				const FVector EndLocal(
-					Dir.Z * Params.Range, Dir.X * Params.Range, -Dir.Y * Params.Range);
-				const FVector EndGlobal = Params.Origin.TransformPositionNoScale(EndLocal);
+				const FVector DirGlobal(DirX[I], DirY[I], DirZ[I]);
+				const FVector EndGlobal = StartGlobal + DirGlobal * Params.Range;
 				if (!World->LineTraceSingleByChannel(
 						HitResult, StartGlobal, EndGlobal, ECC_Visibility, CollParams))
 				{
 					// Line trace miss.
-					OutData[OutDataIndex] = FAGX_LidarScanPoint(false);
+					if (OutData != nullptr)
+						(*OutData)[OutDataIndex] = FAGX_LidarScanPoint(false);
 					continue;
 				}
 
@@ -235,22 +348,124 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 				double Intensity = 0.0;
 				if (Params.bCalculateIntensity)
 				{
-					const FVector_NetQuantizeNormal DirGlobal(
-						(EndGlobal - StartGlobal).GetSafeNormal());
 					Intensity = ApproximateIntensity(
-						HitResult, DirGlobal, Params.BeamExitRadius, Params.BeamDivergenceRad);
+						HitResult, FVector_NetQuantizeNormal(DirGlobal), Params.BeamExitRadius,
+						Params.BeamDivergenceRad);
+					State.HitComponents[Ray - FirstRay] = HitResult.Component;
+				}
+
+				if (OutData != nullptr)
+				{
+					(*OutData)[OutDataIndex] =
+						FAGX_LidarScanPoint(LocalPoint, Params.TimeStamp, Intensity, true);
+				}
+
+				if (Frame != nullptr)
+				{
+					const int32 FrameIndex = FrameFirst + Ray - FirstRay;
+					Frame->X[FrameIndex] = static_cast<float>(LocalPoint.X);
+					Frame->Y[FrameIndex] = static_cast<float>(LocalPoint.Y);
+					Frame->Z[FrameIndex] = static_cast<float>(LocalPoint.Z);
+					Frame->Intensity[FrameIndex] = static_cast<float>(Intensity);
+					Frame->TimeOffset[FrameIndex] = FrameTimeOffset;
+					if (bRayIndices)
+					{
+						Frame->Ring[FrameIndex] = static_cast<uint16>(IndexY);
+						Frame->Column[FrameIndex] = static_cast<uint16>(IndexX);
+					}
+					State.FrameHits[Ray - FirstRay] = 1;
 				}
-				OutData[OutDataIndex] = FAGX_LidarScanPoint(
-					FVector(LocalPoint.X, LocalPoint.Y, LocalPoint.Z), Params.TimeStamp, Intensity,
-					true);
 			}
 		};
 
-		ParallelFor(NumThreads, MultiThreadRayCasts);
-		return MakeArrayView(&OutData[NumPointsPreAppend], NumRays);
+		ParallelFor(
+			NumChunks, TraceChunk,
+			RunMultithreaded ? EParallelForFlags::Unbalanced
+							 : EParallelForFlags::ForceSingleThread);
+	}
+
+	/**
+	 * Apply the material roughness of the hit components to the intensities and remove the misses
+	 * from the frame. Must be called from the game thread, after TraceRays has returned.
+	 */
+	void FinishScan(
+		const LidarScanRequestParams& Params, FScanOutput& Output, const FScanState& State)
+	{
+		check(IsInGameThread());
+		TArray<FAGX_LidarScanPoint>* OutData = Output.Points;
+		FAGX_LidarPointCloudFrame* Frame = Output.Frame;
+
+		if (Params.bCalculateIntensity)
+		{
+			// Most rays hit one of a few components, so look up each material only once.
+			TMap<const UPrimitiveComponent*, double> RoughnessFactors;
+			for (int32 I = 0; I < State.NumRays; ++I)
+			{
+				const UPrimitiveComponent* Component = State.HitComponents[I].Get();
+				if (Component == nullptr)
+					continue;
+
+				const double* Factor = RoughnessFactors.Find(Component);
+				if (Factor == nullptr)
+					Factor = &RoughnessFactors.Add(Component, GetRoughnessFactor(Component));
+				if (OutData != nullptr)
+					(*OutData)[State.NumPointsPreAppend + I].Intensity *= *Factor;
+				if (Frame != nullptr)
+					Frame->Intensity[State.FrameFirst + I] *= static_cast<float>(*Factor);
+			}
+		}
+
+		if (OutData != nullptr)
+		{
+			Output.NewPoints =
+				MakeArrayView(&(*OutData)[State.NumPointsPreAppend], State.NumRays);
+		}
+
+		if (Frame != nullptr)
+		{
+			Frame->Compact(State.FrameFirst, State.FrameHits);
+			Output.NewFrameFirst = State.FrameFirst;
+		}
+	}
+
+	/**
+	 * Trace the rays of the given scan request and append the result to Output. Must be called
+	 * from the game thread. The line traces are run on worker threads while the game thread
+	 * waits, the materials of the hit components are read on the game thread afterwards.
+	 */
+	void PerformPartialScanCPU(
+		UWorld* World, const LidarScanRequestParams& Params,
+		const FAGX_LidarRayDirectionTable& RayDirections, FScanOutput& Output)
+	{
+		check(IsInGameThread());
+		FScanState State;
+		if (World == nullptr || !BeginScan(Params, RayDirections, Output, State))
+			return;
+
+		TraceRays(World, Params, RayDirections, Output, State);
+		FinishScan(Params, Output, State);
 	}
 }
 
+/**
+ * A scan started by StartAsyncScan. Its rays are traced by a background task into the buffers
+ * owned by the scan, and the scan is completed on the game thread at the next step.
+ */
+struct FAGX_LidarPendingScan
+{
+	AGX_LidarSensorLineTraceComponent_helpers::LidarScanRequestParams Params;
+	AGX_LidarSensorLineTraceComponent_helpers::FScanOutput Output;
+	AGX_LidarSensorLineTraceComponent_helpers::FScanState State;
+
+	// One point per ray, only if the scan should fill Buffer.
+	TArray<FAGX_LidarScanPoint> Points;
+
+	// Hits only, only if PointCloudFrameOutput is bound. Appended to OutputFrame on completion.
+	TSharedPtr<FAGX_LidarPointCloudFrame, ESPMode::ThreadSafe> Frame;
+
+	UE::Tasks::FTask Task;
+};
+
 void UAGX_LidarSensorLineTraceComponent::RequestManualScan(
 	double FractionStart, double FractionEnd, FVector2D FOVWindowX, FVector2D FOVWindowY)
 {
@@ -294,22 +509,20 @@ void UAGX_LidarSensorLineTraceComponent::RequestManualScan(
 	}
 
 	AGX_CHECK(Buffer.Num() == 0);
-	auto NewPoints = PerformPartialScanCPU(GetWorld(), Params, Buffer);
+	FScanOutput Output;
+	Output.Points = ShouldFillBuffer() ? &Buffer : nullptr;
+	Output.Frame = GetOutputFrame();
+	Output.bRayIndices = bOutputFrameRayIndices;
+	PerformPartialScanCPU(GetWorld(), Params, GetRayDirections(), Output);
 
 	if (bDebugRenderPoints)
 	{
 		DrawDebugPoints(
-			NewPoints, GetWorld(), GetComponentTransform(), DebugDrawPointSize,
+			Output, GetWorld(), GetComponentTransform(), DebugDrawPointSize,
 			DebugDrawPointLifetime);
 	}
 
-	PointCloudDataOutput.Broadcast(Buffer);
-
-#if UE_VERSION_OLDER_THAN(5, 5, 0)
-	Buffer.SetNum(0, false);
-#else
-	Buffer.SetNum(0, EAllowShrinking::No);
-#endif
+	BroadcastBuffer();
 }
 
 void UAGX_LidarSensorLineTraceComponent::BeginPlay()
@@ -334,6 +547,9 @@ void UAGX_LidarSensorLineTraceComponent::BeginPlay()
 void UAGX_LidarSensorLineTraceComponent::EndPlay(const EEndPlayReason::Type Reason)
 {
 	Super::EndPlay(Reason);
+
+	// Waits for the line traces of an ongoing async scan.
+	DropPendingScan();
 	PointCloudDataOutput.Clear();
 
 	if (Reason != EEndPlayReason::EndPlayInEditor && Reason != EEndPlayReason::Quit &&
@@ -365,6 +581,7 @@ bool UAGX_LidarSensorLineTraceComponent::CanEditChange(const FProperty* InProper
 		// List of names of properties that does not support editing after initialization.
 		static const TArray<FName> PropertiesNotEditableDuringPlay = {
 			GET_MEMBER_NAME_CHECKED(ThisClass, ExecutionMode),
+			GET_MEMBER_NAME_CHECKED(ThisClass, bAsyncScan),
 			GET_MEMBER_NAME_CHECKED(ThisClass, ScanFrequency),
 			GET_MEMBER_NAME_CHECKED(ThisClass, OutputFrequency),
 			GET_MEMBER_NAME_CHECKED(ThisClass, FOV /*clang-format padding*/),
@@ -423,14 +640,24 @@ bool UAGX_LidarSensorLineTraceComponent::CheckValid() const
 
 void UAGX_LidarSensorLineTraceComponent::OnStepForward(double TimeStamp)
 {
-	if (!bIsValid || !bEnabled)
+	if (!bIsValid)
+		return;
+
+	if (!bEnabled)
+	{
+		// Scans started while enabled must not be output when the Lidar is enabled again.
+		DropPendingScan();
 		return;
+	}
 
 	UpdateElapsedTime(TimeStamp);
 
 	if (ExecutionMode != EAGX_LidarLineTraceExecutonMode::Auto)
 		return;
 
+	// The async scan started by the previous step, if any, is completed before the next one
+	// starts.
+	CompletePendingScan();
 	ScanAutoCPU();
 
 	OutputPointCloudDataIfReady();
@@ -479,12 +706,25 @@ void UAGX_LidarSensorLineTraceComponent::ScanAutoCPU()
 		Params.bCalculateIntensity = bCalculateIntensity;
 	}
 
-	auto NewPoints = PerformPartialScanCPU(GetWorld(), Params, Buffer);
-	if (bDebugRenderPoints)
+	if (bAsyncScan)
 	{
-		DrawDebugPoints(
-			NewPoints, GetWorld(), GetComponentTransform(), DebugDrawPointSize,
-			DebugDrawPointLifetime);
+		StartAsyncScan(
+			Params.Origin, Params.FractionStart, Params.FractionEnd, Params.BeamExitRadius,
+			Params.BeamDivergenceRad);
+	}
+	else
+	{
+		FScanOutput Output;
+		Output.Points = ShouldFillBuffer() ? &Buffer : nullptr;
+		Output.Frame = GetOutputFrame();
+		Output.bRayIndices = bOutputFrameRayIndices;
+		PerformPartialScanCPU(GetWorld(), Params, GetRayDirections(), Output);
+		if (bDebugRenderPoints)
+		{
+			DrawDebugPoints(
+				Output, GetWorld(), GetComponentTransform(), DebugDrawPointSize,
+				DebugDrawPointLifetime);
+		}
 	}
 
 	if (ScanCycleFraction >= 1.0)
@@ -494,6 +734,112 @@ void UAGX_LidarSensorLineTraceComponent::ScanAutoCPU()
 	}
 }
 
+const FAGX_LidarRayDirectionTable& UAGX_LidarSensorLineTraceComponent::GetRayDirections()
+{
+	if (!RayDirections.IsValidFor(FOV, Resolution, ScanPattern))
+	{
+		RayDirections.Build(FOV, Resolution, ScanPattern);
+	}
+	return RayDirections;
+}
+
+void UAGX_LidarSensorLineTraceComponent::StartAsyncScan(
+	const FTransform& Origin, double FractionStart, double FractionEnd, double BeamExitRadius,
+	double BeamDivergenceRad)
+{
+	using namespace AGX_LidarSensorLineTraceComponent_helpers;
+	AGX_CHECK(!PendingScan.IsValid());
+
+	UWorld* World = GetWorld();
+	if (World == nullptr)
+		return;
+
+	TSharedPtr<FAGX_LidarPendingScan> Scan = MakeShared<FAGX_LidarPendingScan>();
+	LidarScanRequestParams& Params = Scan->Params;
+	Params = LidarScanRequestParams(Origin, FOV, Resolution);
+	Params.FOVWindowX = {-FOV.X / 2.0, FOV.X / 2.0};
+	Params.FOVWindowY = {-FOV.Y / 2.0, FOV.Y / 2.0};
+	Params.TimeStamp = LidarState.ElapsedTime;
+	Params.FractionStart = FractionStart;
+	Params.FractionEnd = FractionEnd;
+	Params.Range = Range;
+	Params.BeamExitRadius = BeamExitRadius;
+	Params.BeamDivergenceRad = BeamDivergenceRad;
+	Params.ScanPattern = ScanPattern;
+	Params.bCalculateIntensity = bCalculateIntensity;
+
+	FScanOutput& Output = Scan->Output;
+	if (ShouldFillBuffer())
+		Output.Points = &Scan->Points;
+	if (PointCloudFrameOutput.IsBound())
+	{
+		if (!FramePool.IsValid())
+			FramePool = MakeShared<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe>();
+		Scan->Frame = FramePool->Acquire();
+		Output.Frame = Scan->Frame.Get();
+		Output.bRayIndices = bPointCloudFrameRayIndices;
+	}
+
+	// The ray direction table is not rebuilt while the scan is pending since the properties it
+	// depends on cannot be changed during Play and the scan is completed before the next one
+	// starts.
+	const FAGX_LidarRayDirectionTable& Table = GetRayDirections();
+	if (!BeginScan(Params, Table, Output, Scan->State))
+		return;
+
+	// The rays are traced in chunks on worker threads while the game thread continues. The scan
+	// owns everything the task writes to, and is kept until the task has completed.
+	FAGX_LidarPendingScan* ScanPtr = Scan.Get();
+	Scan->Task = UE::Tasks::Launch(
+		UE_SOURCE_LOCATION, [World, &Table, ScanPtr]()
+		{ TraceRays(World, ScanPtr->Params, Table, ScanPtr->Output, ScanPtr->State); });
+	PendingScan = MoveTemp(Scan);
+}
+
+void UAGX_LidarSensorLineTraceComponent::CompletePendingScan()
+{
+	using namespace AGX_LidarSensorLineTraceComponent_helpers;
+	if (!PendingScan.IsValid())
+		return;
+
+	// Normally done already, the scan was started during the previous step.
+	PendingScan->Task.Wait();
+	TSharedPtr<FAGX_LidarPendingScan> Scan = MoveTemp(PendingScan);
+	FinishScan(Scan->Params, Scan->Output, Scan->State);
+
+	Buffer.Append(Scan->Points);
+	if (Scan->Frame.IsValid())
+	{
+		if (FAGX_LidarPointCloudFrame* Frame = GetOutputFrame())
+			Frame->Append(*Scan->Frame);
+	}
+
+	if (bDebugRenderPoints)
+	{
+		DrawDebugPoints(
+			Scan->Output, GetWorld(), Scan->Params.Origin, DebugDrawPointSize,
+			DebugDrawPointLifetime);
+	}
+}
+
+void UAGX_LidarSensorLineTraceComponent::DropPendingScan()
+{
+	if (PendingScan.IsValid())
+	{
+		// The task writes to the scan, and traces in the world, so it must finish first.
+		PendingScan->Task.Wait();
+		PendingScan.Reset();
+	}
+
+	// May contain hits from the dropped scan.
+	OutputFrame.Reset();
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+	Buffer.SetNum(0, false);
+#else
+	Buffer.SetNum(0, EAllowShrinking::No);
+#endif
+}
+
 void UAGX_LidarSensorLineTraceComponent::OutputPointCloudDataIfReady()
 {
 	AGX_CHECK(bIsValid);
@@ -503,12 +849,55 @@ void UAGX_LidarSensorLineTraceComponent::OutputPointCloudDataIfReady()
 
 	if (OutputCycleTimeElapsed >= LidarState.OutputCycleDuration)
 	{
-		PointCloudDataOutput.Broadcast(Buffer);
+		BroadcastBuffer();
+		LidarState.CurrentOutputCycleStartTime = LidarState.ElapsedTime;
+	}
+}
+
+void UAGX_LidarSensorLineTraceComponent::BroadcastBuffer()
+{
+	if (PointCloudFrameOutput.IsBound())
+	{
+		// An empty frame if nothing has been scanned since the last broadcast.
+		GetOutputFrame();
+		PointCloudFrameOutput.Broadcast(OutputFrame.ToSharedRef());
+	}
+
+	// The broadcast frame must not be modified, the next scan starts a new one.
+	OutputFrame.Reset();
+
+	PointCloudDataOutput.Broadcast(Buffer);
+
 #if UE_VERSION_OLDER_THAN(5, 5, 0)
-		Buffer.SetNum(0, false);
+	Buffer.SetNum(0, false);
 #else
-		Buffer.SetNum(0, EAllowShrinking::No);
+	Buffer.SetNum(0, EAllowShrinking::No);
 #endif
-		LidarState.CurrentOutputCycleStartTime = LidarState.ElapsedTime;
+}
+
+bool UAGX_LidarSensorLineTraceComponent::ShouldFillBuffer() const
+{
+	// The buffer is also used for debug rendering when nothing is bound.
+	return PointCloudDataOutput.IsBound() || !PointCloudFrameOutput.IsBound();
+}
+
+FAGX_LidarPointCloudFrame* UAGX_LidarSensorLineTraceComponent::GetOutputFrame()
+{
+	if (!PointCloudFrameOutput.IsBound())
+		return nullptr;
+
+	if (!OutputFrame.IsValid())
+	{
+		if (!FramePool.IsValid())
+		{
+			FramePool = MakeShared<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe>();
+		}
+
+		OutputFrame = FramePool->Acquire();
+
+		// Fixed for the lifetime of the frame so that all points have ray indices, or none.
+		bOutputFrameRayIndices = bPointCloudFrameRayIndices;
 	}
+
+	return OutputFrame.Get();
 }
@@ -12,6 +12,7 @@
 #include "Sensors/AGX_SensorEnvironmentSpriteComponent.h"
 #include "Sensors/AGX_SurfaceMaterialAssetUserData.h"
 #include "Terrain/AGX_Terrain.h"
+#include "Utilities/AGX_MeshPreprocessing.h"
 #include "Utilities/AGX_MeshUtilities.h"
 #include "Utilities/AGX_NotificationUtilities.h"
 #include "Utilities/AGX_StringUtilities.h"
@@ -24,15 +25,47 @@
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "EngineUtils.h"
+#include "HAL/PlatformTime.h"
 #include "Landscape.h"
+#include "Tasks/Task.h"
 
 #include <algorithm>
 
 namespace AGX_SensorEnvironment_helpers
 {
+	/**
+	 * Default LOD is LodMax, if not set explicitly. Lod indices past the last LOD are clamped.
+	 */
+	uint32 GetLodIndex(const UStaticMesh& StaticMesh, int32 Lod)
+	{
+		const uint32 LodMax = StaticMesh.GetNumLODs() - 1;
+		return Lod < 0 ? LodMax : std::min(static_cast<uint32>(Lod), LodMax);
+	}
+
+	/**
+	 * Read the triangle data of the given LOD in the Static Mesh's local frame. Does not touch any
+	 * component and may be called from a background task as long as the Static Mesh is kept alive.
+	 */
+	bool GetVerticesIndices(
+		const UStaticMesh& StaticMesh, uint32 LodIndex,
+		const FAGX_MeshPreprocessingSettings& Preprocessing, TArray<FVector>& OutVertices,
+		TArray<FTriIndices>& OutIndices)
+	{
+		const FTransform& Identity = FTransform::Identity;
+		FAGX_MeshWithTransform MeshWTransform(&StaticMesh, Identity);
+		if (!AGX_MeshUtilities::GetStaticMeshCollisionData(
+				MeshWTransform, Identity, OutVertices, OutIndices, &LodIndex))
+		{
+			return false;
+		}
+
+		AGX_MeshPreprocessing::Process(OutVertices, OutIndices, Preprocessing);
+		return OutVertices.Num() > 0 && OutIndices.Num() > 0;
+	}
+
 	bool GetVerticesIndices(
 		UStaticMeshComponent* Mesh, TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices,
-		int32 Lod)
+		int32 Lod, const FAGX_MeshPreprocessingSettings& Preprocessing)
 	{
 		if (Mesh == nullptr)
 			return false;
@@ -41,15 +74,11 @@ namespace AGX_SensorEnvironment_helpers
 		if (StaticMesh == nullptr)
 			return false;
 
-		// Default LOD is LodMax, if not set explicitly.
-		const uint32 LodMax = StaticMesh->GetNumLODs() - 1;
-		const uint32 LodIndex = Lod < 0 ? LodMax : std::min(static_cast<uint32>(Lod), LodMax);
+		const uint32 LodIndex = GetLodIndex(*StaticMesh, Lod);
 		if (!StaticMesh->HasValidRenderData(/*bCheckLODForVerts*/ true, LodIndex))
 			return false;
 
-		FAGX_MeshWithTransform MeshWTransform(StaticMesh, Mesh->GetComponentTransform());
-		return AGX_MeshUtilities::GetStaticMeshCollisionData(
-			MeshWTransform, Mesh->GetComponentTransform(), OutVertices, OutIndices, &LodIndex);
+		return GetVerticesIndices(*StaticMesh, LodIndex, Preprocessing, OutVertices, OutIndices);
 	}
 
 	bool GetVerticesIndices(
@@ -84,7 +113,8 @@ namespace AGX_SensorEnvironment_helpers
 		return true;
 	}
 
-	void UpdateCollisionSphere(const UAGX_LidarSensorComponent* Lidar, USphereComponent* Sphere)
+	void UpdateCollisionSphere(
+		const UAGX_LidarSensorComponent* Lidar, USphereComponent* Sphere, double PrefetchDistance)
 	{
 		if (Lidar == nullptr || Sphere == nullptr)
 			return;
@@ -100,7 +130,8 @@ namespace AGX_SensorEnvironment_helpers
 				*Lidar->GetName(), Lidar->Range.Max.GetValue(), MaxRadius, MaxRadius);
 		}
 
-		const float Radius = std::min(Lidar->Range.Max.GetValue(), MaxRadius);
+		const float Radius =
+			std::min(Lidar->Range.Max.GetValue() + std::max(PrefetchDistance, 0.0), MaxRadius);
 		if (!FMath::IsNearlyEqual(Sphere->GetUnscaledSphereRadius(), Radius))
 		{
 			Sphere->SetSphereRadius(Radius, /*bUpdateOverlaps*/ false);
@@ -109,24 +140,66 @@ namespace AGX_SensorEnvironment_helpers
 		Sphere->SetWorldLocation(Lidar->GetComponentLocation());
 	}
 
-	template <typename InMapType>
-	void UpdateTrackedMeshes(InMapType& MeshToInstance)
+	void StopListeningToTransformUpdates(USceneComponent* Mesh, FAGX_RtShapeInstanceData& Data)
+	{
+		if (Mesh != nullptr && Data.TransformUpdatedHandle.IsValid())
+			Mesh->TransformUpdated.Remove(Data.TransformUpdatedHandle);
+
+		Data.TransformUpdatedHandle.Reset();
+	}
+
+	template <typename ComponentType>
+	bool RemoveTrackedMesh(
+		TMap<TWeakObjectPtr<ComponentType>, FAGX_RtShapeInstanceData>& MeshToInstance,
+		ComponentType* Mesh)
+	{
+		FAGX_RtShapeInstanceData* Data = MeshToInstance.Find(Mesh);
+		if (Data == nullptr)
+			return false;
+
+		StopListeningToTransformUpdates(Mesh, *Data);
+		MeshToInstance.Remove(Mesh);
+		return true;
+	}
+
+	/**
+	 * Destroyed components don't report that they are going away, so the tracked meshes are
+	 * checked every Tick. This is a weak pointer check and a mobility check per mesh, the
+	 * transforms are only read for meshes that have reported a transform update.
+	 *
+	 * Mobility changes aren't reported either. Meshes that were Static when added and have since
+	 * been made Movable are passed to OnBecameMovable.
+	 */
+	template <typename InMapType, typename FuncType>
+	void SweepTrackedMeshes(InMapType& MeshToInstance, FuncType&& OnBecameMovable)
 	{
-		// Update tracked static meshes and remove any invalid ones.
 		for (auto It = MeshToInstance.CreateIterator(); It; ++It)
 		{
-			if (!IsValid(It->Key.Get()))
+			auto* Mesh = It->Key.Get();
+			if (!IsValid(Mesh))
 			{
+				StopListeningToTransformUpdates(
+					It->Key.Get(/*bEvenIfPendingKill*/ true), It->Value);
 				It.RemoveCurrent();
-				continue;
 			}
+			else if (
+				!It->Value.TransformUpdatedHandle.IsValid() &&
+				Mesh->Mobility != EComponentMobility::Static)
+			{
+				OnBecameMovable(*Mesh, It->Value);
+			}
+		}
+	}
 
-			const FTransform& CompTransform = It->Key->GetComponentTransform();
-			if (CompTransform.Equals(It->Value.InstanceData.Transform))
-				continue;
-
-			It->Value.InstanceData.SetTransform(CompTransform);
+	template <typename InMapType>
+	void ClearTrackedMeshes(InMapType& MeshToInstance)
+	{
+		for (auto It = MeshToInstance.CreateIterator(); It; ++It)
+		{
+			StopListeningToTransformUpdates(It->Key.Get(/*bEvenIfPendingKill*/ true), It->Value);
 		}
+
+		MeshToInstance.Empty();
 	}
 
 	FRtLambertianOpaqueMaterialBarrier* GetLambertianOpaqueMaterialBarrierFrom(
@@ -160,15 +233,32 @@ namespace AGX_SensorEnvironment_helpers
 		return LambertianOpaqueMaterial->GetNative();
 	}
 
-	TOptional<FAGX_RtShapeInstanceData> CreateShapeInstanceData(
-		const TArray<FVector>& Vertices, const TArray<FTriIndices>& Indices, USceneComponent& Mesh,
+	TSharedPtr<FRtShapeBarrier> CreateShape(
+		const TArray<FVector>& Vertices, const TArray<FTriIndices>& Indices)
+	{
+		TSharedPtr<FRtShapeBarrier> Shape = MakeShared<FRtShapeBarrier>();
+		if (!Shape->AllocateNative(Vertices, Indices))
+			return nullptr;
+
+		return Shape;
+	}
+
+	TSharedPtr<FRtShapeBarrier> FindSharedShape(
+		const TMap<FAGX_RtShapeKey, TWeakPtr<FRtShapeBarrier>>& SharedShapes,
+		const FAGX_RtShapeKey& Key)
+	{
+		const TWeakPtr<FRtShapeBarrier>* Cached = SharedShapes.Find(Key);
+		return Cached != nullptr ? Cached->Pin() : nullptr;
+	}
+
+	FAGX_RtShapeInstanceData CreateShapeInstanceData(
+		const TSharedPtr<FRtShapeBarrier>& Shape, USceneComponent& Mesh,
 		FSensorEnvironmentBarrier& SEBarrier)
 	{
+		AGX_CHECK(Shape.IsValid() && Shape->HasNative());
 		FAGX_RtShapeInstanceData ShapeInstance;
-		if (!ShapeInstance.Shape.AllocateNative(Vertices, Indices))
-			return {};
-
-		ShapeInstance.InstanceData.Instance.AllocateNative(ShapeInstance.Shape, SEBarrier);
+		ShapeInstance.Shape = Shape;
+		ShapeInstance.InstanceData.Instance.AllocateNative(*Shape, SEBarrier);
 		ShapeInstance.InstanceData.SetTransform(Mesh.GetComponentTransform());
 		ShapeInstance.InstanceData.Instance.SetLidarSurfaceMaterialOrDefault(
 			GetLambertianOpaqueMaterialBarrierFrom(Mesh));
@@ -219,6 +309,9 @@ bool AAGX_SensorEnvironment::AddLidar(UAGX_LidarSensorComponent* Lidar)
 
 bool AAGX_SensorEnvironment::AddMesh(UStaticMeshComponent* Mesh, int32 InLod)
 {
+	if (Mesh == nullptr)
+		return false;
+
 	if (!HasNative())
 	{
 		InitializeNative();
@@ -226,14 +319,11 @@ bool AAGX_SensorEnvironment::AddMesh(UStaticMeshComponent* Mesh, int32 InLod)
 			return false;
 	}
 
-	TArray<FVector> OutVerts;
-	TArray<FTriIndices> OutInds;
-	const int32 Lod = InLod < 0 ? DefaultLODIndex : InLod;
-
-	if (!AGX_SensorEnvironment_helpers::GetVerticesIndices(Mesh, OutVerts, OutInds, Lod))
+	if (TrackedMeshes.Contains(Mesh))
 		return false;
 
-	if (!AddMesh(Mesh, OutVerts, OutInds))
+	const int32 Lod = InLod < 0 ? DefaultLODIndex : InLod;
+	if (!AddMesh(Mesh, GetOrCreateSharedShape(*Mesh, Lod)))
 		return false;
 
 	if (DebugLogOnAdd)
@@ -287,13 +377,8 @@ bool AAGX_SensorEnvironment::AddInstancedMesh(UInstancedStaticMeshComponent* Mes
 
 	if (!TrackedInstancedMeshes.Contains(Mesh))
 	{
-		TArray<FVector> OutVertices;
-		TArray<FTriIndices> OutIndices;
 		const int32 Lod = InLod < 0 ? DefaultLODIndex : InLod;
-		if (!AGX_SensorEnvironment_helpers::GetVerticesIndices(Mesh, OutVertices, OutIndices, Lod))
-			return false;
-
-		if (!AddInstancedMesh(Mesh, OutVertices, OutIndices))
+		if (!AddInstancedMesh(Mesh, GetOrCreateSharedShape(*Mesh, Lod)))
 			return false;
 	}
 
@@ -332,13 +417,8 @@ bool AAGX_SensorEnvironment::AddInstancedMeshInstance(
 
 	if (!TrackedInstancedMeshes.Contains(Mesh))
 	{
-		TArray<FVector> OutVertices;
-		TArray<FTriIndices> OutIndices;
 		const int32 Lod = InLod < 0 ? DefaultLODIndex : InLod;
-		if (!AGX_SensorEnvironment_helpers::GetVerticesIndices(Mesh, OutVertices, OutIndices, Lod))
-			return false;
-
-		if (!AddInstancedMesh(Mesh, OutVertices, OutIndices))
+		if (!AddInstancedMesh(Mesh, GetOrCreateSharedShape(*Mesh, Lod)))
 			return false;
 	}
 
@@ -353,26 +433,188 @@ bool AAGX_SensorEnvironment::AddInstancedMeshInstance(
 	return Res;
 }
 
-bool AAGX_SensorEnvironment::AddMesh(
-	UStaticMeshComponent* Mesh, const TArray<FVector>& Vertices, const TArray<FTriIndices>& Indices)
+TSharedPtr<FRtShapeBarrier> AAGX_SensorEnvironment::GetOrCreateSharedShape(
+	UStaticMeshComponent& Mesh, int32 Lod)
 {
 	using namespace AGX_SensorEnvironment_helpers;
-	AGX_CHECK(HasNative());
+	const UStaticMesh* StaticMesh = Mesh.GetStaticMesh();
+	if (StaticMesh == nullptr)
+		return nullptr;
 
-	if (Mesh == nullptr)
+	// The triangle data is read in the component's local frame, with the component's scale applied
+	// through the instance transform, so all components using the same asset and LOD can share
+	// the shape.
+	const FAGX_RtShapeKey Key(StaticMesh, static_cast<int32>(GetLodIndex(*StaticMesh, Lod)));
+	if (TSharedPtr<FRtShapeBarrier> Shape = FindSharedShape(SharedMeshShapes, Key))
+		return Shape;
+
+	TArray<FVector> Vertices;
+	TArray<FTriIndices> Indices;
+	if (!GetVerticesIndices(&Mesh, Vertices, Indices, Lod, MeshPreprocessing))
+		return nullptr;
+
+	TSharedPtr<FRtShapeBarrier> Shape = CreateShape(Vertices, Indices);
+	if (Shape.IsValid())
+		SharedMeshShapes.Add(Key, Shape);
+
+	return Shape;
+}
+
+bool AAGX_SensorEnvironment::AddMeshAsync(UStaticMeshComponent& Mesh)
+{
+	using namespace AGX_SensorEnvironment_helpers;
+	if (!HasNative())
+	{
+		InitializeNative();
+		if (!HasNative())
+			return false;
+	}
+
+	if (TrackedMeshes.Contains(&Mesh) || PendingMeshes.Contains(&Mesh))
 		return false;
 
-	if (Vertices.Num() <= 0 || Indices.Num() <= 0)
+	UStaticMesh* StaticMesh = Mesh.GetStaticMesh();
+	if (StaticMesh == nullptr)
 		return false;
 
-	if (TrackedMeshes.Contains(Mesh))
+	const uint32 LodIndex = GetLodIndex(*StaticMesh, DefaultLODIndex);
+	const FAGX_RtShapeKey Key(StaticMesh, static_cast<int32>(LodIndex));
+
+	// Creating an instance of an existing shape is cheap, so that is done immediately.
+	if (TSharedPtr<FRtShapeBarrier> Shape = FindSharedShape(SharedMeshShapes, Key))
+	{
+		if (!AddMesh(&Mesh, Shape))
+			return false;
+
+		if (DebugLogOnAdd)
+		{
+			UE_LOG(
+				LogAGX, Log,
+				TEXT("Sensor Environment '%s' added Static Mesh Component '%s' in '%s'."),
+				*GetName(), *Mesh.GetName(), *GetLabelSafe(Mesh.GetOwner()));
+		}
+
+		return true;
+	}
+
+	if (!PendingMeshShapes.Contains(Key))
+	{
+#if !WITH_EDITOR
+		// Without CPU access the triangle data must be copied from GPU memory through the render
+		// thread, which requires the game thread to flush rendering commands. That cannot be done
+		// from a background task, so such meshes are added synchronously.
+		if (!StaticMesh->bAllowCPUAccess)
+			return AddMesh(&Mesh, DefaultLODIndex);
+#endif
+
+		if (!StaticMesh->HasValidRenderData(/*bCheckLODForVerts*/ true, LodIndex))
+			return false;
+
+		FAGX_PendingRtShape& Pending = PendingMeshShapes.Add(Key);
+		Pending.Mesh.Reset(StaticMesh);
+		Pending.Task = UE::Tasks::Launch(
+			UE_SOURCE_LOCATION,
+			[StaticMesh, LodIndex, Preprocessing = MeshPreprocessing]()
+			{
+				FAGX_RtShapeTriangleData TriangleData;
+				GetVerticesIndices(
+					*StaticMesh, LodIndex, Preprocessing, TriangleData.Vertices,
+					TriangleData.Indices);
+				return TriangleData;
+			});
+	}
+
+	PendingMeshes.Add(&Mesh, FAGX_PendingRtShapeInstance {Key});
+	return true;
+}
+
+void AAGX_SensorEnvironment::UpdatePendingMeshes()
+{
+	using namespace AGX_SensorEnvironment_helpers;
+	if (PendingMeshShapes.Num() == 0)
+		return;
+
+	// Creating the native shape uploads the triangle data and must be done on the game thread, so
+	// that part is time sliced. At least one shape is created per call.
+	const double EndTime = FPlatformTime::Seconds() + AsyncAddTimeBudget / 1000.0;
+	for (auto It = PendingMeshShapes.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.Task.IsCompleted())
+			continue;
+
+		const FAGX_RtShapeKey Key = It->Key;
+		const FAGX_RtShapeTriangleData& TriangleData = It->Value.Task.GetResult();
+		TSharedPtr<FRtShapeBarrier> Shape;
+		if (TriangleData.Vertices.Num() > 0 && TriangleData.Indices.Num() > 0)
+			Shape = CreateShape(TriangleData.Vertices, TriangleData.Indices);
+
+		It.RemoveCurrent();
+		if (Shape.IsValid())
+			SharedMeshShapes.Add(Key, Shape);
+
+		for (auto MeshIt = PendingMeshes.CreateIterator(); MeshIt; ++MeshIt)
+		{
+			if (MeshIt->Value.ShapeKey != Key)
+				continue;
+
+			UStaticMeshComponent* Mesh = MeshIt->Key.Get();
+			const size_t RefCount = MeshIt->Value.RefCount;
+			MeshIt.RemoveCurrent();
+			if (!IsValid(Mesh) || !Shape.IsValid())
+				continue;
+
+			if (FAGX_RtShapeInstanceData* Tracked = TrackedMeshes.Find(Mesh))
+			{
+				// The Static Mesh Component was added explicitly while the shape was pending.
+				Tracked->InstanceData.RefCount += RefCount;
+				continue;
+			}
+
+			if (!AddMesh(Mesh, Shape))
+				continue;
+
+			TrackedMeshes[Mesh].InstanceData.RefCount = RefCount;
+			if (DebugLogOnAdd)
+			{
+				UE_LOG(
+					LogAGX, Log,
+					TEXT("Sensor Environment '%s' added Static Mesh Component '%s' in '%s'."),
+					*GetName(), *Mesh->GetName(), *GetLabelSafe(Mesh->GetOwner()));
+			}
+		}
+
+		if (FPlatformTime::Seconds() >= EndTime)
+			break;
+	}
+}
+
+void AAGX_SensorEnvironment::ClearPendingMeshes()
+{
+	// The tasks reference the Static Meshes kept alive by the pending shapes.
+	for (auto& Pending : PendingMeshShapes)
+	{
+		Pending.Value.Task.Wait();
+	}
+
+	PendingMeshShapes.Empty();
+	PendingMeshes.Empty();
+}
+
+bool AAGX_SensorEnvironment::AddMesh(
+	UStaticMeshComponent* Mesh, const TSharedPtr<FRtShapeBarrier>& Shape)
+{
+	using namespace AGX_SensorEnvironment_helpers;
+	AGX_CHECK(HasNative());
+
+	if (Mesh == nullptr || !Shape.IsValid())
 		return false;
 
-	auto ShapeInstance = CreateShapeInstanceData(Vertices, Indices, *Mesh, NativeBarrier);
-	if (!ShapeInstance.IsSet())
+	if (TrackedMeshes.Contains(Mesh))
 		return false;
 
-	TrackedMeshes.Add(Mesh, std::move(ShapeInstance.GetValue()));
+	FAGX_RtShapeInstanceData& Data =
+		TrackedMeshes.Add(Mesh, CreateShapeInstanceData(Shape, *Mesh, NativeBarrier));
+	ListenToTransformUpdates(*Mesh, Data);
 	return true;
 }
 
@@ -392,28 +634,28 @@ bool AAGX_SensorEnvironment::AddMesh(
 	if (TrackedAGXMeshes.Contains(Mesh))
 		return false;
 
-	auto ShapeInstance = CreateShapeInstanceData(Vertices, Indices, *Mesh, NativeBarrier);
-	if (!ShapeInstance.IsSet())
+	TSharedPtr<FRtShapeBarrier> Shape = CreateShape(Vertices, Indices);
+	if (!Shape.IsValid())
 		return false;
 
-	TrackedAGXMeshes.Add(Mesh, std::move(ShapeInstance.GetValue()));
+	FAGX_RtShapeInstanceData& Data =
+		TrackedAGXMeshes.Add(Mesh, CreateShapeInstanceData(Shape, *Mesh, NativeBarrier));
+	ListenToTransformUpdates(*Mesh, Data);
 	return true;
 }
 
 bool AAGX_SensorEnvironment::AddInstancedMesh(
-	UInstancedStaticMeshComponent* Mesh, const TArray<FVector>& Vertices,
-	const TArray<FTriIndices>& Indices)
+	UInstancedStaticMeshComponent* Mesh, const TSharedPtr<FRtShapeBarrier>& Shape)
 {
 	AGX_CHECK(HasNative());
-	if (Mesh == nullptr || Vertices.Num() <= 0 || Indices.Num() <= 0)
+	if (Mesh == nullptr || !Shape.IsValid())
 		return false;
 
 	if (TrackedInstancedMeshes.Contains(Mesh))
 		return false;
 
 	FAGX_RtInstancedShapeInstanceData InstancedShapeInstance;
-	if (!InstancedShapeInstance.Shape.AllocateNative(Vertices, Indices))
-		return false;
+	InstancedShapeInstance.Shape = Shape;
 
 	TrackedInstancedMeshes.Add(Mesh, std::move(InstancedShapeInstance));
 	return true;
@@ -439,7 +681,7 @@ bool AAGX_SensorEnvironment::AddInstancedMeshInstance_Internal(
 
 	FAGX_RtInstanceData& InstanceData =
 		InstancedShapeInstance->InstancesData.Add(Index, FAGX_RtInstanceData());
-	InstanceData.Instance.AllocateNative(InstancedShapeInstance->Shape, NativeBarrier);
+	InstanceData.Instance.AllocateNative(*InstancedShapeInstance->Shape, NativeBarrier);
 	AGX_CHECK(InstanceData.Instance.HasNative());
 	FTransform InstanceTrans;
 	Mesh->GetInstanceTransform(Index, InstanceTrans, true);
@@ -543,7 +785,10 @@ bool AAGX_SensorEnvironment::RemoveMesh(UStaticMeshComponent* Mesh)
 	if (Mesh == nullptr)
 		return false;
 
-	return TrackedMeshes.Remove(Mesh) > 0;
+	if (PendingMeshes.Remove(Mesh) > 0)
+		return true;
+
+	return AGX_SensorEnvironment_helpers::RemoveTrackedMesh(TrackedMeshes, Mesh);
 }
 
 bool AAGX_SensorEnvironment::RemoveInstancedMesh(UInstancedStaticMeshComponent* Mesh)
@@ -646,12 +891,12 @@ void AAGX_SensorEnvironment::Tick(float DeltaSeconds)
 		return;
 
 	UpdateTrackedLidars();
+	UpdatePendingMeshes();
 	UpdateTrackedMeshes();
 
 	if (UpdateAddedInstancedMeshesTransforms)
 		UpdateTrackedInstancedMeshes();
 
-	UpdateTrackedAGXMeshes();
 	TickTrackedLidars();
 }
 
@@ -684,9 +929,12 @@ void AAGX_SensorEnvironment::EndPlay(const EEndPlayReason::Type Reason)
 	Super::EndPlay(Reason);
 
 	TrackedLidars.Empty();
-	TrackedMeshes.Empty();
+	AGX_SensorEnvironment_helpers::ClearTrackedMeshes(TrackedMeshes);
 	TrackedInstancedMeshes.Empty();
-	TrackedAGXMeshes.Empty();
+	AGX_SensorEnvironment_helpers::ClearTrackedMeshes(TrackedAGXMeshes);
+	SharedMeshShapes.Empty();
+	ClearPendingMeshes();
+	DirtyMeshes.Empty();
 
 	if (AmbientMaterial != nullptr && AmbientMaterial->HasNative())
 		AmbientMaterial->ReleaseNative();
@@ -847,13 +1095,43 @@ void AAGX_SensorEnvironment::UpdateTrackedLidars()
 
 		if (bAutoAddObjects)
 			AGX_SensorEnvironment_helpers::UpdateCollisionSphere(
-				It->Key.GetLidarComponent(), It->Value.Get());
+				It->Key.GetLidarComponent(), It->Value.Get(), PrefetchDistance);
 	}
 }
 
 void AAGX_SensorEnvironment::UpdateTrackedMeshes()
 {
-	AGX_SensorEnvironment_helpers::UpdateTrackedMeshes(TrackedMeshes);
+	using namespace AGX_SensorEnvironment_helpers;
+
+	auto OnBecameMovable = [this](USceneComponent& Mesh, FAGX_RtShapeInstanceData& Data)
+	{
+		ListenToTransformUpdates(Mesh, Data);
+		DirtyMeshes.Add(&Mesh);
+	};
+	SweepTrackedMeshes(TrackedMeshes, OnBecameMovable);
+	SweepTrackedMeshes(TrackedAGXMeshes, OnBecameMovable);
+
+	for (const TWeakObjectPtr<USceneComponent>& Component : DirtyMeshes)
+	{
+		USceneComponent* Mesh = Component.Get();
+		if (!IsValid(Mesh))
+			continue;
+
+		FAGX_RtShapeInstanceData* Data = nullptr;
+		if (auto StaticMesh = Cast<UStaticMeshComponent>(Mesh))
+			Data = TrackedMeshes.Find(StaticMesh);
+		else if (auto SimpleMesh = Cast<UAGX_SimpleMeshComponent>(Mesh))
+			Data = TrackedAGXMeshes.Find(SimpleMesh);
+
+		if (Data == nullptr)
+			continue;
+
+		const FTransform& CompTransform = Mesh->GetComponentTransform();
+		if (!CompTransform.Equals(Data->InstanceData.Transform))
+			Data->InstanceData.SetTransform(CompTransform);
+	}
+
+	DirtyMeshes.Reset();
 }
 
 void AAGX_SensorEnvironment::UpdateTrackedInstancedMeshes()
@@ -866,6 +1144,10 @@ void AAGX_SensorEnvironment::UpdateTrackedInstancedMeshes()
 			continue;
 		}
 
+		// Static Instanced Static Meshes cannot move during Play.
+		if (It->Key->Mobility == EComponentMobility::Static)
+			continue;
+
 		// Instance.
 		for (auto Ite = It->Value.InstancesData.CreateIterator(); Ite; ++Ite)
 		{
@@ -885,9 +1167,21 @@ void AAGX_SensorEnvironment::UpdateTrackedInstancedMeshes()
 	}
 }
 
-void AAGX_SensorEnvironment::UpdateTrackedAGXMeshes()
+void AAGX_SensorEnvironment::ListenToTransformUpdates(
+	USceneComponent& Mesh, FAGX_RtShapeInstanceData& Data)
 {
-	AGX_SensorEnvironment_helpers::UpdateTrackedMeshes(TrackedAGXMeshes);
+	if (Mesh.Mobility == EComponentMobility::Static)
+		return;
+
+	AGX_CHECK(!Data.TransformUpdatedHandle.IsValid());
+	Data.TransformUpdatedHandle = Mesh.TransformUpdated.AddUObject(
+		this, &AAGX_SensorEnvironment::OnTrackedMeshTransformUpdated);
+}
+
+void AAGX_SensorEnvironment::OnTrackedMeshTransformUpdated(
+	USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	DirtyMeshes.Add(Component);
 }
 
 void AAGX_SensorEnvironment::UpdateAmbientMaterial()
@@ -962,10 +1256,23 @@ void AAGX_SensorEnvironment::OnLidarBeginOverlapComponent(
 void AAGX_SensorEnvironment::OnLidarBeginOverlapStaticMeshComponent(UStaticMeshComponent& Mesh)
 {
 	FAGX_RtShapeInstanceData* ShapeInstanceData = TrackedMeshes.Find(&Mesh);
-	if (ShapeInstanceData == nullptr)
+	if (ShapeInstanceData != nullptr)
+	{
+		ShapeInstanceData->InstanceData.RefCount++;
+		return;
+	}
+
+	if (!bAddObjectsAsync)
+	{
 		AddMesh(&Mesh, DefaultLODIndex);
+		return;
+	}
+
+	FAGX_PendingRtShapeInstance* Pending = PendingMeshes.Find(&Mesh);
+	if (Pending == nullptr)
+		AddMeshAsync(Mesh);
 	else
-		ShapeInstanceData->InstanceData.RefCount++;
+		Pending->RefCount++;
 }
 
 void AAGX_SensorEnvironment::OnLidarBeginOverlapInstancedStaticMeshComponent(
@@ -1022,6 +1329,15 @@ void AAGX_SensorEnvironment::OnLidarEndOverlapComponent(
 
 void AAGX_SensorEnvironment::OnLidarEndOverlapStaticMeshComponent(UStaticMeshComponent& Mesh)
 {
+	if (FAGX_PendingRtShapeInstance* Pending = PendingMeshes.Find(&Mesh))
+	{
+		AGX_CHECK(Pending->RefCount > 0);
+		Pending->RefCount--;
+		if (Pending->RefCount == 0)
+			PendingMeshes.Remove(&Mesh);
+		return;
+	}
+
 	FAGX_RtShapeInstanceData* ShapeInstanceData = TrackedMeshes.Find(&Mesh);
 	if (ShapeInstanceData == nullptr)
 		return;
@@ -1029,7 +1345,7 @@ void AAGX_SensorEnvironment::OnLidarEndOverlapStaticMeshComponent(UStaticMeshCom
 	AGX_CHECK(ShapeInstanceData->InstanceData.RefCount > 0);
 	ShapeInstanceData->InstanceData.RefCount--;
 	if (ShapeInstanceData->InstanceData.RefCount == 0)
-		TrackedMeshes.Remove(&Mesh);
+		AGX_SensorEnvironment_helpers::RemoveTrackedMesh(TrackedMeshes, &Mesh);
 }
 
 void AAGX_SensorEnvironment::OnLidarEndOverlapInstancedStaticMeshComponent(
@@ -1066,5 +1382,5 @@ void AAGX_SensorEnvironment::OnLidarEndOverlapAGXMeshComponent(UAGX_SimpleMeshCo
 	AGX_CHECK(ShapeInstanceData->InstanceData.RefCount > 0);
 	ShapeInstanceData->InstanceData.RefCount--;
 	if (ShapeInstanceData->InstanceData.RefCount == 0)
-		TrackedAGXMeshes.Remove(&Mesh);
+		AGX_SensorEnvironment_helpers::RemoveTrackedMesh(TrackedAGXMeshes, &Mesh);
 }
@@ -12,6 +12,7 @@
 #include "Utilities/AGX_ShapeUtilities.h"
 
 // Unreal Engine includes.
+#include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "PhysicsEngine/AggregateGeom.h"
 #include "PhysicsEngine/BodySetup.h"
@@ -166,6 +167,16 @@ void UAGX_BoxShapeComponent::CreateVisualMesh(FAGX_SimpleMeshData& OutMeshData)
 		ToMeshVector(HalfExtent));
 }
 
+bool UAGX_BoxShapeComponent::GetInstancedVisual(
+	UStaticMesh*& OutMesh, FTransform& OutMeshTransform) const
+{
+	// The engine cube is 100 cm wide and centered at the origin.
+	OutMesh = FAGX_ObjectUtilities::GetAssetFromPath<UStaticMesh>(
+		TEXT("StaticMesh'/Engine/BasicShapes/Cube.Cube'"));
+	OutMeshTransform = FTransform(FQuat::Identity, FVector::ZeroVector, HalfExtent / 50.0);
+	return OutMesh != nullptr;
+}
+
 bool UAGX_BoxShapeComponent::SupportsShapeBodySetup()
 {
 	return true;
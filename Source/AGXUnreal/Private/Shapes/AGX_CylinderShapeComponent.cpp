@@ -12,6 +12,7 @@
 #include "Utilities/AGX_ShapeUtilities.h"
 
 // Unreal Engine includes.
+#include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "PhysicsEngine/AggregateGeom.h"
 #include "PhysicsEngine/BodySetup.h"
@@ -230,6 +231,19 @@ void UAGX_CylinderShapeComponent::CreateVisualMesh(FAGX_SimpleMeshData& OutMeshD
 			Radius, Height, NumCircleSegments, NumHeightSegments));
 }
 
+bool UAGX_CylinderShapeComponent::GetInstancedVisual(
+	UStaticMesh*& OutMesh, FTransform& OutMeshTransform) const
+{
+	// The engine cylinder has a diameter and height of 100 cm along the Z axis, while the AGX
+	// Dynamics cylinder is along the Y axis.
+	OutMesh = FAGX_ObjectUtilities::GetAssetFromPath<UStaticMesh>(
+		TEXT("StaticMesh'/Engine/BasicShapes/Cylinder.Cylinder'"));
+	OutMeshTransform = FTransform(
+		FRotator(0.0, 0.0, 90.0).Quaternion(), FVector::ZeroVector,
+		FVector(Radius / 50.0, Radius / 50.0, Height / 100.0));
+	return OutMesh != nullptr;
+}
+
 bool UAGX_CylinderShapeComponent::SupportsShapeBodySetup()
 {
 	return true;
@@ -83,6 +83,23 @@ void UAGX_HeightFieldShapeComponent::UpdateNativeProperties()
 	// NativeBarrier.SetHalfExtents(HalfExtent * GetComponentScale());
 }
 
+TFunction<void()> UAGX_HeightFieldShapeComponent::CreatePrepareHeightsTask()
+{
+	PreparedHeights.Reset();
+	if (HasNative() || SourceLandscape == nullptr)
+		return {};
+
+	TOptional<UAGX_HeightFieldBoundsComponent::FHeightFieldBoundsInfo> BoxBounds =
+		HeightFieldBounds->GetLandscapeAdjustedBounds();
+	if (!BoxBounds.IsSet())
+		return {};
+
+	const FVector StartPos = BoxBounds->Transform.TransformPositionNoScale(-BoxBounds->HalfExtent);
+	return AGX_HeightFieldUtilities::CreatePrepareHeightsTask(
+		*SourceLandscape, StartPos, BoxBounds->HalfExtent.X * 2.0, BoxBounds->HalfExtent.Y * 2.0,
+		PreparedHeights);
+}
+
 void UAGX_HeightFieldShapeComponent::CreateVisualMesh(FAGX_SimpleMeshData& OutMeshData)
 {
 	/// \todo What is the height field equivalent of this?
@@ -136,7 +153,8 @@ void UAGX_HeightFieldShapeComponent::CreateNative()
 
 	const FVector StartPos = BoxBounds->Transform.TransformPositionNoScale(-BoxBounds->HalfExtent);
 	NativeBarrier = AGX_HeightFieldUtilities::CreateHeightField(
-		*SourceLandscape, StartPos, BoxBounds->HalfExtent.X * 2.0, BoxBounds->HalfExtent.Y * 2.0);
+		*SourceLandscape, StartPos, BoxBounds->HalfExtent.X * 2.0, BoxBounds->HalfExtent.Y * 2.0,
+		PreparedHeights);
 	check(HasNative());
 
 	const FTransform Transform = BoxBounds->Transform;
@@ -0,0 +1,18 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Shapes/AGX_MeshPreprocessingSettings.h"
+
+bool FAGX_MeshPreprocessingSettings::IsEnabled() const
+{
+	return bWeldVertices || bRemoveDegenerateTriangles || bDecimate;
+}
+
+bool FAGX_MeshPreprocessingSettings::operator==(const FAGX_MeshPreprocessingSettings& Other) const
+{
+	// Parameters of disabled steps don't affect the result.
+	return bWeldVertices == Other.bWeldVertices &&
+		   (!bWeldVertices || WeldTolerance == Other.WeldTolerance) &&
+		   bRemoveDegenerateTriangles == Other.bRemoveDegenerateTriangles &&
+		   bDecimate == Other.bDecimate &&
+		   (!bDecimate || TargetTriangleCount == Other.TargetTriangleCount);
+}
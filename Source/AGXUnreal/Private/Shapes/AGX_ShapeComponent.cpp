@@ -15,6 +15,7 @@
 #include "Import/AGX_ImportContext.h"
 #include "Materials/AGX_ShapeMaterial.h"
 #include "Materials/ShapeMaterialBarrier.h"
+#include "Shapes/AGX_ShapeInstanceRenderer.h"
 #include "Shapes/RenderDataBarrier.h"
 #include "Shapes/RenderMaterial.h"
 #include "Utilities/AGX_ImportRuntimeUtilities.h"
@@ -75,6 +76,15 @@ void UAGX_ShapeComponent::UpdateVisualMesh()
 {
 	ClearMeshData();
 
+	if (AAGX_ShapeInstanceRenderer* Renderer = InstanceRenderer.Get())
+	{
+		// The visual is an instance of a shared mesh, only its size needs to be updated.
+		Renderer->UpdateMeshTransform(*this);
+		if (SupportsShapeBodySetup() && GetWorld() && GetWorld()->IsGameWorld())
+			UpdateBodySetup(); // Used only in runtime.
+		return;
+	}
+
 	TSharedPtr<FAGX_SimpleMeshData> Data(new FAGX_SimpleMeshData());
 
 	CreateVisualMesh(*Data.Get());
@@ -254,6 +264,7 @@ void UAGX_ShapeComponent::BeginPlay()
 	}
 
 	Simulation->Add(*this);
+	TryInstanceVisual(*Simulation);
 	UpdateVisualMesh();
 }
 
@@ -279,12 +290,38 @@ void UAGX_ShapeComponent::EndPlay(const EEndPlayReason::Type Reason)
 		}
 	}
 
+	if (AAGX_ShapeInstanceRenderer* Renderer = InstanceRenderer.Get())
+	{
+		Renderer->Remove(*this);
+	}
+	InstanceRenderer.Reset();
+
 	if (HasNative())
 	{
 		ReleaseNative();
 	}
 }
 
+bool UAGX_ShapeComponent::IsVisualInstanced() const
+{
+	return InstanceRenderer.IsValid();
+}
+
+void UAGX_ShapeComponent::TryInstanceVisual(UAGX_Simulation& Simulation)
+{
+	// Hidden Shapes are also handed over, so that they are rendered if they are made visible.
+	if (!Simulation.bInstancedShapeVisuals)
+		return;
+
+	UStaticMesh* Mesh = nullptr;
+	FTransform MeshTransform;
+	if (!GetInstancedVisual(Mesh, MeshTransform))
+		return;
+
+	if (AAGX_ShapeInstanceRenderer* Renderer = Simulation.GetOrCreateShapeInstanceRenderer())
+		Renderer->Add(*this);
+}
+
 void UAGX_ShapeComponent::UpdateNativeLocalTransform()
 {
 	if (!HasNative())
@@ -714,6 +751,27 @@ void UAGX_ShapeComponent::OnAttachmentChanged()
 	GetNative()->SetWorldRotation(GetComponentQuat());
 }
 
+void UAGX_ShapeComponent::SetMaterial(int32 ElementIndex, UMaterialInterface* Material)
+{
+	Super::SetMaterial(ElementIndex, Material);
+	if (AAGX_ShapeInstanceRenderer* Renderer = InstanceRenderer.Get())
+		Renderer->UpdateInstance(*this);
+}
+
+void UAGX_ShapeComponent::OnVisibilityChanged()
+{
+	Super::OnVisibilityChanged();
+	if (AAGX_ShapeInstanceRenderer* Renderer = InstanceRenderer.Get())
+		Renderer->UpdateInstance(*this);
+}
+
+void UAGX_ShapeComponent::OnHiddenInGameChanged()
+{
+	Super::OnHiddenInGameChanged();
+	if (AAGX_ShapeInstanceRenderer* Renderer = InstanceRenderer.Get())
+		Renderer->UpdateInstance(*this);
+}
+
 void UAGX_ShapeComponent::OnRegister()
 {
 	Super::OnRegister();
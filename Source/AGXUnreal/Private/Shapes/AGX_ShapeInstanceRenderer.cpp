@@ -0,0 +1,235 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Shapes/AGX_ShapeInstanceRenderer.h"
+
+// AGX Dynamics for Unreal includes.
+#include "Shapes/AGX_ShapeComponent.h"
+#include "Utilities/AGX_RenderUtilities.h"
+
+// Unreal Engine includes.
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+
+AAGX_ShapeInstanceRenderer::AAGX_ShapeInstanceRenderer()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	// Shapes are moved by their Rigid Bodies in TG_PostPhysics, flush all instance transforms
+	// once after that.
+	PrimaryActorTick.TickGroup = TG_PostUpdateWork;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("DefaultSceneRoot"));
+}
+
+bool AAGX_ShapeInstanceRenderer::Add(UAGX_ShapeComponent& Shape)
+{
+	if (Handles.Contains(&Shape))
+		return true;
+
+	UStaticMesh* Mesh = nullptr;
+	FTransform MeshTransform;
+	if (!Shape.GetInstancedVisual(Mesh, MeshTransform) || Mesh == nullptr)
+		return false;
+
+	FInstanceHandle& Handle = Handles.Add(&Shape);
+	Handle.TransformUpdatedHandle = Shape.TransformUpdated.AddUObject(
+		this, &AAGX_ShapeInstanceRenderer::OnShapeTransformUpdated);
+	Shape.InstanceRenderer = this;
+
+	UpdateInstance(Shape);
+	return true;
+}
+
+void AAGX_ShapeInstanceRenderer::Remove(UAGX_ShapeComponent& Shape)
+{
+	FInstanceHandle Handle;
+	if (!Handles.RemoveAndCopyValue(&Shape, Handle))
+		return;
+
+	Shape.TransformUpdated.Remove(Handle.TransformUpdatedHandle);
+	Shape.InstanceRenderer.Reset();
+	if (Handle.Batch != INDEX_NONE)
+		RemoveInstance(Handle);
+}
+
+void AAGX_ShapeInstanceRenderer::UpdateInstance(UAGX_ShapeComponent& Shape)
+{
+	FInstanceHandle* Handle = Handles.Find(&Shape);
+	if (Handle == nullptr)
+		return;
+
+	UStaticMesh* Mesh = nullptr;
+	FTransform MeshTransform;
+	const bool bRender = Shape.IsVisible() && !Shape.bHiddenInGame &&
+						 Shape.GetInstancedVisual(Mesh, MeshTransform) && Mesh != nullptr;
+	const int32 BatchIndex =
+		bRender ? GetOrCreateBatch(*Mesh, Shape.GetMaterial(0), Shape.CastShadow) : INDEX_NONE;
+	if (BatchIndex == Handle->Batch)
+		return;
+
+	if (Handle->Batch != INDEX_NONE)
+		RemoveInstance(*Handle);
+
+	if (BatchIndex != INDEX_NONE)
+		AddInstance(Shape, *Handle, BatchIndex, MeshTransform);
+}
+
+void AAGX_ShapeInstanceRenderer::UpdateMeshTransform(UAGX_ShapeComponent& Shape)
+{
+	const FInstanceHandle* Handle = Handles.Find(&Shape);
+	if (Handle == nullptr || Handle->Batch == INDEX_NONE)
+		return;
+
+	UStaticMesh* Mesh = nullptr;
+	FTransform MeshTransform;
+	if (!Shape.GetInstancedVisual(Mesh, MeshTransform))
+		return;
+
+	FAGX_ShapeInstanceBatch& Batch = Batches[Handle->Batch];
+	Batch.MeshTransforms[Handle->Instance] = MeshTransform;
+	Batch.Transforms[Handle->Instance] = MeshTransform * Shape.GetComponentTransform();
+	Batch.bTransformsDirty = true;
+}
+
+int32 AAGX_ShapeInstanceRenderer::GetNumInstances() const
+{
+	return Handles.Num();
+}
+
+UInstancedStaticMeshComponent* AAGX_ShapeInstanceRenderer::GetInstances(
+	const UAGX_ShapeComponent& Shape) const
+{
+	const FInstanceHandle* Handle = Handles.Find(&Shape);
+	if (Handle == nullptr || Handle->Batch == INDEX_NONE)
+		return nullptr;
+
+	return Batches[Handle->Batch].Instances;
+}
+
+void AAGX_ShapeInstanceRenderer::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// SetCastShadow is not virtual, so the Shapes cannot forward changes to it like they do for
+	// visibility and material.
+	TArray<UAGX_ShapeComponent*> ShadowChanged;
+	for (const FAGX_ShapeInstanceBatch& Batch : Batches)
+	{
+		for (const TWeakObjectPtr<UAGX_ShapeComponent>& Shape : Batch.Shapes)
+		{
+			if (Shape.IsValid() && static_cast<bool>(Shape->CastShadow) != Batch.bCastShadow)
+				ShadowChanged.Add(Shape.Get());
+		}
+	}
+	for (UAGX_ShapeComponent* Shape : ShadowChanged)
+		UpdateInstance(*Shape);
+
+	for (FAGX_ShapeInstanceBatch& Batch : Batches)
+	{
+		if (!Batch.bTransformsDirty || Batch.Transforms.IsEmpty())
+			continue;
+
+		// One render state update per batch, regardless of how many Shapes moved.
+		Batch.Instances->BatchUpdateInstancesTransforms(
+			0, Batch.Transforms, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true);
+		Batch.bTransformsDirty = false;
+	}
+}
+
+void AAGX_ShapeInstanceRenderer::EndPlay(const EEndPlayReason::Type Reason)
+{
+	Super::EndPlay(Reason);
+
+	for (const auto& Entry : Handles)
+	{
+		if (UAGX_ShapeComponent* Shape = Entry.Key.ResolveObjectPtr())
+		{
+			Shape->TransformUpdated.Remove(Entry.Value.TransformUpdatedHandle);
+			Shape->InstanceRenderer.Reset();
+		}
+	}
+
+	Batches.Empty();
+	Handles.Empty();
+}
+
+int32 AAGX_ShapeInstanceRenderer::GetOrCreateBatch(
+	UStaticMesh& Mesh, UMaterialInterface* Material, bool bCastShadow)
+{
+	for (int32 I = 0; I < Batches.Num(); ++I)
+	{
+		const FAGX_ShapeInstanceBatch& Batch = Batches[I];
+		if (Batch.Mesh == &Mesh && Batch.Material == Material && Batch.bCastShadow == bCastShadow)
+			return I;
+	}
+
+	FAGX_ShapeInstanceBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.Mesh = &Mesh;
+	Batch.Material = Material;
+	Batch.bCastShadow = bCastShadow;
+
+	const FName Name = MakeUniqueObjectName(
+		this, UInstancedStaticMeshComponent::StaticClass(), FName(TEXT("ShapeInstances")));
+	Batch.Instances = NewObject<UInstancedStaticMeshComponent>(this, Name);
+	Batch.Instances->SetCanEverAffectNavigation(false);
+	Batch.Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Batch.Instances->SetMobility(EComponentMobility::Movable);
+	Batch.Instances->RegisterComponent();
+	Batch.Instances->AttachToComponent(
+		RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+	Batch.Instances->SetStaticMesh(&Mesh);
+	Batch.Instances->SetMaterial(0, Material);
+	Batch.Instances->SetCastShadow(bCastShadow);
+
+	return Batches.Num() - 1;
+}
+
+void AAGX_ShapeInstanceRenderer::AddInstance(
+	UAGX_ShapeComponent& Shape, FInstanceHandle& Handle, int32 BatchIndex,
+	const FTransform& MeshTransform)
+{
+	FAGX_ShapeInstanceBatch& Batch = Batches[BatchIndex];
+	Handle.Batch = BatchIndex;
+	Handle.Instance = Batch.Shapes.Add(&Shape);
+	Batch.MeshTransforms.Add(MeshTransform);
+	Batch.Transforms.Add(MeshTransform * Shape.GetComponentTransform());
+	Batch.bTransformsDirty = true;
+	FAGX_RenderUtilities::SetInstanceCount(*Batch.Instances, Batch.Shapes.Num());
+}
+
+void AAGX_ShapeInstanceRenderer::RemoveInstance(FInstanceHandle& Handle)
+{
+	FAGX_ShapeInstanceBatch& Batch = Batches[Handle.Batch];
+
+	// Move the last instance into the removed slot so that all other instances keep their index.
+	Batch.Shapes.RemoveAtSwap(Handle.Instance);
+	Batch.MeshTransforms.RemoveAtSwap(Handle.Instance);
+	Batch.Transforms.RemoveAtSwap(Handle.Instance);
+	if (Batch.Shapes.IsValidIndex(Handle.Instance))
+	{
+		if (UAGX_ShapeComponent* Moved = Batch.Shapes[Handle.Instance].Get())
+			Handles[Moved].Instance = Handle.Instance;
+	}
+
+	FAGX_RenderUtilities::SetInstanceCount(*Batch.Instances, Batch.Shapes.Num());
+	Batch.bTransformsDirty = true;
+
+	Handle.Batch = INDEX_NONE;
+	Handle.Instance = INDEX_NONE;
+}
+
+void AAGX_ShapeInstanceRenderer::OnShapeTransformUpdated(
+	USceneComponent* Component, EUpdateTransformFlags Flags, ETeleportType Teleport)
+{
+	UAGX_ShapeComponent* Shape = Cast<UAGX_ShapeComponent>(Component);
+	const FInstanceHandle* Handle = Shape != nullptr ? Handles.Find(Shape) : nullptr;
+	if (Handle == nullptr || Handle->Batch == INDEX_NONE)
+		return;
+
+	FAGX_ShapeInstanceBatch& Batch = Batches[Handle->Batch];
+	Batch.Transforms[Handle->Instance] =
+		Batch.MeshTransforms[Handle->Instance] * Shape->GetComponentTransform();
+	Batch.bTransformsDirty = true;
+}
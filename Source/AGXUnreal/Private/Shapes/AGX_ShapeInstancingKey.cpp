@@ -0,0 +1,15 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Shapes/AGX_ShapeInstancingKey.h"
+
+bool FAGX_ShapeInstancingKey::IsValid() const
+{
+	return Source.IsValid();
+}
+
+bool FAGX_ShapeInstancingKey::Matches(const FAGX_ShapeInstancingKey& Other) const
+{
+	return IsValid() && Source == Other.Source && LodIndex == Other.LodIndex &&
+		   Preprocessing == Other.Preprocessing &&
+		   RelativeTransform.Equals(Other.RelativeTransform, TransformTolerance);
+}
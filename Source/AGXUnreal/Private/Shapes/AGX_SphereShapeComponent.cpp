@@ -7,8 +7,10 @@
 #include "Components/StaticMeshComponent.h"
 #include "Import/AGX_ImportContext.h"
 #include "Utilities/AGX_MeshUtilities.h"
+#include "Utilities/AGX_ObjectUtilities.h"
 
 // Unreal Engine includes.
+#include "Engine/StaticMesh.h"
 #include "PhysicsEngine/AggregateGeom.h"
 #include "PhysicsEngine/BodySetup.h"
 
@@ -116,6 +118,16 @@ void UAGX_SphereShapeComponent::CreateVisualMesh(FAGX_SimpleMeshData& OutMeshDat
 		Radius, 32);
 }
 
+bool UAGX_SphereShapeComponent::GetInstancedVisual(
+	UStaticMesh*& OutMesh, FTransform& OutMeshTransform) const
+{
+	// The engine sphere has a diameter of 100 cm and is centered at the origin.
+	OutMesh = FAGX_ObjectUtilities::GetAssetFromPath<UStaticMesh>(
+		TEXT("StaticMesh'/Engine/BasicShapes/Sphere.Sphere'"));
+	OutMeshTransform = FTransform(FQuat::Identity, FVector::ZeroVector, FVector(Radius / 50.0));
+	return OutMesh != nullptr;
+}
+
 bool UAGX_SphereShapeComponent::SupportsShapeBodySetup()
 {
 	return true;
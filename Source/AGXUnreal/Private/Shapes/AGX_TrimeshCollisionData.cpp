@@ -0,0 +1,203 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Shapes/AGX_TrimeshCollisionData.h"
+
+// AGX Dynamics for Unreal includes.
+#include "Utilities/AGX_MeshPreprocessing.h"
+#include "Utilities/AGX_MeshUtilities.h"
+
+// Unreal Engine includes.
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+
+namespace AGX_TrimeshCollisionData_helpers
+{
+	bool GetSourceBufferSizes(
+		const UStaticMesh& StaticMesh, uint32 LodIndex, int32& OutNumVertices,
+		int32& OutNumIndices)
+	{
+		if (!StaticMesh.HasValidRenderData(/*bCheckLODForVerts*/ true, LodIndex))
+			return false;
+
+		const FStaticMeshLODResources& Mesh = StaticMesh.GetLODForExport(LodIndex);
+		OutNumVertices =
+			static_cast<int32>(Mesh.VertexBuffers.PositionVertexBuffer.GetNumVertices());
+		OutNumIndices = Mesh.IndexBuffer.GetNumIndices();
+		return true;
+	}
+
+	// Identifies the content of the render data. Changes when the Static Mesh is reimported or its
+	// build settings change, even if the buffer sizes stay the same. Empty in cooked builds.
+	FString GetDerivedDataKey(const UStaticMesh& StaticMesh)
+	{
+#if WITH_EDITORONLY_DATA
+		if (const FStaticMeshRenderData* RenderData = StaticMesh.GetRenderData())
+			return RenderData->DerivedDataKey;
+#endif
+		return FString();
+	}
+
+	void SetSource(
+		const UStaticMesh& StaticMesh, uint32 LodIndex, TSoftObjectPtr<UStaticMesh>& OutMesh,
+		int32& OutLodIndex, int32& OutNumVertices, int32& OutNumIndices,
+		FString& OutDerivedDataKey)
+	{
+		GetSourceBufferSizes(StaticMesh, LodIndex, OutNumVertices, OutNumIndices);
+		OutMesh = const_cast<UStaticMesh*>(&StaticMesh);
+		OutLodIndex = static_cast<int32>(LodIndex);
+		OutDerivedDataKey = GetDerivedDataKey(StaticMesh);
+	}
+
+	bool IsSourceUnchanged(
+		const UStaticMesh& StaticMesh, uint32 LodIndex, const TSoftObjectPtr<UStaticMesh>& Mesh,
+		int32 SourceLodIndex, int32 SourceNumVertices, int32 SourceNumIndices,
+		const FString& SourceDerivedDataKey)
+	{
+		if (SourceLodIndex != static_cast<int32>(LodIndex) ||
+			Mesh.ToSoftObjectPath() != FSoftObjectPath(&StaticMesh))
+		{
+			return false;
+		}
+
+		int32 NumVertices = 0;
+		int32 NumIndices = 0;
+		if (!GetSourceBufferSizes(StaticMesh, LodIndex, NumVertices, NumIndices))
+			return false;
+
+		if (NumVertices != SourceNumVertices || NumIndices != SourceNumIndices)
+			return false;
+
+		const FString DerivedDataKey = GetDerivedDataKey(StaticMesh);
+		return DerivedDataKey.IsEmpty() || DerivedDataKey == SourceDerivedDataKey;
+	}
+}
+
+bool FAGX_TrimeshCollisionData::IsEmpty() const
+{
+	return Vertices.Num() == 0 || Indices.Num() == 0;
+}
+
+void FAGX_TrimeshCollisionData::Reset()
+{
+	SourceMesh.Reset();
+	SourceLodIndex = -1;
+	SourceNumVertices = 0;
+	SourceNumIndices = 0;
+	SourceDerivedDataKey.Empty();
+	Preprocessing = FAGX_MeshPreprocessingSettings();
+	Vertices.Empty();
+	Indices.Empty();
+}
+
+bool FAGX_TrimeshCollisionData::Build(
+	const UStaticMesh& StaticMesh, uint32 LodIndex,
+	const FAGX_MeshPreprocessingSettings& InPreprocessing)
+{
+	using namespace AGX_TrimeshCollisionData_helpers;
+
+	Reset();
+
+	if (!AGX_MeshUtilities::GetStaticMeshWeldedTriangleData(
+			StaticMesh, LodIndex, Vertices, Indices))
+	{
+		Reset();
+		return false;
+	}
+
+	AGX_MeshPreprocessing::Process(Vertices, Indices, InPreprocessing);
+	if (IsEmpty())
+	{
+		Reset();
+		return false;
+	}
+
+	SetSource(
+		StaticMesh, LodIndex, SourceMesh, SourceLodIndex, SourceNumVertices, SourceNumIndices,
+		SourceDerivedDataKey);
+	Preprocessing = InPreprocessing;
+	return true;
+}
+
+bool FAGX_TrimeshCollisionData::IsValidFor(
+	const UStaticMesh& StaticMesh, uint32 LodIndex,
+	const FAGX_MeshPreprocessingSettings& InPreprocessing) const
+{
+	using namespace AGX_TrimeshCollisionData_helpers;
+
+	return !IsEmpty() && Preprocessing == InPreprocessing &&
+		   IsSourceUnchanged(
+			   StaticMesh, LodIndex, SourceMesh, SourceLodIndex, SourceNumVertices,
+			   SourceNumIndices, SourceDerivedDataKey);
+}
+
+bool FAGX_ConvexDecompositionData::IsEmpty() const
+{
+	return Hulls.Num() == 0;
+}
+
+void FAGX_ConvexDecompositionData::Reset()
+{
+	*this = FAGX_ConvexDecompositionData();
+}
+
+#if WITH_EDITOR
+bool FAGX_ConvexDecompositionData::Build(
+	const UStaticMesh& StaticMesh, uint32 LodIndex, int32 InMaxHulls, int32 InMaxHullVertices,
+	int32 InResolution)
+{
+	using namespace AGX_TrimeshCollisionData_helpers;
+
+	Reset();
+
+	TArray<TArray<FVector>> HullVertices;
+	TArray<TArray<FTriIndices>> HullIndices;
+	if (!AGX_MeshUtilities::GenerateConvexDecomposition(
+			StaticMesh, LodIndex, InMaxHulls, InMaxHullVertices, InResolution, HullVertices,
+			HullIndices))
+	{
+		return false;
+	}
+
+	for (int32 HullIndex = 0; HullIndex < HullVertices.Num(); ++HullIndex)
+	{
+		FAGX_ConvexHull& Hull = Hulls.AddDefaulted_GetRef();
+		for (const FVector& Vertex : HullVertices[HullIndex])
+			Hull.Vertices.Add(FVector3f(Vertex));
+		for (const FTriIndices& Triangle : HullIndices[HullIndex])
+		{
+			Hull.Indices.Add(static_cast<uint32>(Triangle.v0));
+			Hull.Indices.Add(static_cast<uint32>(Triangle.v1));
+			Hull.Indices.Add(static_cast<uint32>(Triangle.v2));
+		}
+	}
+
+	SetSource(
+		StaticMesh, LodIndex, SourceMesh, SourceLodIndex, SourceNumVertices, SourceNumIndices,
+		SourceDerivedDataKey);
+	MaxHulls = InMaxHulls;
+	MaxHullVertices = InMaxHullVertices;
+	Resolution = InResolution;
+	return true;
+}
+#endif
+
+bool FAGX_ConvexDecompositionData::IsValidFor(const UStaticMesh& StaticMesh, uint32 LodIndex) const
+{
+	using namespace AGX_TrimeshCollisionData_helpers;
+
+	return !IsEmpty() && IsSourceUnchanged(
+							 StaticMesh, LodIndex, SourceMesh, SourceLodIndex,
+							 SourceNumVertices, SourceNumIndices, SourceDerivedDataKey);
+}
+
+void FAGX_ConvexDecompositionData::GetHulls(
+	const FTransform& Transform, TArray<TArray<FVector>>& OutVertices,
+	TArray<TArray<FTriIndices>>& OutIndices) const
+{
+	for (const FAGX_ConvexHull& Hull : Hulls)
+	{
+		AGX_MeshUtilities::TransformWeldedTriangleData(
+			Hull.Vertices, Hull.Indices, Transform, OutVertices.AddDefaulted_GetRef(),
+			OutIndices.AddDefaulted_GetRef());
+	}
+}
@@ -0,0 +1,131 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Shapes/AGX_TrimeshCollisionDataAsset.h"
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+#include "Utilities/AGX_ObjectUtilities.h"
+
+// Unreal Engine includes.
+#include "Engine/StaticMesh.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+const FAGX_TrimeshCollisionData* UAGX_TrimeshCollisionDataAsset::FindTriangleData(
+	const UStaticMesh& StaticMesh, uint32 LodIndex,
+	const FAGX_MeshPreprocessingSettings& Preprocessing) const
+{
+	for (const FAGX_TrimeshCollisionData& Data : TriangleData)
+	{
+		if (Data.SourceLodIndex == static_cast<int32>(LodIndex) &&
+			Data.Preprocessing == Preprocessing)
+		{
+			return Data.IsValidFor(StaticMesh, LodIndex, Preprocessing) ? &Data : nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+const FAGX_ConvexDecompositionData* UAGX_TrimeshCollisionDataAsset::FindConvexDecomposition(
+	const UStaticMesh& StaticMesh, uint32 LodIndex) const
+{
+	return ConvexDecomposition.IsValidFor(StaticMesh, LodIndex) ? &ConvexDecomposition : nullptr;
+}
+
+#if WITH_EDITOR
+
+bool UAGX_TrimeshCollisionDataAsset::UpdateTriangleData(
+	const UStaticMesh& StaticMesh, uint32 LodIndex,
+	const FAGX_MeshPreprocessingSettings& Preprocessing)
+{
+	FAGX_TrimeshCollisionData* Data = TriangleData.FindByPredicate(
+		[LodIndex, &Preprocessing](const FAGX_TrimeshCollisionData& Candidate)
+		{
+			return Candidate.SourceLodIndex == static_cast<int32>(LodIndex) &&
+				   Candidate.Preprocessing == Preprocessing;
+		});
+	if (Data != nullptr && Data->IsValidFor(StaticMesh, LodIndex, Preprocessing))
+		return false;
+
+	Modify();
+	if (Data == nullptr)
+		Data = &TriangleData.AddDefaulted_GetRef();
+
+	if (!Data->Build(StaticMesh, LodIndex, Preprocessing))
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Could not build collision data for LOD %u of Static Mesh '%s'. The triangle "
+				 "data will be read from the Static Mesh at Begin Play."),
+			LodIndex, *StaticMesh.GetName());
+		TriangleData.RemoveAll([](const FAGX_TrimeshCollisionData& Candidate)
+							   { return Candidate.IsEmpty(); });
+	}
+
+	return true;
+}
+
+FString UAGX_TrimeshCollisionDataAsset::GetPackagePath(const UStaticMesh& StaticMesh)
+{
+	return FString::Printf(
+		TEXT("%s_AGXCollisionData"), *StaticMesh.GetOutermost()->GetName());
+}
+
+UAGX_TrimeshCollisionDataAsset* UAGX_TrimeshCollisionDataAsset::FindOrCreate(
+	UStaticMesh& StaticMesh)
+{
+	const FString PackagePath = GetPackagePath(StaticMesh);
+	if (StaticMesh.GetOutermost() == GetTransientPackage() ||
+		!FPackageName::IsValidLongPackageName(PackagePath) ||
+		PackagePath.StartsWith(TEXT("/Engine/")) || PackagePath.StartsWith(TEXT("/Script/")))
+	{
+		return nullptr;
+	}
+
+	const FString AssetName = FPackageName::GetLongPackageAssetName(PackagePath);
+	const FString ObjectPath = FString::Printf(TEXT("%s.%s"), *PackagePath, *AssetName);
+	if (auto Loaded = FindObject<UAGX_TrimeshCollisionDataAsset>(nullptr, *ObjectPath))
+		return Loaded;
+
+	if (FPackageName::DoesPackageExist(PackagePath))
+	{
+		if (auto Existing = LoadObject<UAGX_TrimeshCollisionDataAsset>(nullptr, *ObjectPath))
+			return Existing;
+	}
+
+	UPackage* Package = CreatePackage(*PackagePath);
+	auto Asset = NewObject<UAGX_TrimeshCollisionDataAsset>(
+		Package, FName(*AssetName), RF_Public | RF_Standalone);
+	if (Asset == nullptr)
+		return nullptr;
+
+	Asset->SourceMesh = &StaticMesh;
+	return Asset;
+}
+
+void UAGX_TrimeshCollisionDataAsset::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// Rebuild stale entries so that what is saved, or cooked, matches the Static Mesh. Objects
+	// may not be loaded while saving, a Static Mesh that isn't loaded cannot have been modified.
+	const UStaticMesh* StaticMesh = SourceMesh.Get();
+	if (StaticMesh == nullptr)
+		return;
+
+	TArray<TPair<int32, FAGX_MeshPreprocessingSettings>> Keys;
+	for (const FAGX_TrimeshCollisionData& Data : TriangleData)
+		Keys.Emplace(Data.SourceLodIndex, Data.Preprocessing);
+
+	TriangleData.RemoveAll([StaticMesh](const FAGX_TrimeshCollisionData& Data)
+						   { return Data.SourceLodIndex >= StaticMesh->GetNumLODs(); });
+	for (const auto& Key : Keys)
+	{
+		if (Key.Key >= 0 && Key.Key < StaticMesh->GetNumLODs())
+			UpdateTriangleData(*StaticMesh, static_cast<uint32>(Key.Key), Key.Value);
+	}
+}
+
+#endif
@@ -5,8 +5,10 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_LogCategory.h"
 #include "AGX_MeshWithTransform.h"
+#include "AGX_Simulation.h"
 #include "Import/AGX_ImportContext.h"
 #include "Import/AGX_ImportSettings.h"
+#include "Shapes/AGX_TrimeshCollisionDataAsset.h"
 #include "Utilities/AGX_ImportRuntimeUtilities.h"
 #include "Utilities/AGX_MeshUtilities.h"
 #include "Utilities/AGX_ObjectUtilities.h"
@@ -75,6 +77,149 @@ FTrimeshShapeBarrier* UAGX_TrimeshShapeComponent::GetNativeTrimesh()
 	return &NativeBarrier;
 }
 
+TFunction<void()> UAGX_TrimeshShapeComponent::CreatePrepareCollisionDataTask()
+{
+	PreparedCollisionData.Reset();
+
+	if (HasNative())
+		return {};
+
+	const FAGX_MeshWithTransform Mesh = FindMeshSource();
+	if (!Mesh.IsValid())
+		return {};
+
+	if (CollisionType == EAGX_TrimeshCollisionType::ConvexDecomposition)
+	{
+		// The convex hulls are already triangulated, there is nothing to weld.
+		return {};
+	}
+
+	const UStaticMesh& StaticMesh = *Mesh.Mesh.Get();
+#if !WITH_EDITOR
+	// Without CPU access the triangle data must be copied from GPU memory through the render
+	// thread, which requires the game thread to flush rendering commands.
+	if (!StaticMesh.bAllowCPUAccess)
+		return {};
+#endif
+
+	const uint32 LodIndex = AGX_MeshUtilities::GetCollisionLodIndex(
+		StaticMesh, bOverrideMeshSourceLodIndex ? &MeshSourceLodIndex : nullptr);
+	if (bCacheCollisionData && CollisionDataAsset != nullptr &&
+		CollisionDataAsset->FindTriangleData(StaticMesh, LodIndex, MeshPreprocessing) != nullptr)
+	{
+		// The cached data is already cheap to use, nothing to gain from preparing it.
+		return {};
+	}
+
+	const FTransform ComponentTransformNoScale =
+		FTransform(GetComponentRotation(), GetComponentLocation());
+	const FTransform RelativeTransform =
+		Mesh.Transform.GetRelativeTransform(ComponentTransformNoScale);
+
+	PreparedCollisionData = MakeShared<FPreparedCollisionData, ESPMode::ThreadSafe>();
+	return [Result = PreparedCollisionData, StaticMeshPtr = &StaticMesh, RelativeTransform,
+			LodIndex, Preprocessing = MeshPreprocessing]()
+	{
+		FAGX_TrimeshCollisionData Data;
+		if (!Data.Build(*StaticMeshPtr, LodIndex, Preprocessing))
+			return;
+
+		AGX_MeshUtilities::TransformWeldedTriangleData(
+			Data.Vertices, Data.Indices, RelativeTransform, Result->Vertices, Result->Indices);
+		Result->bValid = true;
+	};
+}
+
+void UAGX_TrimeshShapeComponent::GenerateConvexDecomposition()
+{
+#if WITH_EDITOR
+	const FAGX_MeshWithTransform Mesh = FindMeshSource();
+	if (!Mesh.IsValid())
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Cannot generate convex decomposition for Trimesh Shape Component '%s' in '%s' "
+				 "because it does not have a Static Mesh source."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return;
+	}
+
+	UStaticMesh& StaticMesh = *Mesh.Mesh.Get();
+	UAGX_TrimeshCollisionDataAsset* Asset =
+		UAGX_TrimeshCollisionDataAsset::FindOrCreate(StaticMesh);
+	if (Asset == nullptr)
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Cannot generate convex decomposition for Trimesh Shape Component '%s' in '%s' "
+				 "because no collision data asset can be created for Static Mesh '%s'. Static "
+				 "Meshes in engine content or without a package are not supported."),
+			*GetName(), *GetLabelSafe(GetOwner()), *StaticMesh.GetName());
+		return;
+	}
+
+	const uint32 LodIndex = AGX_MeshUtilities::GetCollisionLodIndex(
+		StaticMesh, bOverrideMeshSourceLodIndex ? &MeshSourceLodIndex : nullptr);
+	FAGX_ConvexDecompositionData Decomposition;
+	if (!Decomposition.Build(
+			StaticMesh, LodIndex, MaxConvexHulls, MaxConvexHullVertices,
+			ConvexDecompositionResolution))
+	{
+		return;
+	}
+
+	Asset->Modify();
+	Asset->ConvexDecomposition = MoveTemp(Decomposition);
+	FAGX_ObjectUtilities::SaveAsset(*Asset);
+
+	Modify();
+	CollisionDataAsset = Asset;
+	CollisionType = EAGX_TrimeshCollisionType::ConvexDecomposition;
+#endif
+}
+
+void UAGX_TrimeshShapeComponent::UpdateCollisionDataAsset()
+{
+#if WITH_EDITOR
+	const FAGX_MeshWithTransform Mesh = FindMeshSource();
+	if (!Mesh.IsValid())
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Cannot update collision data asset for Trimesh Shape Component '%s' in '%s' "
+				 "because it does not have a Static Mesh source."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return;
+	}
+
+	UStaticMesh& StaticMesh = *Mesh.Mesh.Get();
+	UAGX_TrimeshCollisionDataAsset* Asset =
+		UAGX_TrimeshCollisionDataAsset::FindOrCreate(StaticMesh);
+	if (Asset == nullptr)
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Cannot create collision data asset for Static Mesh '%s' used by Trimesh Shape "
+				 "Component '%s' in '%s'. Static Meshes in engine content or without a package "
+				 "cannot be cached."),
+			*StaticMesh.GetName(), *GetName(), *GetLabelSafe(GetOwner()));
+		return;
+	}
+
+	const uint32 LodIndex = AGX_MeshUtilities::GetCollisionLodIndex(
+		StaticMesh, bOverrideMeshSourceLodIndex ? &MeshSourceLodIndex : nullptr);
+	if (Asset->UpdateTriangleData(StaticMesh, LodIndex, MeshPreprocessing) ||
+		Asset->GetPackage()->IsDirty())
+		FAGX_ObjectUtilities::SaveAsset(*Asset);
+
+	if (CollisionDataAsset != Asset)
+	{
+		Modify();
+		CollisionDataAsset = Asset;
+	}
+#endif
+}
+
 void UAGX_TrimeshShapeComponent::UpdateNativeProperties()
 {
 	if (!HasNative())
@@ -258,7 +403,14 @@ void UAGX_TrimeshShapeComponent::PostEditChangeProperty(FPropertyChangedEvent& P
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
 	if (PropertyChangedEvent.GetPropertyName().IsEqual(
-			GET_MEMBER_NAME_CHECKED(UAGX_ShapeComponent, bIsSensor)))
+			GET_MEMBER_NAME_CHECKED(UAGX_TrimeshShapeComponent, bCacheCollisionData)))
+	{
+		// The asset is kept when disabling since it may also hold a convex decomposition.
+		if (bCacheCollisionData)
+			UpdateCollisionDataAsset();
+	}
+	else if (PropertyChangedEvent.GetPropertyName().IsEqual(
+				 GET_MEMBER_NAME_CHECKED(UAGX_ShapeComponent, bIsSensor)))
 	{
 		if (UMeshComponent* Mesh = FindMeshComponent(MeshSourceLocation))
 		{
@@ -326,9 +478,43 @@ void UAGX_TrimeshShapeComponent::CreateNative()
 {
 	check(!HasNative());
 
+	if (CollisionType == EAGX_TrimeshCollisionType::ConvexDecomposition &&
+		CreateNativeConvexDecomposition())
+	{
+		UpdateNativeProperties();
+		return;
+	}
+
+	// Instances spawned through UAGX_Simulation::SpawnInstances share collision mesh data.
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
+	const FAGX_ShapeInstancingKey InstancingKey =
+		Simulation != nullptr && Simulation->IsSpawningInstances() &&
+				CollisionType == EAGX_TrimeshCollisionType::Trimesh
+			? GetInstancingKey()
+			: FAGX_ShapeInstancingKey();
+	if (InstancingKey.IsValid())
+	{
+		UAGX_TrimeshShapeComponent* Prototype = Cast<UAGX_TrimeshShapeComponent>(
+			Simulation->FindInstancedShapePrototype(InstancingKey));
+		if (Prototype != nullptr && Prototype->HasNative())
+		{
+			PreparedCollisionData.Reset();
+			NativeBarrier.AllocateNativeShared(Prototype->NativeBarrier);
+			UpdateNativeProperties();
+			return;
+		}
+	}
+
 	TArray<FVector> Vertices;
 	TArray<FTriIndices> Indices;
-	if (GetStaticMeshCollisionData(Vertices, Indices))
+	if (PreparedCollisionData.IsValid() && PreparedCollisionData->bValid)
+	{
+		Vertices = MoveTemp(PreparedCollisionData->Vertices);
+		Indices = MoveTemp(PreparedCollisionData->Indices);
+		PreparedCollisionData.Reset();
+		NativeBarrier.AllocateNative(Vertices, Indices, /*bClockwise*/ false, GetName());
+	}
+	else if (GetStaticMeshCollisionData(Vertices, Indices))
 	{
 		NativeBarrier.AllocateNative(Vertices, Indices, /*bClockwise*/ false, GetName());
 	}
@@ -342,9 +528,79 @@ void UAGX_TrimeshShapeComponent::CreateNative()
 		NativeBarrier.AllocateNative({}, {}, /*bClockwise*/ false, GetName());
 	}
 
+	if (InstancingKey.IsValid() && Vertices.Num() > 0)
+	{
+		Simulation->RegisterInstancedShapePrototype(InstancingKey, *this);
+	}
+
 	UpdateNativeProperties();
 }
 
+FAGX_ShapeInstancingKey UAGX_TrimeshShapeComponent::GetInstancingKey() const
+{
+	FAGX_ShapeInstancingKey Key;
+	const FAGX_MeshWithTransform Mesh = FindMeshSource();
+	if (!Mesh.IsValid())
+	{
+		return Key;
+	}
+
+	// The collision data depends on the mesh, the LOD, the preprocessing and the placement of the
+	// mesh relative to this component, since scale and offset are baked into the vertices.
+	const UStaticMesh& StaticMesh = *Mesh.Mesh.Get();
+	const FTransform ComponentTransformNoScale =
+		FTransform(GetComponentRotation(), GetComponentLocation());
+	Key.Source = &StaticMesh;
+	Key.LodIndex = static_cast<int32>(AGX_MeshUtilities::GetCollisionLodIndex(
+		StaticMesh, bOverrideMeshSourceLodIndex ? &MeshSourceLodIndex : nullptr));
+	Key.RelativeTransform = Mesh.Transform.GetRelativeTransform(ComponentTransformNoScale);
+	Key.Preprocessing = MeshPreprocessing;
+	return Key;
+}
+
+bool UAGX_TrimeshShapeComponent::CreateNativeConvexDecomposition()
+{
+	const FAGX_MeshWithTransform Mesh = FindMeshSource();
+	if (!Mesh.IsValid())
+		return false;
+
+	const FTransform ComponentTransformNoScale =
+		FTransform(GetComponentRotation(), GetComponentLocation());
+
+	TArray<TArray<FVector>> HullVertices;
+	TArray<TArray<FTriIndices>> HullIndices;
+	const UStaticMesh& StaticMesh = *Mesh.Mesh.Get();
+	const uint32 LodIndex = AGX_MeshUtilities::GetCollisionLodIndex(
+		StaticMesh, bOverrideMeshSourceLodIndex ? &MeshSourceLodIndex : nullptr);
+	const FAGX_ConvexDecompositionData* Decomposition =
+		CollisionDataAsset != nullptr
+			? CollisionDataAsset->FindConvexDecomposition(StaticMesh, LodIndex)
+			: nullptr;
+	if (Decomposition != nullptr)
+	{
+		// Same as for the triangle data, scale is baked into the vertex positions.
+		Decomposition->GetHulls(
+			Mesh.Transform.GetRelativeTransform(ComponentTransformNoScale), HullVertices,
+			HullIndices);
+	}
+	else if (!AGX_MeshUtilities::GetStaticMeshConvexHulls(
+				 Mesh, ComponentTransformNoScale, HullVertices, HullIndices))
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Trimesh Shape Component '%s' in '%s' has Collision Type Convex Decomposition but "
+				 "there is no up-to-date convex decomposition for its Static Mesh source and the "
+				 "Static Mesh has no convex simple collision. Falling back to a triangle mesh. Use "
+				 "Generate Convex Decomposition to create the convex shapes."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return false;
+	}
+
+	NativeBarrier.AllocateNativeConvexDecomposition(
+		HullVertices, HullIndices, /*bClockwise*/ false, GetName());
+	return true;
+}
+
 void UAGX_TrimeshShapeComponent::ReleaseNative()
 {
 	check(HasNative());
@@ -390,27 +646,29 @@ UMeshComponent* UAGX_TrimeshShapeComponent::FindMeshComponent(
 	return nullptr;
 }
 
-bool UAGX_TrimeshShapeComponent::GetStaticMeshCollisionData(
-	TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices) const
+FAGX_MeshWithTransform UAGX_TrimeshShapeComponent::FindMeshSource() const
 {
-	FAGX_MeshWithTransform Mesh;
-
 	switch (MeshSourceLocation)
 	{
 		case EAGX_StaticMeshSourceLocation::TSL_CHILD_STATIC_MESH_COMPONENT:
-			Mesh = AGX_MeshUtilities::FindFirstChildMesh(*this);
-			break;
+			return AGX_MeshUtilities::FindFirstChildMesh(*this);
 		case EAGX_StaticMeshSourceLocation::TSL_PARENT_STATIC_MESH_COMPONENT:
-			Mesh = AGX_MeshUtilities::FindFirstParentMesh(*this);
-			break;
+			return AGX_MeshUtilities::FindFirstParentMesh(*this);
 		case EAGX_StaticMeshSourceLocation::TSL_STATIC_MESH_ASSET:
 			if (MeshSourceAsset != nullptr)
 			{
-				Mesh = FAGX_MeshWithTransform(MeshSourceAsset, GetComponentTransform());
+				return FAGX_MeshWithTransform(MeshSourceAsset, GetComponentTransform());
 			}
 			break;
 	}
 
+	return FAGX_MeshWithTransform();
+}
+
+bool UAGX_TrimeshShapeComponent::GetStaticMeshCollisionData(
+	TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices) const
+{
+	const FAGX_MeshWithTransform Mesh = FindMeshSource();
 	if (!Mesh.IsValid())
 	{
 		UE_LOG(
@@ -420,10 +678,34 @@ bool UAGX_TrimeshShapeComponent::GetStaticMeshCollisionData(
 		return false;
 	}
 
+	// Final vertex positions are given relative to this component and any scale is baked into
+	// the positions, the same way as in AGX_MeshUtilities::GetStaticMeshCollisionData.
 	const FTransform ComponentTransformNoScale =
 		FTransform(GetComponentRotation(), GetComponentLocation());
-	const uint32* LodIndex = bOverrideMeshSourceLodIndex ? &MeshSourceLodIndex : nullptr;
+	const FTransform RelativeTransform =
+		Mesh.Transform.GetRelativeTransform(ComponentTransformNoScale);
+	const UStaticMesh& StaticMesh = *Mesh.Mesh.Get();
+	const uint32 LodIndex = AGX_MeshUtilities::GetCollisionLodIndex(
+		StaticMesh, bOverrideMeshSourceLodIndex ? &MeshSourceLodIndex : nullptr);
+
+	// Preprocessing is done in the Static Mesh's local coordinate system so that the cached
+	// triangle data, which is already preprocessed, can be used as-is for any placement.
+	if (bCacheCollisionData && CollisionDataAsset != nullptr)
+	{
+		if (const FAGX_TrimeshCollisionData* Cached =
+				CollisionDataAsset->FindTriangleData(StaticMesh, LodIndex, MeshPreprocessing))
+		{
+			AGX_MeshUtilities::TransformWeldedTriangleData(
+				Cached->Vertices, Cached->Indices, RelativeTransform, OutVertices, OutIndices);
+			return OutVertices.Num() > 0 && OutIndices.Num() > 0;
+		}
+	}
+
+	FAGX_TrimeshCollisionData Data;
+	if (!Data.Build(StaticMesh, LodIndex, MeshPreprocessing))
+		return false;
 
-	return AGX_MeshUtilities::GetStaticMeshCollisionData(
-		Mesh, ComponentTransformNoScale, OutVertices, OutIndices, LodIndex);
+	AGX_MeshUtilities::TransformWeldedTriangleData(
+		Data.Vertices, Data.Indices, RelativeTransform, OutVertices, OutIndices);
+	return OutVertices.Num() > 0 && OutIndices.Num() > 0;
 }
@@ -718,6 +718,13 @@ void AAGX_Terrain::BeginPlay()
 							UpdateDisplacementMap();
 						}
 					});
+
+		// The particle data is only needed once per frame, not once per step, and extracting it
+		// can run in parallel with other components.
+		Simulation->AddVisualSyncJob(
+			*this, [this]() { return PrepareParticlesUpdate(); },
+			[this]() { ExtractParticleData(); }, [this]() { ApplyParticleData(); });
+		bParticlesSyncedBySimulation = true;
 	}
 }
 
@@ -742,6 +749,14 @@ void AAGX_Terrain::EndPlay(const EEndPlayReason::Type Reason)
 		}
 	}
 
+	if (bParticlesSyncedBySimulation)
+	{
+		if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+			Simulation->RemoveVisualSyncJobs(*this);
+
+		bParticlesSyncedBySimulation = false;
+	}
+
 	if (HasNativeTerrainPager())
 	{
 		NativeTerrainPagerBarrier.ReleaseNative();
@@ -757,7 +772,7 @@ void AAGX_Terrain::Tick(float DeltaTime)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:AAGX_Terrain::Tick"));
 	Super::Tick(DeltaTime);
-	if (bEnableParticleRendering)
+	if (bEnableParticleRendering && !bParticlesSyncedBySimulation)
 	{
 		UpdateParticlesArrays();
 	}
@@ -1080,6 +1095,23 @@ void AAGX_Terrain::InitializeNative()
 	}
 }
 
+TFunction<void()> AAGX_Terrain::CreatePrepareHeightsTask()
+{
+	PreparedHeights.Reset();
+	if (HasNative() || bEnableTerrainPaging || SourceLandscape == nullptr)
+		return {};
+
+	TOptional<UAGX_HeightFieldBoundsComponent::FHeightFieldBoundsInfo> Bounds =
+		TerrainBounds->GetLandscapeAdjustedBounds();
+	if (!Bounds.IsSet())
+		return {};
+
+	const FVector StartPos = Bounds->Transform.TransformPositionNoScale(-Bounds->HalfExtent);
+	return AGX_HeightFieldUtilities::CreatePrepareHeightsTask(
+		*SourceLandscape, StartPos, Bounds->HalfExtent.X * 2.0, Bounds->HalfExtent.Y * 2.0,
+		PreparedHeights);
+}
+
 bool AAGX_Terrain::CreateNative()
 {
 	TOptional<UAGX_HeightFieldBoundsComponent::FHeightFieldBoundsInfo> Bounds =
@@ -1111,7 +1143,8 @@ bool AAGX_Terrain::CreateNative()
 		else
 		{
 			return AGX_HeightFieldUtilities::CreateHeightField(
-				*SourceLandscape, StartPos, Bounds->HalfExtent.X * 2.0, Bounds->HalfExtent.Y * 2.0);
+				*SourceLandscape, StartPos, Bounds->HalfExtent.X * 2.0, Bounds->HalfExtent.Y * 2.0,
+				PreparedHeights);
 		}
 	}();
 
@@ -1291,7 +1324,7 @@ void AAGX_Terrain::CreateNativeShovels()
 			UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
 			if (Simulation == nullptr)
 				return false;
-			return Simulation->GetNative()->Add(ShovelBarrier);
+			return Simulation->Add(ShovelBarrier);
 		}
 	};
 
@@ -1718,40 +1751,37 @@ bool AAGX_Terrain::InitializeParticleSystemComponent()
 
 void AAGX_Terrain::UpdateParticlesArrays()
 {
-	if (!NativeBarrier.HasNative())
-	{
-		return;
-	}
-	if (ParticleSystemComponent == nullptr)
-	{
+	if (!PrepareParticlesUpdate())
 		return;
-	}
+
+	ExtractParticleData();
+	ApplyParticleData();
+}
+
+bool AAGX_Terrain::PrepareParticlesUpdate() const
+{
+	return bEnableParticleRendering && NativeBarrier.HasNative() &&
+		   ParticleSystemComponent != nullptr;
+}
+
+void AAGX_Terrain::ExtractParticleData()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:AAGX_Terrain::ExtractParticleData"));
 
 	// Copy data with holes.
 	EParticleDataFlags ToInclude = EParticleDataFlags::Positions | EParticleDataFlags::Rotations |
 								   EParticleDataFlags::Radii | EParticleDataFlags::Velocities;
-	const FParticleDataById ParticleData =
-		bEnableTerrainPaging ? NativeTerrainPagerBarrier.GetParticleDataById(ToInclude)
+	StagedParticleData = bEnableTerrainPaging
+							 ? NativeTerrainPagerBarrier.GetParticleDataById(ToInclude)
 							 : NativeBarrier.GetParticleDataById(ToInclude);
 
-	const TArray<FVector>& Positions = ParticleData.Positions;
-	const TArray<FQuat>& Rotations = ParticleData.Rotations;
-	const TArray<float>& Radii = ParticleData.Radii;
-	const TArray<bool>& Exists = ParticleData.Exists;
-	const TArray<FVector>& Velocities = ParticleData.Velocities;
-
-#if UE_VERSION_OLDER_THAN(5, 3, 0)
-	ParticleSystemComponent->SetNiagaraVariableInt("User.Target Particle Count", Exists.Num());
-#else
-	ParticleSystemComponent->SetVariableInt(FName("User.Target Particle Count"), Exists.Num());
-#endif
-
+	const TArray<FVector>& Positions = StagedParticleData.Positions;
+	const TArray<FQuat>& Rotations = StagedParticleData.Rotations;
+	const TArray<float>& Radii = StagedParticleData.Radii;
 	const int32 NumParticles = Positions.Num();
 
-	TArray<FVector4> PositionsAndScale;
-	PositionsAndScale.SetNum(NumParticles);
-	TArray<FVector4> Orientations;
-	Orientations.SetNum(NumParticles);
+	StagedPositionsAndScale.SetNum(NumParticles);
+	StagedOrientations.SetNum(NumParticles);
 
 	for (int32 I = 0; I < NumParticles; ++I)
 	{
@@ -1761,18 +1791,33 @@ void AAGX_Terrain::UpdateParticlesArrays()
 		// 100x100x100 Unreal units. We multiply by 2.0 to convert from radius
 		// to full width.
 		float UnitCubeScale = (Radii[I] * 2.0f) / 100.0f;
-		PositionsAndScale[I] = FVector4(Positions[I], UnitCubeScale);
-		Orientations[I] = FVector4(Rotations[I].X, Rotations[I].Y, Rotations[I].Z, Rotations[I].W);
+		StagedPositionsAndScale[I] = FVector4(Positions[I], UnitCubeScale);
+		StagedOrientations[I] =
+			FVector4(Rotations[I].X, Rotations[I].Y, Rotations[I].Z, Rotations[I].W);
 	}
+}
+
+void AAGX_Terrain::ApplyParticleData()
+{
+	if (ParticleSystemComponent == nullptr)
+		return;
+
+	const TArray<bool>& Exists = StagedParticleData.Exists;
+
+#if UE_VERSION_OLDER_THAN(5, 3, 0)
+	ParticleSystemComponent->SetNiagaraVariableInt("User.Target Particle Count", Exists.Num());
+#else
+	ParticleSystemComponent->SetVariableInt(FName("User.Target Particle Count"), Exists.Num());
+#endif
 
 	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
-		ParticleSystemComponent, "Positions And Scales", PositionsAndScale);
+		ParticleSystemComponent, "Positions And Scales", StagedPositionsAndScale);
 	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
-		ParticleSystemComponent, "Orientations", Orientations);
+		ParticleSystemComponent, "Orientations", StagedOrientations);
 	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayBool(
 		ParticleSystemComponent, "Exists", Exists);
 	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(
-		ParticleSystemComponent, TEXT("Velocities"), Velocities);
+		ParticleSystemComponent, TEXT("Velocities"), StagedParticleData.Velocities);
 }
 
 void AAGX_Terrain::UpdateLandscapeMaterialParameters()
@@ -338,11 +338,32 @@ TArray<float> GetHeights(
 
 FHeightFieldShapeBarrier AGX_HeightFieldUtilities::CreateHeightField(
 	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY)
+{
+	TSharedPtr<FPreparedHeights, ESPMode::ThreadSafe> NoPrepared;
+	return CreateHeightField(Landscape, StartPos, LengthX, LengthY, NoPrepared);
+}
+
+FHeightFieldShapeBarrier AGX_HeightFieldUtilities::CreateHeightField(
+	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+	TSharedPtr<FPreparedHeights, ESPMode::ThreadSafe>& Prepared)
 {
 	const FVector LandscapeScale = Landscape.GetActorScale();
 
+	// The prepared heights are only used if they were read for the same region, the bounds may
+	// have been changed between preparation and native creation.
 	TArray<float> Heights;
-	Heights = GetHeights(Landscape, StartPos, LengthX, LengthY);
+	if (Prepared.IsValid() && Prepared->bValid && Prepared->StartPos.Equals(StartPos) &&
+		FMath::IsNearlyEqual(Prepared->LengthX, LengthX) &&
+		FMath::IsNearlyEqual(Prepared->LengthY, LengthY))
+	{
+		Heights = MoveTemp(Prepared->Heights);
+	}
+	else
+	{
+		Heights = GetHeights(Landscape, StartPos, LengthX, LengthY);
+	}
+	Prepared.Reset();
+
 	const auto QuadSideSize = LandscapeScale.X;
 	if (!FMath::IsNearlyEqual(LandscapeScale.X, LandscapeScale.Y))
 	{
@@ -371,6 +392,25 @@ FHeightFieldShapeBarrier AGX_HeightFieldUtilities::CreateHeightField(
 	return HeightField;
 }
 
+TFunction<void()> AGX_HeightFieldUtilities::CreatePrepareHeightsTask(
+	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+	TSharedPtr<FPreparedHeights, ESPMode::ThreadSafe>& OutPrepared)
+{
+	OutPrepared = MakeShared<FPreparedHeights, ESPMode::ThreadSafe>();
+	OutPrepared->StartPos = StartPos;
+	OutPrepared->LengthX = LengthX;
+	OutPrepared->LengthY = LengthY;
+
+	// Reading the heights only queries the Landscape's collision, which is safe from any thread
+	// while the Landscape isn't modified.
+	return [Result = OutPrepared, LandscapePtr = &Landscape]()
+	{
+		Result->Heights =
+			GetHeights(*LandscapePtr, Result->StartPos, Result->LengthX, Result->LengthY);
+		Result->bValid = true;
+	};
+}
+
 std::tuple<int32, int32> AGX_HeightFieldUtilities::GetLandscapeNumberOfVertsXY(
 	const ALandscape& Landscape)
 {
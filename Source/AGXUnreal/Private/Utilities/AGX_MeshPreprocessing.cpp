@@ -0,0 +1,692 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Utilities/AGX_MeshPreprocessing.h"
+
+// AGX Dynamics for Unreal includes.
+#include "Shapes/AGX_MeshPreprocessingSettings.h"
+
+// Unreal Engine includes.
+#include "Async/ParallelFor.h"
+
+namespace AGX_MeshPreprocessing_helpers
+{
+	int32& GetCorner(FTriIndices& Triangle, int32 Corner)
+	{
+		switch (Corner)
+		{
+			case 0:
+				return Triangle.v0;
+			case 1:
+				return Triangle.v1;
+			default:
+				return Triangle.v2;
+		}
+	}
+
+	int32 GetCorner(const FTriIndices& Triangle, int32 Corner)
+	{
+		return GetCorner(const_cast<FTriIndices&>(Triangle), Corner);
+	}
+
+	bool HasRepeatedCorner(const FTriIndices& Triangle)
+	{
+		return Triangle.v0 == Triangle.v1 || Triangle.v1 == Triangle.v2 ||
+			   Triangle.v2 == Triangle.v0;
+	}
+
+	bool Contains(const FTriIndices& Triangle, int32 Vertex)
+	{
+		return Triangle.v0 == Vertex || Triangle.v1 == Vertex || Triangle.v2 == Vertex;
+	}
+
+	FVector GetAreaVector(const FVector& A, const FVector& B, const FVector& C)
+	{
+		// Length is twice the triangle area.
+		return FVector::CrossProduct(B - A, C - A);
+	}
+
+	FInt64Vector ToCell(const FVector& Position, double InvCellSize)
+	{
+		// Clamp so that a tiny tolerance, i.e. a huge InvCellSize, cannot overflow the conversion
+		// or the neighbor cell lookup. Vertices that far out all end up in the outermost cells,
+		// which is only slower, not wrong, since distances are always checked.
+		constexpr double MaxCell = static_cast<double>(1ll << 60);
+		auto ToCoordinate = [InvCellSize](double Value)
+		{ return FMath::FloorToInt64(FMath::Clamp(Value * InvCellSize, -MaxCell, MaxCell)); };
+
+		return FInt64Vector(
+			ToCoordinate(Position.X), ToCoordinate(Position.Y), ToCoordinate(Position.Z));
+	}
+
+	/**
+	 * Plane-distance error quadric, a symmetric 4x4 matrix stored as its upper triangle:
+	 * [a2, ab, ac, ad, b2, bc, bd, c2, cd, d2].
+	 */
+	struct FQuadric
+	{
+		double Q[10] {};
+
+		static FQuadric FromPlane(const FVector& Normal, double D, double Weight)
+		{
+			const double A = Normal.X;
+			const double B = Normal.Y;
+			const double C = Normal.Z;
+			FQuadric Result;
+			Result.Q[0] = Weight * A * A;
+			Result.Q[1] = Weight * A * B;
+			Result.Q[2] = Weight * A * C;
+			Result.Q[3] = Weight * A * D;
+			Result.Q[4] = Weight * B * B;
+			Result.Q[5] = Weight * B * C;
+			Result.Q[6] = Weight * B * D;
+			Result.Q[7] = Weight * C * C;
+			Result.Q[8] = Weight * C * D;
+			Result.Q[9] = Weight * D * D;
+			return Result;
+		}
+
+		FQuadric& operator+=(const FQuadric& Other)
+		{
+			for (int32 I = 0; I < 10; ++I)
+				Q[I] += Other.Q[I];
+			return *this;
+		}
+
+		FQuadric operator+(const FQuadric& Other) const
+		{
+			FQuadric Result = *this;
+			Result += Other;
+			return Result;
+		}
+
+		double Evaluate(const FVector& P) const
+		{
+			const double X = P.X;
+			const double Y = P.Y;
+			const double Z = P.Z;
+			return Q[0] * X * X + 2.0 * Q[1] * X * Y + 2.0 * Q[2] * X * Z + 2.0 * Q[3] * X +
+				   Q[4] * Y * Y + 2.0 * Q[5] * Y * Z + 2.0 * Q[6] * Y + Q[7] * Z * Z +
+				   2.0 * Q[8] * Z + Q[9];
+		}
+
+		/// Find the position with the smallest error, if the quadric is not singular.
+		bool Minimize(FVector& OutPosition) const
+		{
+			// Solve [a2 ab ac; ab b2 bc; ac bc c2] * P = -[ad bd cd] with Cramer's rule.
+			const double M00 = Q[0], M01 = Q[1], M02 = Q[2];
+			const double M11 = Q[4], M12 = Q[5];
+			const double M22 = Q[7];
+			const double R0 = -Q[3], R1 = -Q[6], R2 = -Q[8];
+
+			const double Det = M00 * (M11 * M22 - M12 * M12) - M01 * (M01 * M22 - M12 * M02) +
+							   M02 * (M01 * M12 - M11 * M02);
+			if (FMath::Abs(Det) < UE_DOUBLE_KINDA_SMALL_NUMBER)
+				return false;
+
+			const double DetX = R0 * (M11 * M22 - M12 * M12) - M01 * (R1 * M22 - M12 * R2) +
+								M02 * (R1 * M12 - M11 * R2);
+			const double DetY = M00 * (R1 * M22 - M12 * R2) - R0 * (M01 * M22 - M12 * M02) +
+								M02 * (M01 * R2 - R1 * M02);
+			const double DetZ = M00 * (M11 * R2 - R1 * M12) - M01 * (M01 * R2 - R1 * M02) +
+								R0 * (M01 * M12 - M11 * M02);
+			OutPosition = FVector(DetX / Det, DetY / Det, DetZ / Det);
+			return true;
+		}
+	};
+
+	struct FCollapse
+	{
+		double Cost;
+		FVector Target;
+		int32 Keep;
+		int32 Remove;
+		uint32 KeepStamp;
+		uint32 RemoveStamp;
+	};
+
+	struct FCollapseLess
+	{
+		bool operator()(const FCollapse& A, const FCollapse& B) const
+		{
+			return A.Cost < B.Cost;
+		}
+	};
+
+	FCollapse MakeCollapse(
+		int32 V0, int32 V1, const TArray<FVector>& Positions, const TArray<FQuadric>& Quadrics,
+		const TArray<uint32>& Stamps)
+	{
+		const FQuadric Q = Quadrics[V0] + Quadrics[V1];
+
+		// Prefer the optimal position, but fall back to the best of the end points and the
+		// midpoint when the quadric is singular, e.g. for flat regions.
+		FVector Target;
+		double Cost;
+		if (Q.Minimize(Target))
+		{
+			Cost = Q.Evaluate(Target);
+		}
+		else
+		{
+			const FVector Candidates[] = {
+				Positions[V0], Positions[V1], (Positions[V0] + Positions[V1]) * 0.5};
+			Target = Candidates[0];
+			Cost = Q.Evaluate(Target);
+			for (const FVector& Candidate : Candidates)
+			{
+				const double CandidateCost = Q.Evaluate(Candidate);
+				if (CandidateCost < Cost)
+				{
+					Cost = CandidateCost;
+					Target = Candidate;
+				}
+			}
+		}
+
+		return {FMath::Max(Cost, 0.0), Target, V0, V1, Stamps[V0], Stamps[V1]};
+	}
+
+	// The smallest allowed cosine of the angle a triangle normal may rotate by in a collapse.
+	constexpr double MinNormalCosine = 0.2;
+
+	/**
+	 * Check that moving Vertex to Target doesn't flip or collapse any of the triangles around it,
+	 * other than those that are removed by the collapse since they also contain Other.
+	 */
+	bool IsCollapseValid(
+		int32 Vertex, int32 Other, const FVector& Target, const TArray<FVector>& Positions,
+		const TArray<FTriIndices>& Triangles, const TArray<bool>& TriangleRemoved,
+		const TArray<int32>& VertexTriangles)
+	{
+		for (int32 TriangleIndex : VertexTriangles)
+		{
+			if (TriangleRemoved[TriangleIndex])
+				continue;
+
+			const FTriIndices& Triangle = Triangles[TriangleIndex];
+			if (Contains(Triangle, Other))
+				continue;
+
+			FVector Corners[3];
+			FVector MovedCorners[3];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 CornerVertex = GetCorner(Triangle, Corner);
+				Corners[Corner] = Positions[CornerVertex];
+				MovedCorners[Corner] = CornerVertex == Vertex ? Target : Positions[CornerVertex];
+			}
+
+			const FVector Before =
+				GetAreaVector(Corners[0], Corners[1], Corners[2]).GetSafeNormal();
+			const FVector After =
+				GetAreaVector(MovedCorners[0], MovedCorners[1], MovedCorners[2]).GetSafeNormal();
+			if (After.IsZero() || FVector::DotProduct(Before, After) < MinNormalCosine)
+				return false;
+		}
+
+		return true;
+	}
+
+	// A vertex sharing a triangle with some other vertex, and the number of such triangles.
+	struct FRingVertex
+	{
+		int32 Vertex;
+		int32 NumTriangles;
+	};
+
+	void GetOneRing(
+		int32 Vertex, const TArray<FTriIndices>& Triangles, const TArray<bool>& TriangleRemoved,
+		const TArray<int32>& VertexTriangles, TArray<FRingVertex>& OutRing)
+	{
+		OutRing.Reset();
+		for (int32 TriangleIndex : VertexTriangles)
+		{
+			if (TriangleRemoved[TriangleIndex])
+				continue;
+
+			const FTriIndices& Triangle = Triangles[TriangleIndex];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 CornerVertex = GetCorner(Triangle, Corner);
+				if (CornerVertex == Vertex)
+					continue;
+
+				FRingVertex* Existing = OutRing.FindByPredicate(
+					[CornerVertex](const FRingVertex& R) { return R.Vertex == CornerVertex; });
+				if (Existing != nullptr)
+					++Existing->NumTriangles;
+				else
+					OutRing.Add({CornerVertex, 1});
+			}
+		}
+	}
+
+	bool HasBoundaryEdge(const TArray<FRingVertex>& Ring)
+	{
+		return Ring.ContainsByPredicate([](const FRingVertex& R) { return R.NumTriangles == 1; });
+	}
+
+	/**
+	 * Check that collapsing the edge between Keep and Remove preserves the topology of the mesh.
+	 * The edge must be shared by at most two triangles, the only vertices connected to both end
+	 * points must be the ones opposite the edge in those triangles, the link condition, and an
+	 * interior edge between two boundary vertices must not be collapsed since that would pinch
+	 * the mesh.
+	 */
+	bool IsCollapseManifold(
+		int32 Keep, int32 Remove, const TArray<FTriIndices>& Triangles,
+		const TArray<bool>& TriangleRemoved, const TArray<TArray<int32>>& VertexTriangles,
+		TArray<FRingVertex>& KeepRing, TArray<FRingVertex>& RemoveRing)
+	{
+		GetOneRing(Keep, Triangles, TriangleRemoved, VertexTriangles[Keep], KeepRing);
+		GetOneRing(Remove, Triangles, TriangleRemoved, VertexTriangles[Remove], RemoveRing);
+
+		const FRingVertex* Edge =
+			KeepRing.FindByPredicate([Remove](const FRingVertex& R) { return R.Vertex == Remove; });
+		if (Edge == nullptr || Edge->NumTriangles > 2)
+			return false;
+
+		int32 NumShared = 0;
+		for (const FRingVertex& R : KeepRing)
+		{
+			if (R.Vertex != Remove &&
+				RemoveRing.ContainsByPredicate([&R](const FRingVertex& Other)
+											   { return Other.Vertex == R.Vertex; }))
+			{
+				++NumShared;
+			}
+		}
+
+		// Every triangle on the edge contributes one opposite vertex, which is connected to both
+		// end points. Any other shared neighbor would be merged into a non-manifold edge.
+		if (NumShared != Edge->NumTriangles)
+			return false;
+
+		const bool bBoundaryEdge = Edge->NumTriangles == 1;
+		return bBoundaryEdge || !HasBoundaryEdge(KeepRing) || !HasBoundaryEdge(RemoveRing);
+	}
+}
+
+void AGX_MeshPreprocessing::Process(
+	TArray<FVector>& Vertices, TArray<FTriIndices>& Indices,
+	const FAGX_MeshPreprocessingSettings& Settings)
+{
+	if (!Settings.IsEnabled())
+		return;
+
+	if (Settings.bWeldVertices)
+		WeldVertices(Vertices, Indices, Settings.WeldTolerance);
+
+	// Welding can make triangles reference the same vertex more than once. Those are always
+	// removed, while the area test is only done when explicitly asked for. A negative area
+	// tolerance accepts all triangles with three distinct corners.
+	if (Settings.bWeldVertices || Settings.bRemoveDegenerateTriangles)
+	{
+		RemoveDegenerateTriangles(
+			Vertices, Indices,
+			Settings.bRemoveDegenerateTriangles ? UE_DOUBLE_SMALL_NUMBER : -1.0);
+	}
+
+	if (Settings.bDecimate)
+		Decimate(Vertices, Indices, Settings.TargetTriangleCount);
+
+	RemoveUnusedVertices(Vertices, Indices);
+}
+
+void AGX_MeshPreprocessing::Process(
+	TArray<FVector3f>& Vertices, TArray<uint32>& Indices,
+	const FAGX_MeshPreprocessingSettings& Settings)
+{
+	if (!Settings.IsEnabled())
+		return;
+
+	TArray<FVector> ProcessVertices;
+	ProcessVertices.Reserve(Vertices.Num());
+	for (const FVector3f& Vertex : Vertices)
+		ProcessVertices.Add(FVector(Vertex));
+
+	TArray<FTriIndices> ProcessIndices;
+	ProcessIndices.Reserve(Indices.Num() / 3);
+	for (int32 I = 0; I + 2 < Indices.Num(); I += 3)
+	{
+		FTriIndices Triangle;
+		Triangle.v0 = static_cast<int32>(Indices[I]);
+		Triangle.v1 = static_cast<int32>(Indices[I + 1]);
+		Triangle.v2 = static_cast<int32>(Indices[I + 2]);
+		ProcessIndices.Add(Triangle);
+	}
+
+	Process(ProcessVertices, ProcessIndices, Settings);
+
+	Vertices.Reset(ProcessVertices.Num());
+	for (const FVector& Vertex : ProcessVertices)
+		Vertices.Add(FVector3f(Vertex));
+
+	Indices.Reset(ProcessIndices.Num() * 3);
+	for (const FTriIndices& Triangle : ProcessIndices)
+	{
+		Indices.Add(static_cast<uint32>(Triangle.v0));
+		Indices.Add(static_cast<uint32>(Triangle.v1));
+		Indices.Add(static_cast<uint32>(Triangle.v2));
+	}
+}
+
+int32 AGX_MeshPreprocessing::WeldVertices(
+	TArray<FVector>& Vertices, TArray<FTriIndices>& Indices, double Tolerance)
+{
+	using namespace AGX_MeshPreprocessing_helpers;
+
+	const int32 NumVertices = Vertices.Num();
+	if (NumVertices == 0 || Tolerance <= 0.0)
+		return 0;
+
+	// With the cell size equal to the tolerance any vertex within tolerance of a given vertex is
+	// in the same or one of the 26 neighboring cells.
+	const double InvCellSize = 1.0 / Tolerance;
+	const double ToleranceSquared = Tolerance * Tolerance;
+
+	TArray<FInt64Vector> Cells;
+	Cells.SetNumUninitialized(NumVertices);
+	ParallelFor(
+		NumVertices, [&](int32 I) { Cells[I] = ToCell(Vertices[I], InvCellSize); });
+
+	// Welding itself is sequential so that the result doesn't depend on thread scheduling.
+	TMap<FInt64Vector, TArray<int32, TInlineAllocator<2>>> Grid;
+	Grid.Reserve(NumVertices);
+	TArray<FVector> Welded;
+	Welded.Reserve(NumVertices);
+	TArray<int32> Remap;
+	Remap.SetNumUninitialized(NumVertices);
+
+	auto FindMatch = [&](const FVector& Position, const FInt64Vector& Cell) -> int32
+	{
+		for (int64 Z = -1; Z <= 1; ++Z)
+		{
+			for (int64 Y = -1; Y <= 1; ++Y)
+			{
+				for (int64 X = -1; X <= 1; ++X)
+				{
+					const auto* Bucket = Grid.Find(Cell + FInt64Vector(X, Y, Z));
+					if (Bucket == nullptr)
+						continue;
+
+					for (int32 Candidate : *Bucket)
+					{
+						if (FVector::DistSquared(Welded[Candidate], Position) <= ToleranceSquared)
+							return Candidate;
+					}
+				}
+			}
+		}
+		return INDEX_NONE;
+	};
+
+	for (int32 I = 0; I < NumVertices; ++I)
+	{
+		int32 Match = FindMatch(Vertices[I], Cells[I]);
+		if (Match == INDEX_NONE)
+		{
+			Match = Welded.Add(Vertices[I]);
+			Grid.FindOrAdd(Cells[I]).Add(Match);
+		}
+		Remap[I] = Match;
+	}
+
+	ParallelFor(
+		Indices.Num(),
+		[&](int32 I)
+		{
+			FTriIndices& Triangle = Indices[I];
+			Triangle.v0 = Remap[Triangle.v0];
+			Triangle.v1 = Remap[Triangle.v1];
+			Triangle.v2 = Remap[Triangle.v2];
+		});
+
+	const int32 NumMerged = NumVertices - Welded.Num();
+	Vertices = MoveTemp(Welded);
+	return NumMerged;
+}
+
+int32 AGX_MeshPreprocessing::RemoveDegenerateTriangles(
+	const TArray<FVector>& Vertices, TArray<FTriIndices>& Indices, double AreaTolerance)
+{
+	using namespace AGX_MeshPreprocessing_helpers;
+
+	const int32 NumTriangles = Indices.Num();
+	TArray<bool> Keep;
+	Keep.SetNumUninitialized(NumTriangles);
+	ParallelFor(
+		NumTriangles,
+		[&](int32 I)
+		{
+			const FTriIndices& Triangle = Indices[I];
+			if (HasRepeatedCorner(Triangle))
+			{
+				Keep[I] = false;
+				return;
+			}
+
+			const double Area =
+				0.5 * GetAreaVector(
+						  Vertices[Triangle.v0], Vertices[Triangle.v1], Vertices[Triangle.v2])
+						  .Size();
+			Keep[I] = Area > AreaTolerance;
+		});
+
+	int32 NumKept = 0;
+	for (int32 I = 0; I < NumTriangles; ++I)
+	{
+		if (Keep[I])
+			Indices[NumKept++] = Indices[I];
+	}
+
+	Indices.SetNum(NumKept);
+	return NumTriangles - NumKept;
+}
+
+int32 AGX_MeshPreprocessing::Decimate(
+	TArray<FVector>& Vertices, TArray<FTriIndices>& Indices, int32 TargetTriangleCount)
+{
+	using namespace AGX_MeshPreprocessing_helpers;
+
+	const int32 NumTriangles = Indices.Num();
+	const int32 NumVertices = Vertices.Num();
+	TargetTriangleCount = FMath::Max(TargetTriangleCount, 1);
+	if (NumTriangles <= TargetTriangleCount)
+		return 0;
+
+	// Per-triangle plane quadrics, weighted by area so that small triangles don't dominate.
+	TArray<FQuadric> TriangleQuadrics;
+	TriangleQuadrics.SetNum(NumTriangles);
+	ParallelFor(
+		NumTriangles,
+		[&](int32 I)
+		{
+			const FTriIndices& Triangle = Indices[I];
+			const FVector& A = Vertices[Triangle.v0];
+			const FVector AreaVector =
+				GetAreaVector(A, Vertices[Triangle.v1], Vertices[Triangle.v2]);
+			const double DoubleArea = AreaVector.Size();
+			if (DoubleArea <= UE_DOUBLE_SMALL_NUMBER)
+				return;
+
+			const FVector Normal = AreaVector / DoubleArea;
+			TriangleQuadrics[I] =
+				FQuadric::FromPlane(Normal, -FVector::DotProduct(Normal, A), 0.5 * DoubleArea);
+		});
+
+	TArray<FQuadric> Quadrics;
+	Quadrics.SetNum(NumVertices);
+	TArray<TArray<int32>> VertexTriangles;
+	VertexTriangles.SetNum(NumVertices);
+	TSet<uint64> EdgeSet;
+	EdgeSet.Reserve(NumTriangles * 3 / 2);
+	for (int32 I = 0; I < NumTriangles; ++I)
+	{
+		const FTriIndices& Triangle = Indices[I];
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const int32 V0 = GetCorner(Triangle, Corner);
+			const int32 V1 = GetCorner(Triangle, (Corner + 1) % 3);
+			Quadrics[V0] += TriangleQuadrics[I];
+			VertexTriangles[V0].Add(I);
+			const uint64 Low = static_cast<uint64>(FMath::Min(V0, V1));
+			const uint64 High = static_cast<uint64>(FMath::Max(V0, V1));
+			EdgeSet.Add((Low << 32) | High);
+		}
+	}
+
+	TArray<uint32> Stamps;
+	Stamps.SetNumZeroed(NumVertices);
+	TArray<bool> VertexRemoved;
+	VertexRemoved.SetNumZeroed(NumVertices);
+	TArray<bool> TriangleRemoved;
+	TriangleRemoved.SetNumZeroed(NumTriangles);
+
+	const TArray<uint64> Edges = EdgeSet.Array();
+	TArray<FCollapse> Heap;
+	Heap.SetNumUninitialized(Edges.Num());
+	ParallelFor(
+		Edges.Num(),
+		[&](int32 I)
+		{
+			const int32 V0 = static_cast<int32>(Edges[I] >> 32);
+			const int32 V1 = static_cast<int32>(Edges[I] & 0xFFFFFFFF);
+			Heap[I] = MakeCollapse(V0, V1, Vertices, Quadrics, Stamps);
+		});
+	Heap.Heapify(FCollapseLess());
+
+	int32 NumLiveTriangles = NumTriangles;
+	TArray<int32> Neighbors;
+	TArray<FRingVertex> KeepRing;
+	TArray<FRingVertex> RemoveRing;
+	while (NumLiveTriangles > TargetTriangleCount && Heap.Num() > 0)
+	{
+		FCollapse Collapse;
+		Heap.HeapPop(Collapse, FCollapseLess());
+
+		const int32 Keep = Collapse.Keep;
+		const int32 Remove = Collapse.Remove;
+		if (VertexRemoved[Keep] || VertexRemoved[Remove] || Stamps[Keep] != Collapse.KeepStamp ||
+			Stamps[Remove] != Collapse.RemoveStamp)
+		{
+			// Outdated by an earlier collapse, a replacement has been pushed if still relevant.
+			continue;
+		}
+
+		if (!IsCollapseManifold(
+				Keep, Remove, Indices, TriangleRemoved, VertexTriangles, KeepRing, RemoveRing) ||
+			!IsCollapseValid(
+				Keep, Remove, Collapse.Target, Vertices, Indices, TriangleRemoved,
+				VertexTriangles[Keep]) ||
+			!IsCollapseValid(
+				Remove, Keep, Collapse.Target, Vertices, Indices, TriangleRemoved,
+				VertexTriangles[Remove]))
+		{
+			continue;
+		}
+
+		// Move Keep to the target position and let it take over all triangles of Remove, except
+		// those shared by both which become degenerate.
+		Vertices[Keep] = Collapse.Target;
+		Quadrics[Keep] += Quadrics[Remove];
+		VertexRemoved[Remove] = true;
+		for (int32 TriangleIndex : VertexTriangles[Remove])
+		{
+			if (TriangleRemoved[TriangleIndex])
+				continue;
+
+			FTriIndices& Triangle = Indices[TriangleIndex];
+			if (Contains(Triangle, Keep))
+			{
+				TriangleRemoved[TriangleIndex] = true;
+				--NumLiveTriangles;
+				continue;
+			}
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				int32& CornerVertex = GetCorner(Triangle, Corner);
+				if (CornerVertex == Remove)
+					CornerVertex = Keep;
+			}
+			VertexTriangles[Keep].Add(TriangleIndex);
+		}
+		VertexTriangles[Remove].Empty();
+		VertexTriangles[Keep].RemoveAllSwap(
+			[&TriangleRemoved](int32 TriangleIndex) { return TriangleRemoved[TriangleIndex]; });
+		++Stamps[Keep];
+		++Stamps[Remove];
+
+		// Re-evaluate all edges around the moved vertex.
+		Neighbors.Reset();
+		for (int32 TriangleIndex : VertexTriangles[Keep])
+		{
+			const FTriIndices& Triangle = Indices[TriangleIndex];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 CornerVertex = GetCorner(Triangle, Corner);
+				if (CornerVertex != Keep)
+					Neighbors.AddUnique(CornerVertex);
+			}
+		}
+		for (int32 Neighbor : Neighbors)
+		{
+			Heap.HeapPush(
+				MakeCollapse(Keep, Neighbor, Vertices, Quadrics, Stamps), FCollapseLess());
+		}
+	}
+
+	int32 NumKept = 0;
+	for (int32 I = 0; I < NumTriangles; ++I)
+	{
+		if (!TriangleRemoved[I])
+			Indices[NumKept++] = Indices[I];
+	}
+	Indices.SetNum(NumKept);
+
+	RemoveUnusedVertices(Vertices, Indices);
+	return NumTriangles - NumKept;
+}
+
+int32 AGX_MeshPreprocessing::RemoveUnusedVertices(
+	TArray<FVector>& Vertices, TArray<FTriIndices>& Indices)
+{
+	using namespace AGX_MeshPreprocessing_helpers;
+
+	const int32 NumVertices = Vertices.Num();
+	TArray<int32> Remap;
+	Remap.Init(INDEX_NONE, NumVertices);
+	for (const FTriIndices& Triangle : Indices)
+	{
+		Remap[Triangle.v0] = 0;
+		Remap[Triangle.v1] = 0;
+		Remap[Triangle.v2] = 0;
+	}
+
+	int32 NumKept = 0;
+	for (int32 I = 0; I < NumVertices; ++I)
+	{
+		if (Remap[I] == INDEX_NONE)
+			continue;
+
+		Remap[I] = NumKept;
+		Vertices[NumKept++] = Vertices[I];
+	}
+
+	if (NumKept == NumVertices)
+		return 0;
+
+	Vertices.SetNum(NumKept);
+	ParallelFor(
+		Indices.Num(),
+		[&](int32 I)
+		{
+			FTriIndices& Triangle = Indices[I];
+			Triangle.v0 = Remap[Triangle.v0];
+			Triangle.v1 = Remap[Triangle.v1];
+			Triangle.v2 = Remap[Triangle.v2];
+		});
+
+	return NumVertices - NumKept;
+}
@@ -9,6 +9,7 @@
 #include "Shapes/RenderDataBarrier.h"
 #include "Shapes/RenderMaterial.h"
 #include "Shapes/ShapeBarrier.h"
+#include "Utilities/AGX_MeshPreprocessing.h"
 #include "Utilities/AGX_ObjectUtilities.h"
 
 // Unreal Engine includes.
@@ -20,6 +21,7 @@
 #include "Misc/EngineVersionComparison.h"
 #include "PhysicsEngine/BodySetup.h"
 #if WITH_EDITOR
+#include "ConvexDecompTool.h"
 #include "RawMesh.h"
 #endif
 #include "Rendering/PositionVertexBuffer.h"
@@ -1885,8 +1887,8 @@ namespace AGX_MeshUtilities_helpers
 	}
 
 	static int32 AddCollisionVertex(
-		const FVector3f& VertexPosition, const FTransform& Transform,
-		TArray<FVector>& CollisionVertices, TMap<FVector3f, int32>& MeshToCollisionVertexIndices)
+		const FVector3f& VertexPosition, TArray<FVector3f>& CollisionVertices,
+		TMap<FVector3f, int32>& MeshToCollisionVertexIndices)
 	{
 		if (int32* CollisionVertexIndexPtr = MeshToCollisionVertexIndices.Find(VertexPosition))
 		{
@@ -1896,8 +1898,7 @@ namespace AGX_MeshUtilities_helpers
 		else
 		{
 			// Copy position from mesh to collision data.
-			int CollisionVertexIndex =
-				CollisionVertices.Add(Transform.TransformPosition(FromMeshVector(VertexPosition)));
+			int CollisionVertexIndex = CollisionVertices.Add(VertexPosition);
 
 			// Add collision index to map.
 			MeshToCollisionVertexIndices.Add(VertexPosition, CollisionVertexIndex);
@@ -1934,35 +1935,27 @@ namespace AGX_MeshUtilities_helpers
 #endif // WITH_EDITOR
 }
 
-bool AGX_MeshUtilities::GetStaticMeshCollisionData(
-	const FAGX_MeshWithTransform& InMesh, const FTransform& RelativeTo,
-	TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices, const uint32* LodIndexOverride)
+uint32 AGX_MeshUtilities::GetCollisionLodIndex(
+	const UStaticMesh& StaticMesh, const uint32* LodIndexOverride)
 {
-	if (!InMesh.IsValid())
-	{
-		return false;
-	}
+	return FMath::Clamp<int32>(
+		LodIndexOverride != nullptr ? *LodIndexOverride : StaticMesh.LODForCollision, 0,
+		StaticMesh.GetNumLODs() - 1);
+}
 
+bool AGX_MeshUtilities::GetStaticMeshWeldedTriangleData(
+	const UStaticMesh& StaticMesh, uint32 LodIndex, TArray<FVector3f>& OutVertices,
+	TArray<uint32>& OutIndices)
+{
 	// NOTE: Code below is very similar to UStaticMesh::GetPhysicsTriMeshData,
 	// only with some simplifications, so one can check that implementation for reference.
 	// One important difference is that we hash on vertex position instead of index because we
 	// want to re-merge vertices that has been split in the rendering data.
 
-	// Final vertex positions will be given relative to RelativeTo,
-	// and any scale needs to be baked into the positions, because AGX
-	// does not support scale.
-	const FTransform RelativeTransform = InMesh.Transform.GetRelativeTransform(RelativeTo);
-	const UStaticMesh& StaticMesh = *InMesh.Mesh.Get();
-
-	const uint32 LodIndex = FMath::Clamp<int32>(
-		LodIndexOverride != nullptr ? *LodIndexOverride : StaticMesh.LODForCollision, 0,
-		StaticMesh.GetNumLODs() - 1);
-
 	if (!StaticMesh.HasValidRenderData(/*bCheckLODForVerts*/ true, LodIndex))
 		return false;
 
 	const FStaticMeshLODResources& Mesh = StaticMesh.GetLODForExport(LodIndex);
-	TMap<FVector3f, int32> MeshToCollisionVertexIndices;
 
 	// Copy the Index and Vertex buffers from the mesh.
 	TArray<uint32> IndexBuffer;
@@ -2003,7 +1996,9 @@ bool AGX_MeshUtilities::GetStaticMeshCollisionData(
 	check(Mesh.VertexBuffers.PositionVertexBuffer.GetNumVertices() == VertexBuffer.Num());
 
 	// Merge vertices at the same location.
+	TMap<FVector3f, int32> MeshToCollisionVertexIndices;
 	const uint32 NumIndices = static_cast<uint32>(IndexBuffer.Num());
+	OutIndices.Reserve(OutIndices.Num() + NumIndices);
 	for (int32 SectionIndex = 0; SectionIndex < Mesh.Sections.Num(); ++SectionIndex)
 	{
 		const FStaticMeshSection& Section = Mesh.Sections[SectionIndex];
@@ -2016,28 +2011,322 @@ bool AGX_MeshUtilities::GetStaticMeshCollisionData(
 				break;
 			}
 
-			const uint32 IndexFirst = IndexBuffer[Index];
-			const uint32 IndexSecond = IndexBuffer[Index + 1];
-			const uint32 IndexThird = IndexBuffer[Index + 2];
-			FTriIndices Triangle;
-
-			Triangle.v0 = AGX_MeshUtilities_helpers::AddCollisionVertex(
-				VertexBuffer[IndexFirst], RelativeTransform, OutVertices,
-				MeshToCollisionVertexIndices);
-			Triangle.v1 = AGX_MeshUtilities_helpers::AddCollisionVertex(
-				VertexBuffer[IndexSecond], RelativeTransform, OutVertices,
-				MeshToCollisionVertexIndices);
-			Triangle.v2 = AGX_MeshUtilities_helpers::AddCollisionVertex(
-				VertexBuffer[IndexThird], RelativeTransform, OutVertices,
-				MeshToCollisionVertexIndices);
-
-			OutIndices.Add(Triangle);
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				OutIndices.Add(AGX_MeshUtilities_helpers::AddCollisionVertex(
+					VertexBuffer[IndexBuffer[Index + Corner]], OutVertices,
+					MeshToCollisionVertexIndices));
+			}
 		}
 	}
 
 	return OutVertices.Num() > 0 && OutIndices.Num() > 0;
 }
 
+void AGX_MeshUtilities::TransformWeldedTriangleData(
+	const TArray<FVector3f>& Vertices, const TArray<uint32>& Indices, const FTransform& Transform,
+	TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices)
+{
+	// The indices are relative to Vertices, offset them past any vertices already in OutVertices.
+	const int32 BaseIndex = OutVertices.Num();
+	OutVertices.Reserve(OutVertices.Num() + Vertices.Num());
+	for (const FVector3f& Vertex : Vertices)
+	{
+		OutVertices.Add(Transform.TransformPosition(FromMeshVector(Vertex)));
+	}
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	OutIndices.Reserve(OutIndices.Num() + NumTriangles);
+	for (int32 I = 0; I < NumTriangles; ++I)
+	{
+		FTriIndices Triangle;
+		Triangle.v0 = BaseIndex + static_cast<int32>(Indices[I * 3]);
+		Triangle.v1 = BaseIndex + static_cast<int32>(Indices[I * 3 + 1]);
+		Triangle.v2 = BaseIndex + static_cast<int32>(Indices[I * 3 + 2]);
+		OutIndices.Add(Triangle);
+	}
+}
+
+bool AGX_MeshUtilities::GetStaticMeshCollisionData(
+	const FAGX_MeshWithTransform& InMesh, const FTransform& RelativeTo,
+	TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices, const uint32* LodIndexOverride)
+{
+	if (!InMesh.IsValid())
+	{
+		return false;
+	}
+
+	// Final vertex positions will be given relative to RelativeTo,
+	// and any scale needs to be baked into the positions, because AGX
+	// does not support scale.
+	const FTransform RelativeTransform = InMesh.Transform.GetRelativeTransform(RelativeTo);
+	const UStaticMesh& StaticMesh = *InMesh.Mesh.Get();
+	const uint32 LodIndex = GetCollisionLodIndex(StaticMesh, LodIndexOverride);
+
+	TArray<FVector3f> WeldedVertices;
+	TArray<uint32> WeldedIndices;
+	if (!GetStaticMeshWeldedTriangleData(StaticMesh, LodIndex, WeldedVertices, WeldedIndices))
+	{
+		return false;
+	}
+
+	TransformWeldedTriangleData(
+		WeldedVertices, WeldedIndices, RelativeTransform, OutVertices, OutIndices);
+
+	return OutVertices.Num() > 0 && OutIndices.Num() > 0;
+}
+
+namespace AGX_MeshUtilities_helpers
+{
+	// Unreal Engine computes the front face normal of the triangle A, B, C as (C - A) x (B - A).
+	FVector GetFrontFaceNormal(const FVector& A, const FVector& B, const FVector& C)
+	{
+		return FVector::CrossProduct(C - A, B - A);
+	}
+
+	void AppendConvexHull(
+		const FKConvexElem& Hull, const FTransform& Transform,
+		TArray<TArray<FVector>>& OutVertices, TArray<TArray<FTriIndices>>& OutIndices)
+	{
+		const FTransform HullTransform = Hull.GetTransform() * Transform;
+
+		TArray<FVector> Vertices;
+		Vertices.Reserve(Hull.VertexData.Num());
+		for (const FVector& Vertex : Hull.VertexData)
+		{
+			Vertices.Add(HullTransform.TransformPosition(Vertex));
+		}
+
+		TArray<FTriIndices> Indices;
+		if (!AGX_MeshUtilities::TriangulateConvexHull(Vertices, Indices))
+			return;
+
+		OutVertices.Add(MoveTemp(Vertices));
+		OutIndices.Add(MoveTemp(Indices));
+	}
+}
+
+bool AGX_MeshUtilities::GetStaticMeshConvexHulls(
+	const FAGX_MeshWithTransform& InMesh, const FTransform& RelativeTo,
+	TArray<TArray<FVector>>& OutVertices, TArray<TArray<FTriIndices>>& OutIndices)
+{
+	if (!InMesh.IsValid())
+	{
+		return false;
+	}
+
+	const UBodySetup* BodySetup = InMesh.Mesh->GetBodySetup();
+	if (BodySetup == nullptr)
+	{
+		return false;
+	}
+
+	// Same as in GetStaticMeshCollisionData, scale is baked into the vertex positions.
+	const FTransform RelativeTransform = InMesh.Transform.GetRelativeTransform(RelativeTo);
+
+	for (const FKConvexElem& Hull : BodySetup->AggGeom.ConvexElems)
+	{
+		AGX_MeshUtilities_helpers::AppendConvexHull(
+			Hull, RelativeTransform, OutVertices, OutIndices);
+	}
+
+	return OutVertices.Num() > 0;
+}
+
+bool AGX_MeshUtilities::TriangulateConvexHull(
+	TArray<FVector>& Vertices, TArray<FTriIndices>& OutIndices)
+{
+	using namespace AGX_MeshUtilities_helpers;
+
+	OutIndices.Reset();
+	const int32 NumPoints = Vertices.Num();
+	if (NumPoints < 4)
+		return false;
+
+	// Incremental convex hull. Points closer to a face than Epsilon are considered on the face.
+	const FBox Bounds(Vertices);
+	const double Epsilon = FMath::Max(Bounds.GetSize().GetMax(), 1.0) * 1.0e-7;
+
+	// Initial tetrahedron from points that are far apart.
+	int32 I0 = 0;
+	for (int32 I = 1; I < NumPoints; ++I)
+	{
+		if (Vertices[I].X < Vertices[I0].X)
+			I0 = I;
+	}
+
+	auto FindFarthest = [&](TFunctionRef<double(const FVector&)> Distance, double& OutDistance)
+	{
+		int32 Farthest = INDEX_NONE;
+		OutDistance = 0.0;
+		for (int32 I = 0; I < NumPoints; ++I)
+		{
+			const double D = Distance(Vertices[I]);
+			if (D > OutDistance)
+			{
+				OutDistance = D;
+				Farthest = I;
+			}
+		}
+		return Farthest;
+	};
+
+	double Distance;
+	const int32 I1 =
+		FindFarthest([&](const FVector& P) { return FVector::Dist(P, Vertices[I0]); }, Distance);
+	if (Distance <= Epsilon)
+		return false;
+
+	const FVector Axis = (Vertices[I1] - Vertices[I0]).GetSafeNormal();
+	const int32 I2 = FindFarthest(
+		[&](const FVector& P)
+		{ return FVector::CrossProduct(P - Vertices[I0], Axis).Size(); },
+		Distance);
+	if (Distance <= Epsilon)
+		return false;
+
+	const FVector PlaneNormal =
+		FVector::CrossProduct(Vertices[I1] - Vertices[I0], Vertices[I2] - Vertices[I0])
+			.GetSafeNormal();
+	const int32 I3 = FindFarthest(
+		[&](const FVector& P)
+		{ return FMath::Abs(FVector::DotProduct(P - Vertices[I0], PlaneNormal)); },
+		Distance);
+	if (Distance <= Epsilon)
+		return false;
+
+	struct FFace
+	{
+		int32 A;
+		int32 B;
+		int32 C;
+		FVector Normal;
+		double Offset;
+
+		bool HasEdge(int32 From, int32 To) const
+		{
+			return (A == From && B == To) || (B == From && C == To) || (C == From && A == To);
+		}
+	};
+
+	auto MakeFace = [&Vertices](int32 A, int32 B, int32 C)
+	{
+		const FVector Normal =
+			GetFrontFaceNormal(Vertices[A], Vertices[B], Vertices[C]).GetSafeNormal();
+		return FFace {A, B, C, Normal, FVector::DotProduct(Normal, Vertices[A])};
+	};
+
+	auto DistanceAbove = [&Vertices](const FFace& Face, int32 Point)
+	{ return FVector::DotProduct(Face.Normal, Vertices[Point]) - Face.Offset; };
+
+	TArray<FFace> Faces;
+	auto AddOutwardFace = [&](int32 A, int32 B, int32 C, int32 Inside)
+	{
+		FFace Face = MakeFace(A, B, C);
+		if (DistanceAbove(Face, Inside) > 0.0)
+			Face = MakeFace(A, C, B);
+		Faces.Add(Face);
+	};
+	AddOutwardFace(I0, I1, I2, I3);
+	AddOutwardFace(I0, I1, I3, I2);
+	AddOutwardFace(I0, I2, I3, I1);
+	AddOutwardFace(I1, I2, I3, I0);
+
+	TArray<int32> Visible;
+	TArray<TPair<int32, int32>> Horizon;
+	for (int32 Point = 0; Point < NumPoints; ++Point)
+	{
+		if (Point == I0 || Point == I1 || Point == I2 || Point == I3)
+			continue;
+
+		Visible.Reset();
+		for (int32 FaceIndex = 0; FaceIndex < Faces.Num(); ++FaceIndex)
+		{
+			if (DistanceAbove(Faces[FaceIndex], Point) > Epsilon)
+				Visible.Add(FaceIndex);
+		}
+		if (Visible.Num() == 0)
+			continue; // Inside the current hull.
+
+		// The horizon is made up of the edges of visible faces whose neighbor isn't visible.
+		Horizon.Reset();
+		for (int32 FaceIndex : Visible)
+		{
+			const FFace& Face = Faces[FaceIndex];
+			const int32 Corners[] = {Face.A, Face.B, Face.C};
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 From = Corners[Corner];
+				const int32 To = Corners[(Corner + 1) % 3];
+				const bool bShared = Visible.ContainsByPredicate(
+					[&](int32 Other) { return Faces[Other].HasEdge(To, From); });
+				if (!bShared)
+					Horizon.Emplace(From, To);
+			}
+		}
+
+		for (int32 I = Visible.Num() - 1; I >= 0; --I)
+		{
+			Faces.RemoveAtSwap(Visible[I]);
+		}
+
+		// Keeping the direction of each horizon edge keeps the winding of the new faces outward.
+		for (const TPair<int32, int32>& Edge : Horizon)
+		{
+			Faces.Add(MakeFace(Edge.Key, Edge.Value, Point));
+		}
+	}
+
+	OutIndices.Reserve(Faces.Num());
+	for (const FFace& Face : Faces)
+	{
+		FTriIndices Triangle;
+		Triangle.v0 = Face.A;
+		Triangle.v1 = Face.B;
+		Triangle.v2 = Face.C;
+		OutIndices.Add(Triangle);
+	}
+
+	// Drop the points inside the hull.
+	AGX_MeshPreprocessing::RemoveUnusedVertices(Vertices, OutIndices);
+	return true;
+}
+
+#if WITH_EDITOR
+bool AGX_MeshUtilities::GenerateConvexDecomposition(
+	const UStaticMesh& StaticMesh, uint32 LodIndex, int32 MaxHulls, int32 MaxHullVertices,
+	int32 Resolution, TArray<TArray<FVector>>& OutVertices,
+	TArray<TArray<FTriIndices>>& OutIndices)
+{
+	TArray<FVector3f> Vertices;
+	TArray<uint32> Indices;
+	if (!GetStaticMeshWeldedTriangleData(StaticMesh, LodIndex, Vertices, Indices))
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Cannot generate convex decomposition for Static Mesh '%s' because its triangle "
+				 "data could not be read."),
+			*StaticMesh.GetName());
+		return false;
+	}
+
+	// The decomposition is written to a temporary Body Setup. The Static Mesh's own Body Setup,
+	// and thereby the collision of every user of the Static Mesh, is left untouched.
+	UBodySetup* BodySetup = NewObject<UBodySetup>(GetTransientPackage());
+	DecomposeMeshToHulls(
+		BodySetup, Vertices, Indices, static_cast<uint32>(FMath::Max(MaxHulls, 1)),
+		FMath::Max(MaxHullVertices, 4), static_cast<uint32>(FMath::Max(Resolution, 1)));
+
+	for (const FKConvexElem& Hull : BodySetup->AggGeom.ConvexElems)
+	{
+		AGX_MeshUtilities_helpers::AppendConvexHull(
+			Hull, FTransform::Identity, OutVertices, OutIndices);
+	}
+
+	return OutVertices.Num() > 0;
+}
+#endif
+
 TArray<FAGX_MeshWithTransform> AGX_MeshUtilities::ToMeshWithTransformArray(
 	const TArray<AStaticMeshActor*> Actors)
 {
@@ -7,6 +7,7 @@
 #include "ROS2/AGX_ROS2Messages.h"
 #include "Sensors/AGX_LidarOutputPosition.h"
 #include "Sensors/AGX_LidarOutputPositionIntensity.h"
+#include "Sensors/AGX_LidarPointCloudFrame.h"
 #include "Sensors/AGX_LidarScanPoint.h"
 
 // Standard library includes.
@@ -195,6 +196,46 @@ FAGX_SensorMsgsImage FAGX_ROS2Utilities::Convert(
 	return Msg;
 }
 
+FAGX_SensorMsgsPointCloud2 FAGX_ROS2Utilities::ConvertXYZ(
+	const FAGX_LidarPointCloudFrame& Frame, bool ROSCoordinates, const FString& FrameId)
+{
+	using namespace AGX_ROS2Utilities_helpers;
+	FAGX_SensorMsgsPointCloud2 Msg;
+	const int32 NumPoints = Frame.Num();
+	if (NumPoints == 0)
+		return Msg;
+
+	Msg.Header.Stamp = Convert(Frame.TimeStamp);
+	Msg.Header.FrameId = FrameId;
+	Msg.Fields.Add(MakePointField("x", 0, EAGX_PointFieldType::Float32, 1));
+	Msg.Fields.Add(MakePointField("y", 4, EAGX_PointFieldType::Float32, 1));
+	Msg.Fields.Add(MakePointField("z", 8, EAGX_PointFieldType::Float32, 1));
+	Msg.Fields.Add(MakePointField("intensity", 12, EAGX_PointFieldType::Float32, 1));
+
+	// The floats are written in the platform's native byte order, which the message declares.
+	Msg.IsBigendian = !PLATFORM_LITTLE_ENDIAN;
+	Msg.PointStep = 16;
+	Msg.IsDense = true;
+	Msg.Height = 1;
+	Msg.Width = NumPoints;
+	Msg.RowStep = NumPoints * Msg.PointStep;
+
+	const float Scale = ROSCoordinates ? static_cast<float>(CmToM(1.0)) : 1.f;
+	const float ScaleY = ROSCoordinates ? -Scale : Scale; // Flip Y for right handed coordinates.
+
+	Msg.Data.SetNumUninitialized(NumPoints * Msg.PointStep);
+	float* Out = reinterpret_cast<float*>(Msg.Data.GetData());
+	for (int32 I = 0; I < NumPoints; ++I)
+	{
+		Out[I * 4 + 0] = Frame.X[I] * Scale;
+		Out[I * 4 + 1] = Frame.Y[I] * ScaleY;
+		Out[I * 4 + 2] = Frame.Z[I] * Scale;
+		Out[I * 4 + 3] = Frame.Intensity[I];
+	}
+
+	return Msg;
+}
+
 FAGX_BuiltinInterfacesTime UAGX_ROS2Utilities::ConvertTime(double TimeStamp)
 {
 	return AGX_ROS2Utilities_helpers::Convert(TimeStamp);
@@ -223,6 +264,7 @@ FAGX_SensorMsgsPointCloud2 UAGX_ROS2Utilities::ConvertXYZ(
 	Msg.Fields.Add(MakePointField("z", 2 * ElementStep, FieldType, 1));
 	Msg.Fields.Add(MakePointField("intensity", 3 * ElementStep, FieldType, 1));
 
+	// AppendFloatToUint8Array and AppendDoubleToUint8Array write little endian on all platforms.
 	Msg.IsBigendian = false;
 	Msg.PointStep = 4 * ElementStep; // Bytes per point.
 	Msg.IsDense = true;
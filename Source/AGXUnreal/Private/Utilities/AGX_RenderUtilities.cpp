@@ -30,13 +30,20 @@
 // included as part of DataDrivenShaderPlatformInfo.h here.
 #include "DataDrivenShaderPlatformInfo.h"
 #endif
+#include "Camera/PlayerCameraManager.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "ConvexVolume.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
 #include "Materials/Material.h"
 #include "Misc/EngineVersionComparison.h"
 #include "RenderingThread.h"
 #include "RHI.h"
 #include "RHICommandList.h"
+#include "SceneManagement.h"
 #include "TextureResource.h"
 
 bool FAGX_RenderUtilities::UpdateRenderTextureRegions(
@@ -96,6 +103,47 @@ void FAGX_RenderUtilities::DrawContactPoints(
 	}
 }
 
+void FAGX_RenderUtilities::SetInstanceCount(UInstancedStaticMeshComponent& Component, int32 Num)
+{
+	Num = FMath::Max(0, Num);
+	const int32 CurrentNum = Component.GetInstanceCount();
+	if (CurrentNum < Num)
+	{
+		TArray<FTransform> NewInstances;
+		NewInstances.Init(FTransform::Identity, Num - CurrentNum);
+		Component.AddInstances(NewInstances, /*bShouldReturnIndices*/ false);
+	}
+	else if (Num == 0 && CurrentNum > 0)
+	{
+		Component.ClearInstances();
+	}
+	else if (CurrentNum > Num)
+	{
+		TArray<int32> RemovedInstances;
+		RemovedInstances.Reserve(CurrentNum - Num);
+		for (int32 I = CurrentNum - 1; I >= Num; --I)
+			RemovedInstances.Add(I);
+
+		Component.RemoveInstances(RemovedInstances);
+	}
+}
+
+bool FAGX_RenderUtilities::GetPlayerViewFrustum(const UWorld& World, FConvexVolume& OutFrustum)
+{
+	const APlayerController* Controller = World.GetFirstPlayerController();
+	if (Controller == nullptr || Controller->PlayerCameraManager == nullptr ||
+		World.ViewLocationsRenderedLastFrame.Num() > 1)
+	{
+		return false;
+	}
+
+	const FMinimalViewInfo ViewInfo = Controller->PlayerCameraManager->GetCameraCacheView();
+	FMatrix View, Projection, ViewProjection;
+	UGameplayStatics::GetViewProjectionMatrix(ViewInfo, View, Projection, ViewProjection);
+	GetViewFrustumBounds(OutFrustum, ViewProjection, /*bUseNearPlane*/ false);
+	return true;
+}
+
 TArray<FColor> UAGX_RenderUtilities::GetImagePixels8(UTextureRenderTarget2D* RenderTarget)
 {
 	if (RenderTarget == nullptr || RenderTarget->GetFormat() != EPixelFormat::PF_B8G8R8A8)
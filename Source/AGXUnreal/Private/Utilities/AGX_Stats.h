@@ -12,6 +12,7 @@
 DECLARE_STATS_GROUP(TEXT("AGX Unreal"), STATGROUP_AGXUnreal, STATCAT_Advanced);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("Step Time"), STAT_AGXU_StepTime, STATGROUP_AGXUnreal);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num. Steps"), STAT_AGXU_NumSteps, STATGROUP_AGXUnreal);
+DECLARE_CYCLE_STAT(TEXT("Spawn Instances"), STAT_AGXU_SpawnInstances, STATGROUP_AGXUnreal);
 
 // Timers read from AGX Dynamics, last step in a frame only. So timer spikes in non-last frames will
 // not be visible. Use the FRAME stats to detect those.
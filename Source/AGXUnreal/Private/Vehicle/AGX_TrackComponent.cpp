@@ -16,7 +16,9 @@
 #include "Utilities/AGX_ImportRuntimeUtilities.h"
 #include "Utilities/AGX_NotificationUtilities.h"
 #include "Utilities/AGX_ObjectUtilities.h"
+#include "Utilities/AGX_RenderUtilities.h"
 #include "Utilities/AGX_StringUtilities.h"
+#include "Vehicle/AGX_TrackFleetRenderer.h"
 #include "Vehicle/AGX_TrackInternalMergeProperties.h"
 #include "Vehicle/AGX_TrackProperties.h"
 #include "Vehicle/TrackPropertiesBarrier.h"
@@ -553,12 +555,39 @@ void UAGX_TrackComponent::BeginPlay()
 		CreateNative();
 		check(HasNative()); /// @todo Consider better error handling than check.
 	}
+
+	if (FleetRenderer != nullptr && HasNative())
+		FleetRenderer->Register(*this);
+
+	if (HasNative())
+	{
+		if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		{
+			// During Play the visuals are updated by the Simulation after each step, with the
+			// node transform computation running in parallel with other components.
+			Simulation->AddVisualSyncJob(
+				*this, [this]() { return PrepareVisualsUpdate(); },
+				[this]() { ExtractVisualTransforms(); }, [this]() { ApplyVisuals(); });
+			bVisualsSyncedBySimulation = true;
+		}
+	}
 }
 
 void UAGX_TrackComponent::EndPlay(const EEndPlayReason::Type Reason)
 {
 	Super::EndPlay(Reason);
 
+	if (FleetRenderer != nullptr)
+		FleetRenderer->Unregister(*this);
+
+	if (bVisualsSyncedBySimulation)
+	{
+		if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+			Simulation->RemoveVisualSyncJobs(*this);
+
+		bVisualsSyncedBySimulation = false;
+	}
+
 	if (GIsReconstructingBlueprintInstances)
 	{
 		// Another UAGX_TrackComponent will inherit this one's Native, so don't wreck it.
@@ -661,7 +690,8 @@ void UAGX_TrackComponent::TickComponent(
 	float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	UpdateVisuals();
+	if (!bVisualsSyncedBySimulation)
+		UpdateVisuals();
 }
 
 #if WITH_EDITOR
@@ -849,17 +879,7 @@ void UAGX_TrackComponent::CreateNative()
 	// because some properties in TrackProperties affects the track initialization algorithm.
 	WriteTrackPropertiesToNative();
 
-	// \todo Want to use AAGX_Simulation::Add, but there's no overload taking a Track Component
-	//       (or LinkedStructure or Assembly), so we use a work-around in the TrackBarrier.
-	const bool Result = GetNative()->AddToSimulation(*Sim->GetNative());
-	if (!Result)
-	{
-		UE_LOG(
-			LogAGX, Error,
-			TEXT("Failed to add '%s' in '%s' to Simulation. Add() returned false. "
-				 "The Log category AGXDynamicsLog may contain more information about the failure."),
-			*GetName(), *GetNameSafe(GetOwner()));
-	}
+	Sim->Add(*this);
 
 	UpdateNativeProperties();
 }
@@ -1081,13 +1101,22 @@ void UAGX_TrackComponent::CreateVisuals()
 }
 
 void UAGX_TrackComponent::UpdateVisuals()
+{
+	if (!PrepareVisualsUpdate())
+		return;
+
+	ExtractVisualTransforms();
+	ApplyVisuals();
+}
+
+bool UAGX_TrackComponent::PrepareVisualsUpdate()
 {
 	if (!ShouldRenderSelf())
 	{
 		if (VisualMeshes != nullptr && VisualMeshes->GetInstanceCount() > 0)
 			SetVisualsInstanceCount(0);
 
-		return;
+		return false;
 	}
 
 	{
@@ -1099,13 +1128,35 @@ void UAGX_TrackComponent::UpdateVisuals()
 		WriteRenderMaterialsToVisualMesh();
 	}
 
-	// Get the mesh instance transforms, either from the native if playing or
-	// from the preview data if not playing.
-	if (!ComputeNodeTransforms(NodeTransformsCache))
+	// Everything that reads the World, the preview data or the properties of this component is
+	// done here so that ExtractVisualTransforms only reads from the native.
+	const bool bIsPlaying = GetWorld() && GetWorld()->IsGameWorld();
+	bExtractNodeTransforms = bIsPlaying && HasNative();
+	if (bExtractNodeTransforms)
+	{
+		ComputeNativeVisualTransform(VisualScaleCache, VisualOffsetCache);
+		VisualRotationCache = Rotation.Quaternion();
+	}
+	else if (!ComputeNodeTransforms(NodeTransformsCache))
 	{
 		NodeTransformsCache.Empty(); // if failed, do not render anything.
 	}
 
+	return true;
+}
+
+void UAGX_TrackComponent::ExtractVisualTransforms()
+{
+	// The preview transforms are computed in PrepareVisualsUpdate, only the native is read here.
+	if (!bExtractNodeTransforms)
+		return;
+
+	GetNodeTransforms(
+		NodeTransformsCache, VisualScaleCache, VisualOffsetCache, VisualRotationCache);
+}
+
+void UAGX_TrackComponent::ApplyVisuals()
+{
 	// Make sure there is one mesh instance per track node.
 	const int32 NumNodes = NodeTransformsCache.Num();
 	SetVisualsInstanceCount(NumNodes);
@@ -1130,7 +1181,13 @@ void UAGX_TrackComponent::UpdateVisuals()
 
 bool UAGX_TrackComponent::ShouldRenderSelf() const
 {
-	return VisualMeshes != nullptr && ShouldRender();
+	return VisualMeshes != nullptr && ShouldRender() && !IsRenderedByFleet();
+}
+
+bool UAGX_TrackComponent::IsRenderedByFleet() const
+{
+	// The Fleet Renderer only renders during Play, the preview is always rendered by the track.
+	return FleetRenderer != nullptr && HasNative();
 }
 
 void UAGX_TrackComponent::SetVisualsInstanceCount(int32 Num)
@@ -1138,17 +1195,7 @@ void UAGX_TrackComponent::SetVisualsInstanceCount(int32 Num)
 	if (VisualMeshes == nullptr)
 		return;
 
-	Num = std::max(0, Num);
-
-	while (VisualMeshes->GetInstanceCount() < Num)
-	{
-		VisualMeshes->AddInstance(FTransform());
-	}
-
-	while (VisualMeshes->GetInstanceCount() > Num)
-	{
-		VisualMeshes->RemoveInstance(VisualMeshes->GetInstanceCount() - 1);
-	}
+	FAGX_RenderUtilities::SetInstanceCount(*VisualMeshes, Num);
 }
 
 bool UAGX_TrackComponent::ComputeNodeTransforms(TArray<FTransform>& OutTransforms)
@@ -1163,16 +1210,7 @@ bool UAGX_TrackComponent::ComputeNodeTransforms(TArray<FTransform>& OutTransform
 			return false;
 
 		FVector VisualScale, VisualOffset;
-		if (bAutoScaleAndOffset)
-		{
-			ComputeVisualScaleAndOffset(VisualScale, VisualOffset, GetNodeSize(0));
-		}
-		else
-		{
-			VisualScale = Scale;
-			VisualOffset = Offset;
-		}
-
+		ComputeNativeVisualTransform(VisualScale, VisualOffset);
 		GetNodeTransforms(OutTransforms, VisualScale, VisualOffset, Rotation.Quaternion());
 	}
 	else
@@ -1220,6 +1258,20 @@ bool UAGX_TrackComponent::ComputeNodeTransforms(TArray<FTransform>& OutTransform
 	return true;
 }
 
+void UAGX_TrackComponent::ComputeNativeVisualTransform(
+	FVector& OutVisualScale, FVector& OutVisualOffset) const
+{
+	if (bAutoScaleAndOffset)
+	{
+		ComputeVisualScaleAndOffset(OutVisualScale, OutVisualOffset, GetNodeSize(0));
+	}
+	else
+	{
+		OutVisualScale = Scale;
+		OutVisualOffset = Offset;
+	}
+}
+
 bool UAGX_TrackComponent::ComputeVisualScaleAndOffset(
 	FVector& OutVisualScale, FVector& OutVisualOffset, const FVector& PhysicsNodeSize) const
 {
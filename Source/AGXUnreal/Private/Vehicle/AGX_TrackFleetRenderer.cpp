@@ -0,0 +1,329 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Vehicle/AGX_TrackFleetRenderer.h"
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_RigidBodyComponent.h"
+#include "Utilities/AGX_RenderUtilities.h"
+#include "Vehicle/AGX_TrackComponent.h"
+#include "Vehicle/AGX_TrackWheel.h"
+
+// Unreal Engine includes.
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+
+AAGX_TrackFleetRenderer::AAGX_TrackFleetRenderer()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	// Read the node transforms after the simulation has been stepped.
+	PrimaryActorTick.TickGroup = TG_PostPhysics;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("DefaultSceneRoot"));
+}
+
+void AAGX_TrackFleetRenderer::Register(UAGX_TrackComponent& Track)
+{
+	for (const FAGX_TrackFleetBatch& Batch : Batches)
+	{
+		for (const FAGX_TrackFleetEntry& Entry : Batch.Tracks)
+		{
+			if (Entry.Track.Get() == &Track)
+				return;
+		}
+	}
+
+	FAGX_TrackFleetBatch& Batch = GetOrCreateBatch(Track);
+	FAGX_TrackFleetEntry& Entry = Batch.Tracks.AddDefaulted_GetRef();
+	Entry.Track = &Track;
+	Batch.bLayoutDirty = true;
+}
+
+void AAGX_TrackFleetRenderer::Unregister(UAGX_TrackComponent& Track)
+{
+	for (int32 I = 0; I < Batches.Num(); ++I)
+	{
+		FAGX_TrackFleetBatch& Batch = Batches[I];
+		const int32 NumRemoved = Batch.Tracks.RemoveAll(
+			[&Track](const FAGX_TrackFleetEntry& Entry) { return Entry.Track.Get() == &Track; });
+		if (NumRemoved == 0)
+			continue;
+
+		if (Batch.Tracks.IsEmpty())
+		{
+			if (Batch.Mesh != nullptr)
+				Batch.Mesh->DestroyComponent();
+
+			Batches.RemoveAt(I);
+		}
+		else
+		{
+			Batch.bLayoutDirty = true;
+		}
+
+		return;
+	}
+}
+
+int32 AAGX_TrackFleetRenderer::GetNumTracks() const
+{
+	int32 NumTracks = 0;
+	for (const FAGX_TrackFleetBatch& Batch : Batches)
+		NumTracks += Batch.Tracks.Num();
+
+	return NumTracks;
+}
+
+void AAGX_TrackFleetRenderer::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// Tracks that have changed Render Mesh or Render Materials since they were registered must
+	// move to another batch.
+	TArray<UAGX_TrackComponent*> MovedTracks;
+	for (const FAGX_TrackFleetBatch& Batch : Batches)
+	{
+		for (const FAGX_TrackFleetEntry& Entry : Batch.Tracks)
+		{
+			UAGX_TrackComponent* Track = Entry.Track.Get();
+			if (Track != nullptr &&
+				(Track->RenderMesh != Batch.RenderMesh ||
+				 Track->RenderMaterials != Batch.RenderMaterials))
+			{
+				MovedTracks.Add(Track);
+			}
+		}
+	}
+
+	for (UAGX_TrackComponent* Track : MovedTracks)
+	{
+		Unregister(*Track);
+		Register(*Track);
+	}
+
+	UpdateViews();
+	for (FAGX_TrackFleetBatch& Batch : Batches)
+		UpdateBatch(Batch);
+}
+
+void AAGX_TrackFleetRenderer::EndPlay(const EEndPlayReason::Type Reason)
+{
+	Super::EndPlay(Reason);
+
+	for (FAGX_TrackFleetBatch& Batch : Batches)
+	{
+		if (Batch.Mesh != nullptr)
+			Batch.Mesh->DestroyComponent();
+	}
+
+	Batches.Empty();
+}
+
+FAGX_TrackFleetBatch& AAGX_TrackFleetRenderer::GetOrCreateBatch(const UAGX_TrackComponent& Track)
+{
+	for (FAGX_TrackFleetBatch& Batch : Batches)
+	{
+		if (Batch.RenderMesh == Track.RenderMesh && Batch.RenderMaterials == Track.RenderMaterials)
+			return Batch;
+	}
+
+	FAGX_TrackFleetBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.RenderMesh = Track.RenderMesh;
+	Batch.RenderMaterials = Track.RenderMaterials;
+
+	const FName Name = MakeUniqueObjectName(
+		this, UHierarchicalInstancedStaticMeshComponent::StaticClass(),
+		FName(TEXT("TrackFleetMeshes")));
+	Batch.Mesh = NewObject<UHierarchicalInstancedStaticMeshComponent>(this, Name);
+	Batch.Mesh->SetCanEverAffectNavigation(false);
+	Batch.Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Batch.Mesh->RegisterComponent();
+	Batch.Mesh->AttachToComponent(
+		RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+	Batch.Mesh->SetStaticMesh(Batch.RenderMesh);
+	for (int32 I = 0; I < Batch.RenderMaterials.Num(); ++I)
+		Batch.Mesh->SetMaterial(I, Batch.RenderMaterials[I]);
+
+	return Batch;
+}
+
+namespace AGX_TrackFleetRenderer_helpers
+{
+	// The track wraps around its wheels, so the wheel bodies with a sphere around each that
+	// contains the wheel and the track around it bound the whole track. Resolving the Rigid Body
+	// references is a name lookup, so this is done when the layout changes and not every frame.
+	void CollectWheelBodies(
+		const UAGX_TrackComponent& Track,
+		TArray<TPair<TWeakObjectPtr<const UAGX_RigidBodyComponent>, double>>& OutWheelBodies)
+	{
+		OutWheelBodies.Reset();
+		for (const FAGX_TrackWheel& Wheel : Track.Wheels)
+		{
+			const UAGX_RigidBodyComponent* Body = Wheel.RigidBody.GetRigidBody();
+			if (Body == nullptr)
+				continue;
+
+			double Reach = Wheel.RelativeLocation.Size() + Wheel.Radius + Track.Thickness;
+			if (Wheel.bUseFrameDefiningComponent)
+			{
+				if (const USceneComponent* Frame = Wheel.FrameDefiningComponent.GetSceneComponent())
+				{
+					Reach += FVector::Distance(
+						Frame->GetComponentLocation(), Body->GetComponentLocation());
+				}
+			}
+
+			OutWheelBodies.Emplace(Body, Reach);
+		}
+	}
+}
+
+void AAGX_TrackFleetRenderer::UpdateLayout(FAGX_TrackFleetBatch& Batch)
+{
+	using namespace AGX_TrackFleetRenderer_helpers;
+
+	Batch.Tracks.RemoveAll([](const FAGX_TrackFleetEntry& Entry)
+						   { return !Entry.Track.IsValid(); });
+
+	int32 NumInstances = 0;
+	for (FAGX_TrackFleetEntry& Entry : Batch.Tracks)
+	{
+		Entry.FirstInstance = NumInstances;
+		Entry.NumInstances = Entry.Track->GetNumNodes();
+		NumInstances += Entry.NumInstances;
+
+		// Instances may have moved, so every track must be written at least once.
+		Entry.Bounds.Init();
+		Entry.NumSkippedUpdates = 0;
+		CollectWheelBodies(*Entry.Track, Entry.WheelBodies);
+	}
+
+	FAGX_RenderUtilities::SetInstanceCount(*Batch.Mesh, NumInstances);
+	Batch.bLayoutDirty = false;
+}
+
+void AAGX_TrackFleetRenderer::UpdateBatch(FAGX_TrackFleetBatch& Batch)
+{
+	if (Batch.Mesh == nullptr)
+		return;
+
+	for (const FAGX_TrackFleetEntry& Entry : Batch.Tracks)
+	{
+		if (!Entry.Track.IsValid() || Entry.Track->GetNumNodes() != Entry.NumInstances)
+		{
+			Batch.bLayoutDirty = true;
+			break;
+		}
+	}
+
+	if (Batch.bLayoutDirty)
+		UpdateLayout(Batch);
+
+	bool bAnyUpdated = false;
+	for (FAGX_TrackFleetEntry& Entry : Batch.Tracks)
+	{
+		if (ShouldSkipUpdate(Entry))
+			continue;
+
+		if (!Entry.Track->ComputeNodeTransforms(NodeTransforms) ||
+			NodeTransforms.Num() != Entry.NumInstances)
+		{
+			Batch.bLayoutDirty = true;
+			continue;
+		}
+
+		Entry.Bounds.Init();
+		for (const FTransform& Transform : NodeTransforms)
+			Entry.Bounds += Transform.GetLocation();
+
+		// Render state is marked dirty once for the whole batch below.
+		Batch.Mesh->BatchUpdateInstancesTransforms(
+			Entry.FirstInstance, NodeTransforms, /*bWorldSpace*/ true,
+			/*bMarkRenderStateDirty*/ false);
+		bAnyUpdated = true;
+	}
+
+	if (bAnyUpdated)
+		Batch.Mesh->MarkRenderStateDirty();
+}
+
+namespace AGX_TrackFleetRenderer_helpers
+{
+	int32 GetUpdateInterval(double ViewDistance, double FullRateDistance, int32 MaxInterval)
+	{
+		if (FullRateDistance <= 0.0 || ViewDistance < FullRateDistance || MaxInterval <= 1)
+			return 1;
+
+		// Interval 2 at FullRateDistance, doubled at every doubling of the distance.
+		const int32 NumDoublings =
+			FMath::FloorToInt32(FMath::Log2(ViewDistance / FullRateDistance));
+		return FMath::Min(1 << FMath::Clamp(NumDoublings + 1, 1, 30), MaxInterval);
+	}
+}
+
+bool AAGX_TrackFleetRenderer::ShouldSkipUpdate(FAGX_TrackFleetEntry& Entry) const
+{
+	using namespace AGX_TrackFleetRenderer_helpers;
+
+	// Tracks that have never been written must be updated so that they have valid bounds.
+	if (!Entry.Bounds.IsValid)
+		return false;
+
+	// The instances of a skipped track are not moved, so the bounds from the last update are
+	// stale. Cull with where the track is now, so that a track that moves into view is updated.
+	const FBox Bounds = GetCurrentBounds(Entry);
+	if (bHasViewFrustum &&
+		!ViewFrustum.IntersectBox(Bounds.GetCenter(), Bounds.GetExtent() + FVector(FrustumMargin)))
+	{
+		return true;
+	}
+
+	if (ViewLocations.IsEmpty())
+		return false;
+
+	double MinDistanceSquared = TNumericLimits<double>::Max();
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		MinDistanceSquared =
+			FMath::Min(MinDistanceSquared, Bounds.ComputeSquaredDistanceToPoint(ViewLocation));
+	}
+
+	const int32 Interval =
+		GetUpdateInterval(FMath::Sqrt(MinDistanceSquared), FullRateDistance, MaxUpdateInterval);
+	if (++Entry.NumSkippedUpdates < Interval)
+		return true;
+
+	Entry.NumSkippedUpdates = 0;
+	return false;
+}
+
+FBox AAGX_TrackFleetRenderer::GetCurrentBounds(const FAGX_TrackFleetEntry& Entry) const
+{
+	FBox Bounds(ForceInit);
+	for (const auto& WheelBody : Entry.WheelBodies)
+	{
+		if (const UAGX_RigidBodyComponent* Body = WheelBody.Key.Get())
+			Bounds += FBox::BuildAABB(Body->GetComponentLocation(), FVector(WheelBody.Value));
+	}
+
+	return Bounds.IsValid ? Bounds : Entry.Bounds;
+}
+
+void AAGX_TrackFleetRenderer::UpdateViews()
+{
+	const UWorld* World = GetWorld();
+	ViewLocations.Reset();
+	bHasViewFrustum = false;
+	if (World == nullptr)
+		return;
+
+	ViewLocations.Append(World->ViewLocationsRenderedLastFrame);
+
+	if (!bSkipTracksOutsideFrustum)
+		return;
+
+	bHasViewFrustum = FAGX_RenderUtilities::GetPlayerViewFrustum(*World, ViewFrustum);
+}
@@ -6,6 +6,7 @@
 #include "AGX_LogCategory.h"
 #include "Utilities/AGX_NotificationUtilities.h"
 #include "Utilities/AGX_ObjectUtilities.h"
+#include "Utilities/AGX_RenderUtilities.h"
 #include "Utilities/AGX_StringUtilities.h"
 #include "Vehicle/AGX_TrackComponent.h"
 
@@ -351,16 +352,7 @@ UAGX_TrackComponent* UAGX_TrackRenderer::FindTargetTrack()
 
 void UAGX_TrackRenderer::SetInstanceCount(int32 Count)
 {
-	Count = std::max(0, Count);
-
-	while (GetInstanceCount() < Count)
-	{
-		AddInstance(FTransform());
-	}
-	while (GetInstanceCount() > Count)
-	{
-		RemoveInstance(GetInstanceCount() - 1);
-	}
+	FAGX_RenderUtilities::SetInstanceCount(*this, Count);
 }
 
 void UAGX_TrackRenderer::SynchronizeVisuals()
@@ -402,9 +394,10 @@ void UAGX_TrackRenderer::SynchronizeVisuals()
 	UpdateComponentToWorld();
 
 	// Update transforms of the track node mesh instances.
-	for (int32 i = 0; i < NumNodes; ++i)
+	if (NumNodes > 0)
 	{
-		UpdateInstanceTransform(i, NodeTransformsCache[i], /*bWorldSpace*/ true);
+		BatchUpdateInstancesTransforms(
+			0, NodeTransformsCache, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true);
 	}
 }
 
@@ -0,0 +1,67 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Wire/AGX_WireAdaptiveResolution.h"
+
+namespace AGX_WireAdaptiveResolution_helpers
+{
+	// Nodes where the wire is in contact with something. Eye nodes are refined by their bend
+	// angle like any other node.
+	bool RequiresFinestResolution(EWireNodeType Type)
+	{
+		return Type == EWireNodeType::Contact || Type == EWireNodeType::ShapeContact;
+	}
+
+	// The angle between the wire segments on either side of a node [deg].
+	double GetBendAngle(const FVector& Previous, const FVector& Current, const FVector& Next)
+	{
+		const FVector In = (Current - Previous).GetSafeNormal();
+		const FVector Out = (Next - Current).GetSafeNormal();
+		if (In.IsZero() || Out.IsZero())
+			return 0.0;
+
+		return FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(In | Out, -1.0, 1.0)));
+	}
+}
+
+double FAGX_WireAdaptiveResolution::ComputeSegmentLength(
+	const TArray<FVector>& Locations, const TArray<EWireNodeType>& Types,
+	const TArray<double>& Tensions, double MinSegmentLength) const
+{
+	using namespace AGX_WireAdaptiveResolution_helpers;
+
+	check(Locations.Num() == Types.Num() && Locations.Num() == Tensions.Num());
+
+	const double Finest = bAllowFinerThanMinSegmentLength
+							  ? FinestSegmentLength
+							  : FMath::Max(FinestSegmentLength, MinSegmentLength);
+	const double Coarsest = FMath::Max(CoarsestSegmentLength, Finest);
+
+	double Required = Coarsest;
+	for (int32 I = 0; I < Locations.Num(); ++I)
+	{
+		if (RequiresFinestResolution(Types[I]))
+			return Finest;
+
+		double Demand = Coarsest;
+		if (I > 0 && I < Locations.Num() - 1 && FullRefinementAngle > 0.0)
+		{
+			const double Angle = GetBendAngle(Locations[I - 1], Locations[I], Locations[I + 1]);
+			const double Alpha = FMath::Clamp(Angle / FullRefinementAngle, 0.0, 1.0);
+			Demand = FMath::Lerp(Coarsest, Finest, Alpha);
+		}
+
+		if (Tensions[I] < SlackTension)
+			Demand = FMath::Min(Demand, MinSegmentLength);
+
+		Required = FMath::Min(Required, Demand);
+	}
+
+	return FMath::Clamp(Required, Finest, Coarsest);
+}
+
+bool FAGX_WireAdaptiveResolution::ShouldChange(
+	double CurrentSegmentLength, double RequiredSegmentLength) const
+{
+	return FMath::Abs(RequiredSegmentLength - CurrentSegmentLength) >
+		   Hysteresis * CurrentSegmentLength;
+}
@@ -13,9 +13,11 @@
 #include "Utilities/AGX_ImportRuntimeUtilities.h"
 #include "Utilities/AGX_NotificationUtilities.h"
 #include "Utilities/AGX_ObjectUtilities.h"
+#include "Utilities/AGX_RenderUtilities.h"
 #include "Utilities/AGX_StringUtilities.h"
 #include "Wire/AGX_WireInstanceData.h"
 #include "Wire/AGX_WireNode.h"
+#include "Wire/AGX_WireTubeComponent.h"
 #include "Wire/AGX_WireUtilities.h"
 #include "Wire/AGX_WireWinchComponent.h"
 #include "Wire/WireNodeBarrier.h"
@@ -26,6 +28,7 @@
 #include "Components/BillboardComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/SceneComponent.h"
+#include "ConvexVolume.h"
 #include "CoreGlobals.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/Texture2D.h"
@@ -35,6 +38,7 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Materials/MaterialInterface.h"
 #include "Math/UnrealMathUtility.h"
+#include "Misc/EngineVersionComparison.h"
 
 // Standard library includes.
 #include <algorithm>
@@ -108,6 +112,27 @@ void UAGX_WireComponent::SetMinSegmentLength(float InMinSegmentLength)
 	MinSegmentLength = InMinSegmentLength;
 }
 
+void UAGX_WireComponent::SetEnableAdaptiveResolution(bool bEnable)
+{
+	if (!bEnable && HasNative())
+	{
+		// Go back to the fixed resolution.
+		NativeBarrier.SetResolutionPerUnitLength(1.0f / MinSegmentLength);
+	}
+
+	// Evaluate immediately on the next tick.
+	TimeSinceAdaptiveResolutionUpdate = AdaptiveResolution.UpdateInterval;
+	bEnableAdaptiveResolution = bEnable;
+}
+
+float UAGX_WireComponent::GetActiveSegmentLength() const
+{
+	if (!HasNative())
+		return MinSegmentLength;
+
+	return 1.0f / NativeBarrier.GetResolutionPerUnitLength();
+}
+
 FAGX_WireWinchRef UAGX_WireComponent::GetOwnedBeginWinch_BP()
 {
 	return {&OwnedBeginWinch};
@@ -1199,12 +1224,150 @@ FAGX_WireRenderIterator UAGX_WireComponent::GetRenderEndIterator() const
 TArray<FVector> UAGX_WireComponent::GetRenderNodeLocations() const
 {
 	TArray<FVector> Result;
-	for (auto It = GetRenderBeginIterator(), End = GetRenderEndIterator(); It != End; It.Inc())
+	GetRenderNodes(Result);
+	return Result;
+}
+
+bool UAGX_WireComponent::GetRenderNodes(
+	TArray<FVector>& OutLocations, TArray<EWireNodeType>* OutTypes,
+	TArray<double>* OutTensions) const
+{
+	if (!HasNative())
 	{
-		const FAGX_WireNode Node = It.Get();
-		Result.Add(Node.GetWorldLocation());
+		OutLocations.Reset();
+		if (OutTypes != nullptr)
+			OutTypes->Reset();
+		if (OutTensions != nullptr)
+			OutTensions->Reset();
+		return false;
 	}
-	return Result;
+
+	NativeBarrier.GetRenderNodes(OutLocations, OutTypes, OutTensions);
+	return true;
+}
+
+namespace AGX_WireComponent_helpers
+{
+	// Eye and Body Fixed route nodes are always created from the Route Nodes, also when the Route
+	// Cache is used, and split the cached nodes into spans.
+	bool IsRouteAnchor(EWireNodeType NodeType)
+	{
+		return NodeType == EWireNodeType::Eye || NodeType == EWireNodeType::BodyFixed;
+	}
+
+	// How far an anchor may have moved, relative to the Wire Component, since the Route Cache was
+	// captured for the cache to still be used [cm].
+	constexpr double RouteCacheAnchorTolerance = 1.0;
+
+	// Hash of the Route Nodes and the winch Pulled In Lengths that Begin Play routes the wire
+	// from. Uses the Pulled In Length properties and not the native winches, so that a cache
+	// captured during Play matches the setup that created the wire.
+	uint32 GetRouteHash(const UAGX_WireComponent& Wire)
+	{
+		uint32 Hash = 0;
+		for (const FWireRoutingNode& RouteNode : Wire.RouteNodes)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(RouteNode.NodeType)));
+			Hash = HashCombine(Hash, GetTypeHash(RouteNode.Frame.LocalLocation));
+			Hash = HashCombine(Hash, GetTypeHash(RouteNode.Frame.Parent.Name));
+		}
+
+		for (const FAGX_WireWinch* Winch : {Wire.GetBeginWinch(), Wire.GetEndWinch()})
+		{
+			const double PulledInLength = Winch != nullptr ? Winch->PulledInLength : -1.0;
+			Hash = HashCombine(Hash, GetTypeHash(PulledInLength));
+		}
+
+		return Hash;
+	}
+}
+
+bool UAGX_WireComponent::CaptureRouteCache()
+{
+	if (!IsInitialized())
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("CaptureRouteCache called on Wire '%s' in '%s' but the wire has not been "
+				 "initialized. The Route Cache can only be captured during Play."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+		return false;
+	}
+
+	TArray<FVector> Locations;
+	TArray<EWireNodeType> Types;
+	NativeBarrier.GetRenderNodes(Locations, &Types);
+	return CaptureRouteCacheFrom(Locations, Types);
+}
+
+bool UAGX_WireComponent::CaptureRouteCacheFrom(
+	const TArray<FVector>& WorldLocations, const TArray<EWireNodeType>& Types)
+{
+	using namespace AGX_WireComponent_helpers;
+
+	RouteCache.Capture(WorldLocations, Types, GetComponentTransform());
+
+	int32 NumAnchors = 0;
+	for (const FWireRoutingNode& RouteNode : RouteNodes)
+		NumAnchors += IsRouteAnchor(RouteNode.NodeType) ? 1 : 0;
+
+	if (RouteCache.AnchorLocations.Num() != NumAnchors)
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Could not capture the Route Cache of Wire '%s' in '%s'. The wire has %d Eye and "
+				 "Body Fixed nodes but %d Eye and Body Fixed Route Nodes."),
+			*GetName(), *GetLabelSafe(GetOwner()), RouteCache.AnchorLocations.Num(), NumAnchors);
+		RouteCache.Reset();
+		return false;
+	}
+
+	RouteCache.Radius = Radius;
+	RouteCache.MinSegmentLength = MinSegmentLength;
+	RouteCache.bHasBeginWinch = HasBeginWinch();
+	RouteCache.bHasEndWinch = HasEndWinch();
+	RouteCache.RouteHash = GetRouteHash(*this);
+	return true;
+}
+
+void UAGX_WireComponent::ClearRouteCache()
+{
+	RouteCache.Reset();
+}
+
+bool UAGX_WireComponent::IsRouteCacheValid() const
+{
+	using namespace AGX_WireComponent_helpers;
+
+	if (RouteCache.IsEmpty() || !FMath::IsNearlyEqual(RouteCache.Radius, Radius) ||
+		!FMath::IsNearlyEqual(RouteCache.MinSegmentLength, MinSegmentLength) ||
+		RouteCache.bHasBeginWinch != HasBeginWinch() || RouteCache.bHasEndWinch != HasEndWinch() ||
+		RouteCache.RouteHash != GetRouteHash(*this))
+	{
+		return false;
+	}
+
+	// The hash covers the Route Node frames, but not the Components they are relative to.
+
+	const FTransform& WireTransform = GetComponentTransform();
+	int32 AnchorIndex = 0;
+	for (const FWireRoutingNode& RouteNode : RouteNodes)
+	{
+		if (!IsRouteAnchor(RouteNode.NodeType))
+			continue;
+
+		if (!RouteCache.AnchorLocations.IsValidIndex(AnchorIndex))
+			return false;
+
+		const FVector Location =
+			WireTransform.InverseTransformPosition(RouteNode.Frame.GetWorldLocation(*this));
+		if (!Location.Equals(RouteCache.AnchorLocations[AnchorIndex], RouteCacheAnchorTolerance))
+			return false;
+
+		++AnchorIndex;
+	}
+
+	return AnchorIndex == RouteCache.AnchorLocations.Num();
 }
 
 #if WITH_EDITOR
@@ -1607,6 +1770,11 @@ void UAGX_WireComponent::InitPropertyDispatcher()
 		GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, MinSegmentLength),
 		[](ThisClass* Wire) { Wire->SetMinSegmentLength(Wire->MinSegmentLength); });
 
+	Dispatcher.Add(
+		GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, bEnableAdaptiveResolution),
+		[](ThisClass* Wire)
+		{ Wire->SetEnableAdaptiveResolution(Wire->bEnableAdaptiveResolution); });
+
 	Dispatcher.Add(
 		GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, MergeSplitProperties),
 		[](ThisClass* This) { This->MergeSplitProperties.OnPostEditChangeProperty(*This); });
@@ -1644,6 +1812,14 @@ void UAGX_WireComponent::InitPropertyDispatcher()
 		GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, RenderMaterial),
 		[](ThisClass* Wire) { Wire->SetRenderMaterial(Wire->RenderMaterial); });
 
+	Dispatcher.Add(
+		GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, RenderMode),
+		[](ThisClass* Wire) { Wire->SetRenderMode(Wire->RenderMode); });
+
+	Dispatcher.Add(
+		GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, TubeLodDistance),
+		[](ThisClass* Wire) { Wire->SetTubeLodDistance(Wire->TubeLodDistance); });
+
 	// Begin Winch.
 
 #if 0
@@ -1802,13 +1978,50 @@ void UAGX_WireComponent::BeginPlay()
 
 		MergeSplitProperties.OnBeginPlay(*this);
 	}
+
+	if (HasNative())
+	{
+		if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		{
+			// During Play the visuals are updated by the Simulation after each step, with the
+			// render node extraction running in parallel with other components.
+			Simulation->AddVisualSyncJob(
+				*this, [this]() { return PrepareVisualsUpdate(); },
+				[this]() { ExtractVisualNodes(); }, [this]() { ApplyVisuals(); });
+			bVisualsSyncedBySimulation = true;
+		}
+	}
 }
 
 void UAGX_WireComponent::TickComponent(
 	float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	UpdateVisuals();
+	if (bEnableAdaptiveResolution)
+		UpdateAdaptiveResolution(DeltaTime);
+
+	if (!bVisualsSyncedBySimulation)
+		UpdateVisuals();
+}
+
+void UAGX_WireComponent::UpdateAdaptiveResolution(float DeltaTime)
+{
+	TimeSinceAdaptiveResolutionUpdate += DeltaTime;
+	if (TimeSinceAdaptiveResolutionUpdate < AdaptiveResolution.UpdateInterval || !IsInitialized())
+		return;
+
+	TimeSinceAdaptiveResolutionUpdate = 0.0f;
+
+	NativeBarrier.GetRenderNodes(
+		AdaptiveResolutionLocations, &AdaptiveResolutionTypes, &AdaptiveResolutionTensions);
+	const double Required = AdaptiveResolution.ComputeSegmentLength(
+		AdaptiveResolutionLocations, AdaptiveResolutionTypes, AdaptiveResolutionTensions,
+		MinSegmentLength);
+	const double Current = GetActiveSegmentLength();
+	if (!AdaptiveResolution.ShouldChange(Current, Required))
+		return;
+
+	NativeBarrier.SetResolutionPerUnitLength(static_cast<float>(1.0 / Required));
 }
 
 void UAGX_WireComponent::CreateMergeSplitProperties()
@@ -1840,6 +2053,14 @@ void UAGX_WireComponent::EndPlay(const EEndPlayReason::Type Reason)
 {
 	Super::EndPlay(Reason);
 
+	if (bVisualsSyncedBySimulation)
+	{
+		if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+			Simulation->RemoveVisualSyncJobs(*this);
+
+		bVisualsSyncedBySimulation = false;
+	}
+
 	if (GIsReconstructingBlueprintInstances)
 	{
 		// Another UAGX_WireComponent will inherit this one's Native Barrier, so don't wreck it.
@@ -1904,6 +2125,9 @@ void UAGX_WireComponent::DestroyComponent(bool bPromoteChildren)
 	if (VisualSpheres != nullptr)
 		VisualSpheres->DestroyComponent();
 
+	if (VisualTube != nullptr)
+		VisualTube->DestroyComponent();
+
 #if WITH_EDITOR
 	if (MapLoadDelegateHandle.IsValid())
 	{
@@ -2216,6 +2440,38 @@ void UAGX_WireComponent::SetRenderMaterial(UMaterialInterface* Material)
 
 	if (VisualSpheres != nullptr)
 		VisualSpheres->SetMaterial(0, RenderMaterial);
+
+	if (VisualTube != nullptr)
+		VisualTube->SetMaterial(0, RenderMaterial);
+}
+
+void UAGX_WireComponent::SetRenderMode(EWireRenderMode InRenderMode)
+{
+	RenderMode = InRenderMode;
+	UpdateVisuals();
+}
+
+void UAGX_WireComponent::SetTubeLodDistance(float InTubeLodDistance)
+{
+	TubeLodDistance = FMath::Max(InTubeLodDistance, 1.f);
+	if (VisualTube != nullptr)
+	{
+		VisualTube->SetResolution(
+			VisualTube->MaxSides, VisualTube->MaxSubdivisions, TubeLodDistance);
+	}
+}
+
+void UAGX_WireComponent::SetVisualLod(const FAGX_WireVisualLod& InVisualLod)
+{
+	VisualLod = InVisualLod;
+	bOverrideVisualLod = true;
+	NumSkippedVisualsUpdates = 0;
+}
+
+void UAGX_WireComponent::ClearVisualLodOverride()
+{
+	bOverrideVisualLod = false;
+	NumSkippedVisualsUpdates = 0;
 }
 
 void UAGX_WireComponent::CreateNative()
@@ -2256,11 +2512,43 @@ void UAGX_WireComponent::CreateNative()
 		AGX_WireComponent_helpers::CreateNativeWinch(*this, EWireSide::Begin);
 	}
 
+	// With a valid Route Cache the Free route nodes are replaced by the cached nodes of the span
+	// that ends at the next Eye or Body Fixed node. This restores the captured shape, the native
+	// wire is still initialized from the route nodes as usual.
+	const bool bRouteFromCache = bUseRouteCache && IsRouteCacheValid();
+	if (bUseRouteCache && !RouteCache.IsEmpty() && !bRouteFromCache)
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("The Route Cache of Wire '%s' in '%s' does not match the wire configuration and "
+				 "is ignored. Capture the Route Cache again, or clear it."),
+			*GetName(), *GetLabelSafe(GetOwner()));
+	}
+
+	int32 SpanIndex = 0;
+	auto AddCachedSpan = [this, &LocalToWorld](int32 Span)
+	{
+		for (const FVector& Location : RouteCache.GetSpan(Span))
+		{
+			FWireNodeBarrier NodeBarrier;
+			NodeBarrier.AllocateNativeFreeNode(LocalToWorld.TransformPosition(Location));
+			NativeBarrier.AddRouteNode(NodeBarrier);
+		}
+	};
+
 	AActor* const Owner = FAGX_ObjectUtilities::GetRootParentActor(GetOwner());
 	// Create AGX Dynamics simulation nodes and initialize the wire.
 	for (int32 I = 0; I < RouteNodes.Num(); ++I)
 	{
 		FWireRoutingNode& RouteNode = RouteNodes[I];
+		if (bRouteFromCache)
+		{
+			if (!IsRouteAnchor(RouteNode.NodeType))
+				continue;
+
+			AddCachedSpan(SpanIndex++);
+		}
+
 		FWireNodeBarrier NodeBarrier;
 
 		check(RouteNode.Frame.Parent.LocalScope == Owner);
@@ -2324,6 +2612,11 @@ void UAGX_WireComponent::CreateNative()
 		NativeBarrier.AddRouteNode(NodeBarrier);
 	}
 
+	if (bRouteFromCache)
+	{
+		AddCachedSpan(SpanIndex);
+	}
+
 	if (HasEndWinch())
 	{
 		AGX_WireComponent_helpers::CreateNativeWinch(*this, EWireSide::End);
@@ -2396,6 +2689,15 @@ void UAGX_WireComponent::CreateVisuals()
 	VisualSpheres->SetMaterial(0, RenderMaterial);
 }
 
+void UAGX_WireComponent::CreateVisualTube()
+{
+	VisualTube = NewObject<UAGX_WireTubeComponent>(this, FName(TEXT("VisualTube")));
+	VisualTube->LodDistance = TubeLodDistance;
+	VisualTube->RegisterComponent();
+	VisualTube->AttachToComponent(this, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	VisualTube->SetMaterial(0, RenderMaterial);
+}
+
 bool UAGX_WireComponent::UpdateNativeMaterial()
 {
 	if (!HasNative())
@@ -2450,29 +2752,28 @@ bool UAGX_WireComponent::DoesPropertyAffectVisuals(const FName& MemberPropertyNa
 	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, Radius))
 		return true;
 
+	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UAGX_WireComponent, RenderMode))
+		return true;
+
 	return false;
 }
 #endif
 
-TArray<FVector> UAGX_WireComponent::GetNodesForRendering() const
+void UAGX_WireComponent::GetNodesForRendering(TArray<FVector>& OutNodeLocations) const
 {
-	TArray<FVector> NodeLocations;
 	if (HasRenderNodes())
 	{
-		NodeLocations = GetRenderNodeLocations();
+		NativeBarrier.GetRenderNodes(OutNodeLocations);
 	}
 	else
 	{
-		NodeLocations.Reserve(RouteNodes.Num());
-		const FTransform& ComponentTransform = GetComponentTransform();
+		OutNodeLocations.Reset(RouteNodes.Num());
 		for (const auto& Node : RouteNodes)
 		{
 			const FVector WorldLocation = Node.Frame.GetWorldLocation(*this);
-			NodeLocations.Add(WorldLocation);
+			OutNodeLocations.Add(WorldLocation);
 		}
 	}
-
-	return NodeLocations;
 }
 
 bool UAGX_WireComponent::ShouldRenderSelf() const
@@ -2480,7 +2781,58 @@ bool UAGX_WireComponent::ShouldRenderSelf() const
 	return VisualCylinders != nullptr && VisualSpheres != nullptr && ShouldRender();
 }
 
+namespace AGX_WireComponent_helpers
+{
+	// The distance from the closest of the given view locations to the bounds of the points [cm].
+	double GetViewDistance(const TArray<FVector>& Points, const TArray<FVector>& ViewLocations)
+	{
+		if (ViewLocations.IsEmpty() || Points.IsEmpty())
+			return 0.0;
+
+		const FBox Bounds(Points);
+		double MinDistanceSquared = TNumericLimits<double>::Max();
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			MinDistanceSquared =
+				FMath::Min(MinDistanceSquared, Bounds.ComputeSquaredDistanceToPoint(ViewLocation));
+		}
+
+		return FMath::Sqrt(MinDistanceSquared);
+	}
+
+	/**
+	 * Keep only every Stride'th point, and always the first and last, compacting in place so
+	 * that the allocation is kept.
+	 */
+	void MergeRenderNodes(TArray<FVector>& Points, int32 Stride)
+	{
+		if (Stride <= 1 || Points.Num() <= 2)
+			return;
+
+		const int32 LastIndex = Points.Num() - 1;
+		int32 NumKept = 1;
+		for (int32 I = Stride; I < LastIndex; I += Stride)
+			Points[NumKept++] = Points[I];
+
+		Points[NumKept++] = Points[LastIndex];
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+		Points.SetNum(NumKept, false);
+#else
+		Points.SetNum(NumKept, EAllowShrinking::No);
+#endif
+	}
+}
+
 void UAGX_WireComponent::UpdateVisuals()
+{
+	if (!PrepareVisualsUpdate())
+		return;
+
+	ExtractVisualNodes();
+	ApplyVisuals();
+}
+
+bool UAGX_WireComponent::PrepareVisualsUpdate()
 {
 	if (!ShouldRenderSelf())
 	{
@@ -2492,9 +2844,31 @@ void UAGX_WireComponent::UpdateVisuals()
 		if (bHasVisualCylinders || bHasVisualSpheres)
 			SetVisualsInstanceCount(0);
 
-		return;
+		if (VisualTube != nullptr)
+			VisualTube->ClearNodes();
+
+		return false;
 	}
 
+	const FAGX_WireVisualLod* Lod = GetActiveVisualLod();
+	if (Lod != nullptr && ShouldSkipVisualsUpdate(*Lod))
+		return false;
+
+	ActiveVisualLod.Reset();
+	VisualLodViewLocations.Reset();
+	if (Lod != nullptr)
+	{
+		ActiveVisualLod = *Lod;
+		if (const UWorld* World = GetWorld())
+			VisualLodViewLocations.Append(World->ViewLocationsRenderedLastFrame);
+	}
+
+	// Without render nodes the visuals follow the route nodes, whose frames may be relative to
+	// other Components.
+	bExtractRenderNodes = HasRenderNodes();
+	if (!bExtractRenderNodes)
+		GetNodesForRendering(RenderNodeLocations);
+
 	// Workaround, the RenderMaterial does not propagate properly in SetRenderMaterial() in
 	// Blueprints, so we assign it here.
 	if (VisualCylinders->GetMaterial(0) != RenderMaterial)
@@ -2503,8 +2877,115 @@ void UAGX_WireComponent::UpdateVisuals()
 	if (VisualSpheres->GetMaterial(0) != RenderMaterial)
 		VisualSpheres->SetMaterial(0, RenderMaterial);
 
-	TArray<FVector> NodeLocations = GetNodesForRendering();
-	RenderSelf(NodeLocations);
+	return true;
+}
+
+void UAGX_WireComponent::ExtractVisualNodes()
+{
+	using namespace AGX_WireComponent_helpers;
+
+	if (bExtractRenderNodes)
+		NativeBarrier.GetRenderNodes(RenderNodeLocations);
+
+	if (ActiveVisualLod.IsSet())
+	{
+		const double ViewDistance = GetViewDistance(RenderNodeLocations, VisualLodViewLocations);
+		MergeRenderNodes(RenderNodeLocations, ActiveVisualLod->GetNodeStride(ViewDistance));
+	}
+}
+
+void UAGX_WireComponent::ApplyVisuals()
+{
+	if (RenderMode == EWireRenderMode::Tube)
+	{
+		if (VisualCylinders->GetInstanceCount() > 0 || VisualSpheres->GetInstanceCount() > 0)
+			SetVisualsInstanceCount(0);
+
+		RenderTube(RenderNodeLocations);
+	}
+	else
+	{
+		if (VisualTube != nullptr)
+			VisualTube->ClearNodes();
+
+		RenderSelf(RenderNodeLocations);
+	}
+}
+
+const FAGX_WireVisualLod* UAGX_WireComponent::GetActiveVisualLod() const
+{
+	// Outside of Play the visuals follow the route nodes and should always be up to date.
+	if (!HasNative())
+		return nullptr;
+
+	if (bOverrideVisualLod)
+		return &VisualLod;
+
+	const UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
+	if (Simulation == nullptr || !Simulation->bEnableWireVisualLod)
+		return nullptr;
+
+	return &Simulation->WireVisualLod;
+}
+
+bool UAGX_WireComponent::ShouldSkipVisualsUpdate(const FAGX_WireVisualLod& Lod)
+{
+	// Visuals that have never been updated are never rendered, so only skip once there is
+	// something on screen that can report being rendered.
+	const UWorld* World = GetWorld();
+	const double Now = World != nullptr ? World->GetTimeSeconds() : 0.0;
+	if (!HasVisualsToRender())
+	{
+		NumSkippedVisualsUpdates = 0;
+		LastTimeInView = Now;
+		return false;
+	}
+
+	if (Lod.NotRenderedTimeout > 0.f && World != nullptr)
+	{
+		// Test where the wire is now rather than whether the frozen visuals were rendered, so that
+		// a wire that moves into view is updated right away. If the view is unknown the wire is
+		// treated as being in view.
+		FConvexVolume Frustum;
+		if (FAGX_RenderUtilities::GetPlayerViewFrustum(*World, Frustum))
+		{
+			const FBox Bounds = NativeBarrier.GetRenderNodeBounds().ExpandBy(Radius);
+			if (Bounds.IsValid && Frustum.IntersectBox(Bounds.GetCenter(), Bounds.GetExtent()))
+				LastTimeInView = Now;
+		}
+		else
+		{
+			LastTimeInView = Now;
+		}
+
+		if (Now - LastTimeInView > Lod.NotRenderedTimeout)
+			return true;
+	}
+
+	if (++NumSkippedVisualsUpdates < Lod.UpdateInterval)
+		return true;
+
+	NumSkippedVisualsUpdates = 0;
+	return false;
+}
+
+bool UAGX_WireComponent::HasVisualsToRender() const
+{
+	if (RenderMode == EWireRenderMode::Tube)
+		return VisualTube != nullptr && VisualTube->GetNumNodes() > 0;
+
+	return VisualCylinders != nullptr && VisualCylinders->GetInstanceCount() > 0;
+}
+
+void UAGX_WireComponent::RenderTube(const TArray<FVector>& Points)
+{
+	if (VisualTube == nullptr)
+		CreateVisualTube();
+
+	if (VisualTube->GetMaterial(0) != RenderMaterial)
+		VisualTube->SetMaterial(0, RenderMaterial);
+
+	VisualTube->SetNodes(Points, Radius);
 }
 
 void UAGX_WireComponent::RenderSelf(const TArray<FVector>& Points)
@@ -2522,6 +3003,8 @@ void UAGX_WireComponent::RenderSelf(const TArray<FVector>& Points)
 	FTransform SphereTransform {FTransform::Identity};
 	FTransform CylTransform {FTransform::Identity};
 	SphereTransform.SetScale3D(FVector(ScaleXY, ScaleXY, ScaleXY));
+	VisualCylinderTransforms.SetNum(NumSegments);
+	VisualSphereTransforms.SetNum(NumSegments);
 	for (int i = 0; i < NumSegments; i++)
 	{
 		const FVector& StartLocation = Points[i];
@@ -2534,34 +3017,26 @@ void UAGX_WireComponent::RenderSelf(const TArray<FVector>& Points)
 		CylTransform.SetRotation(Rot.Quaternion());
 		const auto Distance = (DeltaVec).Length();
 		CylTransform.SetScale3D(FVector(ScaleXY, ScaleXY, Distance * 0.01));
-		VisualCylinders->UpdateInstanceTransform(i, CylTransform, true, true);
+		VisualCylinderTransforms[i] = CylTransform;
 
 		SphereTransform.SetLocation(StartLocation);
-		VisualSpheres->UpdateInstanceTransform(i, SphereTransform, true, true);
+		VisualSphereTransforms[i] = SphereTransform;
 	}
+
+	// One render state update per component instead of one per instance.
+	VisualCylinders->BatchUpdateInstancesTransforms(
+		0, VisualCylinderTransforms, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true);
+	VisualSpheres->BatchUpdateInstancesTransforms(
+		0, VisualSphereTransforms, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true);
 }
 
 void UAGX_WireComponent::SetVisualsInstanceCount(int32 Num)
 {
-	Num = std::max(0, Num);
-
-	auto SetNum = [](UInstancedStaticMeshComponent& C, int32 N)
-	{
-		while (C.GetInstanceCount() < N)
-		{
-			C.AddInstance(FTransform());
-		}
-		while (C.GetInstanceCount() > N)
-		{
-			C.RemoveInstance(C.GetInstanceCount() - 1);
-		}
-	};
-
 	if (VisualCylinders != nullptr)
-		SetNum(*VisualCylinders, Num);
+		FAGX_RenderUtilities::SetInstanceCount(*VisualCylinders, Num);
 
 	if (VisualSpheres != nullptr)
-		SetNum(*VisualSpheres, Num);
+		FAGX_RenderUtilities::SetInstanceCount(*VisualSpheres, Num);
 }
 
 #if WITH_EDITOR
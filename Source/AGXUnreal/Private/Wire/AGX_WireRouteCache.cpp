@@ -0,0 +1,64 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Wire/AGX_WireRouteCache.h"
+
+bool FAGX_WireRouteCache::IsEmpty() const
+{
+	return SpanOffsets.IsEmpty();
+}
+
+void FAGX_WireRouteCache::Reset()
+{
+	*this = FAGX_WireRouteCache();
+}
+
+int32 FAGX_WireRouteCache::GetNumSpans() const
+{
+	return FMath::Max(SpanOffsets.Num() - 1, 0);
+}
+
+TArrayView<const FVector> FAGX_WireRouteCache::GetSpan(int32 SpanIndex) const
+{
+	if (SpanIndex < 0 || SpanIndex >= GetNumSpans())
+		return {};
+
+	const int32 First = SpanOffsets[SpanIndex];
+	const int32 Num = SpanOffsets[SpanIndex + 1] - First;
+	return TArrayView<const FVector>(NodeLocations.GetData() + First, Num);
+}
+
+void FAGX_WireRouteCache::Capture(
+	const TArray<FVector>& WorldLocations, const TArray<EWireNodeType>& Types,
+	const FTransform& WireTransform)
+{
+	check(WorldLocations.Num() == Types.Num());
+
+	NodeLocations.Reset();
+	AnchorLocations.Reset();
+	SpanOffsets.Reset();
+	SpanOffsets.Add(0);
+
+	for (int32 I = 0; I < WorldLocations.Num(); ++I)
+	{
+		const FVector LocalLocation = WireTransform.InverseTransformPosition(WorldLocations[I]);
+		switch (Types[I])
+		{
+			case EWireNodeType::Eye:
+			case EWireNodeType::BodyFixed:
+				// Anchors end the current span. They are recreated from the Route Nodes.
+				AnchorLocations.Add(LocalLocation);
+				SpanOffsets.Add(NodeLocations.Num());
+				break;
+			case EWireNodeType::Free:
+			case EWireNodeType::Contact:
+			case EWireNodeType::ShapeContact:
+				NodeLocations.Add(LocalLocation);
+				break;
+			default:
+				// Stop and connecting nodes are created by the winches.
+				break;
+		}
+	}
+
+	SpanOffsets.Add(NodeLocations.Num());
+}
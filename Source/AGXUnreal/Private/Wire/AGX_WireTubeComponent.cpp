@@ -0,0 +1,540 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Wire/AGX_WireTubeComponent.h"
+
+// Unreal Engine includes.
+#include "DynamicMeshBuilder.h"
+#include "Engine/Engine.h"
+#include "LocalVertexFactory.h"
+#include "MaterialDomain.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialRenderProxy.h"
+#include "Misc/EngineVersionComparison.h"
+#include "PrimitiveSceneProxy.h"
+#include "PrimitiveViewRelevance.h"
+#include "RenderingThread.h"
+#include "SceneInterface.h"
+#include "SceneManagement.h"
+#include "StaticMeshResources.h"
+
+namespace AGX_WireTubeComponent_helpers
+{
+	FVector3f CatmullRom(
+		const FVector3f& P0, const FVector3f& P1, const FVector3f& P2, const FVector3f& P3,
+		float T)
+	{
+		const float T2 = T * T;
+		const float T3 = T2 * T;
+		return 0.5f * ((2.f * P1) + (P2 - P0) * T + (2.f * P0 - 5.f * P1 + 4.f * P2 - P3) * T2 +
+					   (3.f * P1 - P0 - 3.f * P2 + P3) * T3);
+	}
+
+	FVector3f MakePerpendicular(const FVector3f& Direction)
+	{
+		const FVector3f Up =
+			FMath::Abs(Direction.Z) < 0.9f ? FVector3f::UpVector : FVector3f::ForwardVector;
+		return FVector3f::CrossProduct(Direction, Up).GetSafeNormal();
+	}
+
+	/**
+	 * Sample a Catmull-Rom spline through the nodes, with Subdivisions samples per node interval.
+	 */
+	void SampleCenterline(
+		const TArray<FVector3f>& Nodes, int32 Subdivisions, TArray<FVector3f>& OutPoints)
+	{
+		const int32 NumNodes = Nodes.Num();
+		OutPoints.Reset((NumNodes - 1) * Subdivisions + 1);
+		for (int32 I = 0; I < NumNodes - 1; ++I)
+		{
+			const FVector3f& P0 = Nodes[FMath::Max(I - 1, 0)];
+			const FVector3f& P1 = Nodes[I];
+			const FVector3f& P2 = Nodes[I + 1];
+			const FVector3f& P3 = Nodes[FMath::Min(I + 2, NumNodes - 1)];
+			for (int32 S = 0; S < Subdivisions; ++S)
+			{
+				const float T = static_cast<float>(S) / static_cast<float>(Subdivisions);
+				OutPoints.Add(CatmullRom(P0, P1, P2, P3, T));
+			}
+		}
+
+		OutPoints.Add(Nodes.Last());
+	}
+
+	/**
+	 * Create one ring of vertices per centerline point and connect consecutive rings with quads.
+	 * The ring frame is parallel transported along the centerline so that the tube doesn't twist.
+	 */
+	void BuildTube(
+		const TArray<FVector3f>& Points, float Radius, int32 NumSides,
+		FStaticMeshVertexBuffers& OutVertices, TArray<uint32>& OutIndices)
+	{
+		const int32 NumRings = Points.Num();
+		const int32 RingSize = NumSides + 1; // The seam is duplicated for the texture coordinates.
+		const int32 NumVertices = NumRings * RingSize;
+		OutVertices.PositionVertexBuffer.Init(NumVertices);
+		OutVertices.StaticMeshVertexBuffer.Init(NumVertices, 1);
+		OutVertices.ColorVertexBuffer.InitFromSingleColor(FColor::White, NumVertices);
+		OutIndices.Reset((NumRings - 1) * NumSides * 6);
+
+		// Texture V advances one unit per circumference, so that texels are square.
+		const float InvCircumference = 1.f / FMath::Max(2.f * PI * Radius, UE_KINDA_SMALL_NUMBER);
+
+		FVector3f Tangent = FVector3f::UpVector;
+		FVector3f Normal = FVector3f::ZeroVector;
+		float V = 0.f;
+		for (int32 R = 0; R < NumRings; ++R)
+		{
+			const FVector3f& Prev = Points[FMath::Max(R - 1, 0)];
+			const FVector3f& Next = Points[FMath::Min(R + 1, NumRings - 1)];
+			const FVector3f Direction = (Next - Prev).GetSafeNormal();
+			if (!Direction.IsNearlyZero())
+				Tangent = Direction;
+
+			if (R == 0)
+			{
+				Normal = MakePerpendicular(Tangent);
+			}
+			else
+			{
+				Normal = (Normal - Tangent * FVector3f::DotProduct(Normal, Tangent)).GetSafeNormal();
+				if (Normal.IsNearlyZero())
+					Normal = MakePerpendicular(Tangent);
+
+				V += FVector3f::Distance(Points[R], Points[R - 1]) * InvCircumference;
+			}
+
+			const FVector3f Binormal = FVector3f::CrossProduct(Tangent, Normal);
+			for (int32 S = 0; S <= NumSides; ++S)
+			{
+				const float U = static_cast<float>(S) / static_cast<float>(NumSides);
+				float Sin, Cos;
+				FMath::SinCos(&Sin, &Cos, 2.f * PI * U);
+				const FVector3f Outward = Normal * Cos + Binormal * Sin;
+				const int32 Vertex = R * RingSize + S;
+				OutVertices.PositionVertexBuffer.VertexPosition(Vertex) =
+					Points[R] + Outward * Radius;
+				OutVertices.StaticMeshVertexBuffer.SetVertexTangents(
+					Vertex, Tangent, FVector3f::CrossProduct(Outward, Tangent), Outward);
+				OutVertices.StaticMeshVertexBuffer.SetVertexUV(Vertex, 0, FVector2f(U, V));
+			}
+		}
+
+		for (int32 R = 0; R < NumRings - 1; ++R)
+		{
+			for (int32 S = 0; S < NumSides; ++S)
+			{
+				const uint32 A = static_cast<uint32>(R * RingSize + S);
+				const uint32 B = A + static_cast<uint32>(RingSize);
+				OutIndices.Append({A, B, A + 1, A + 1, B, B + 1});
+			}
+		}
+	}
+
+	/**
+	 * The number of LOD levels that differ in sides or subdivisions. Levels beyond the last one
+	 * would produce the same tube as the last one.
+	 */
+	int32 GetNumLodLevels(int32 MaxSides, int32 MaxSubdivisions)
+	{
+		int32 Level = 0;
+		while (FMath::Max(MaxSides >> (Level + 1), 3) != FMath::Max(MaxSides >> Level, 3) ||
+			   FMath::Max(MaxSubdivisions >> (Level + 1), 1) !=
+				   FMath::Max(MaxSubdivisions >> Level, 1))
+		{
+			++Level;
+		}
+
+		return Level + 1;
+	}
+
+	/**
+	 * The LOD level is 0 within LodDistance and increases by one for every doubling of the distance.
+	 */
+	int32 GetLodLevel(float Distance, float LodDistance)
+	{
+		const float Ratio = Distance / FMath::Max(LodDistance, 1.f);
+		if (Ratio < 1.f)
+			return 0;
+
+		return FMath::Min(FMath::FloorToInt(FMath::Log2(Ratio)) + 1, 30);
+	}
+}
+
+/**
+ * The render resources of the tube at one LOD level. They are rebuilt when new nodes arrive and
+ * drawn as is by every view until the next update.
+ */
+struct FAGX_WireTubeLod
+{
+	FStaticMeshVertexBuffers VertexBuffers;
+	FDynamicMeshIndexBuffer32 IndexBuffer;
+	FLocalVertexFactory VertexFactory;
+
+	FAGX_WireTubeLod(ERHIFeatureLevel::Type FeatureLevel)
+		: VertexFactory(FeatureLevel, "FAGX_WireTubeSceneProxy")
+	{
+	}
+
+	bool IsEmpty() const
+	{
+		return IndexBuffer.Indices.Num() == 0;
+	}
+
+	/**
+	 * Upload the vertices and indices written to the CPU side buffers, replacing the previous
+	 * render resources.
+	 */
+	void InitResources(FRHICommandListImmediate& RHICmdList)
+	{
+		ReleaseResources();
+		if (IsEmpty())
+			return;
+
+#if UE_VERSION_OLDER_THAN(5, 3, 0)
+		VertexBuffers.PositionVertexBuffer.InitResource();
+		VertexBuffers.StaticMeshVertexBuffer.InitResource();
+		VertexBuffers.ColorVertexBuffer.InitResource();
+#else
+		VertexBuffers.PositionVertexBuffer.InitResource(RHICmdList);
+		VertexBuffers.StaticMeshVertexBuffer.InitResource(RHICmdList);
+		VertexBuffers.ColorVertexBuffer.InitResource(RHICmdList);
+#endif
+
+		FLocalVertexFactory::FDataType Data;
+		VertexBuffers.PositionVertexBuffer.BindPositionVertexBuffer(&VertexFactory, Data);
+		VertexBuffers.StaticMeshVertexBuffer.BindTangentVertexBuffer(&VertexFactory, Data);
+		VertexBuffers.StaticMeshVertexBuffer.BindPackedTexCoordVertexBuffer(&VertexFactory, Data);
+		VertexBuffers.StaticMeshVertexBuffer.BindLightMapVertexBuffer(&VertexFactory, Data, 0);
+		VertexBuffers.ColorVertexBuffer.BindColorVertexBuffer(&VertexFactory, Data);
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+		VertexFactory.SetData(Data);
+#else
+		VertexFactory.SetData(RHICmdList, Data);
+#endif
+#if UE_VERSION_OLDER_THAN(5, 3, 0)
+		VertexFactory.InitResource();
+		IndexBuffer.InitResource();
+#else
+		VertexFactory.InitResource(RHICmdList);
+		IndexBuffer.InitResource(RHICmdList);
+#endif
+	}
+
+	void ReleaseResources()
+	{
+		VertexBuffers.PositionVertexBuffer.ReleaseResource();
+		VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
+		VertexBuffers.ColorVertexBuffer.ReleaseResource();
+		IndexBuffer.ReleaseResource();
+		VertexFactory.ReleaseResource();
+	}
+};
+
+/** Scene proxy */
+class FAGX_WireTubeSceneProxy final : public FPrimitiveSceneProxy
+{
+public:
+	SIZE_T GetTypeHash() const override
+	{
+		static size_t UniquePointer;
+		return reinterpret_cast<size_t>(&UniquePointer);
+	}
+
+	FAGX_WireTubeSceneProxy(UAGX_WireTubeComponent* Component)
+		: FPrimitiveSceneProxy(Component)
+		, MaterialRelevance(Component->GetMaterialRelevance(GetScene().GetFeatureLevel()))
+		, Radius(Component->Radius)
+		, MaxSides(FMath::Max(Component->MaxSides, 3))
+		, MaxSubdivisions(FMath::Max(Component->MaxSubdivisions, 1))
+		, LodDistance(Component->LodDistance)
+	{
+		using namespace AGX_WireTubeComponent_helpers;
+
+		const int32 NumLods = GetNumLodLevels(MaxSides, MaxSubdivisions);
+		Lods.Reserve(NumLods);
+		for (int32 Level = 0; Level < NumLods; ++Level)
+		{
+			Lods.Add(MakeUnique<FAGX_WireTubeLod>(GetScene().GetFeatureLevel()));
+		}
+
+		Material = Component->GetMaterial(0);
+		if (Material == nullptr)
+		{
+			Material = UMaterial::GetDefaultMaterial(MD_Surface);
+		}
+
+		ENQUEUE_RENDER_COMMAND(FAGX_WireTubeSceneProxyInit)
+		(
+			[this, Nodes = Component->LocalNodes](FRHICommandListImmediate& RHICmdList) mutable
+			{ BuildLods(RHICmdList, MoveTemp(Nodes)); });
+	}
+
+	virtual ~FAGX_WireTubeSceneProxy()
+	{
+		for (TUniquePtr<FAGX_WireTubeLod>& Lod : Lods)
+		{
+			Lod->ReleaseResources();
+		}
+	}
+
+	void SetNodes_RenderThread(
+		FRHICommandListImmediate& RHICmdList, TArray<FVector3f>&& InNodes, float InRadius)
+	{
+		check(IsInRenderingThread());
+		Radius = InRadius;
+		BuildLods(RHICmdList, MoveTemp(InNodes));
+	}
+
+	virtual void GetDynamicMeshElements(
+		const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily,
+		uint32 VisibilityMap, FMeshElementCollector& Collector) const override
+	{
+		using namespace AGX_WireTubeComponent_helpers;
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_AGX_WireTubeSceneProxy_GetDynamicMeshElements);
+
+		if (Lods.Num() == 0 || Lods[0]->IsEmpty())
+			return;
+
+		const bool bWireframe = AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe;
+		FMaterialRenderProxy* MaterialProxy = nullptr;
+		if (bWireframe)
+		{
+			auto WireframeMaterialInstance = new FColoredMaterialRenderProxy(
+				GEngine->WireframeMaterial ? GEngine->WireframeMaterial->GetRenderProxy()
+										   : nullptr,
+				FLinearColor(0, 0.5f, 1.f));
+			Collector.RegisterOneFrameMaterialProxy(WireframeMaterialInstance);
+			MaterialProxy = WireframeMaterialInstance;
+		}
+		else
+		{
+			MaterialProxy = Material->GetRenderProxy();
+		}
+
+		const FBoxSphereBounds& WorldBounds = GetBounds();
+		for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+		{
+			if (!(VisibilityMap & (1 << ViewIndex)))
+				continue;
+
+			const FSceneView* View = Views[ViewIndex];
+			const float Distance = static_cast<float>(FMath::Max(
+				FVector::Distance(View->ViewMatrices.GetViewOrigin(), WorldBounds.Origin) -
+					WorldBounds.SphereRadius,
+				0.0));
+			const int32 Level = FMath::Min(GetLodLevel(Distance, LodDistance), Lods.Num() - 1);
+			const FAGX_WireTubeLod& Lod = *Lods[Level];
+
+			FMeshBatch& Mesh = Collector.AllocateMesh();
+			FMeshBatchElement& BatchElement = Mesh.Elements[0];
+			BatchElement.IndexBuffer = &Lod.IndexBuffer;
+			Mesh.bWireframe = bWireframe;
+			Mesh.VertexFactory = &Lod.VertexFactory;
+			Mesh.MaterialRenderProxy = MaterialProxy;
+
+			bool bHasPrecomputedVolumetricLightmap;
+			FMatrix PreviousLocalToWorld;
+			int32 SingleCaptureIndex;
+			bool bOutputVelocity;
+			GetScene().GetPrimitiveUniformShaderParameters_RenderThread(
+				GetPrimitiveSceneInfo(), bHasPrecomputedVolumetricLightmap, PreviousLocalToWorld,
+				SingleCaptureIndex, bOutputVelocity);
+			FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer =
+				Collector.AllocateOneFrameResource<FDynamicPrimitiveUniformBuffer>();
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+			DynamicPrimitiveUniformBuffer.Set(
+				GetLocalToWorld(), PreviousLocalToWorld, GetBounds(), GetLocalBounds(), true,
+				bHasPrecomputedVolumetricLightmap, bOutputVelocity);
+#else
+			DynamicPrimitiveUniformBuffer.Set(
+				Collector.GetRHICommandList(), GetLocalToWorld(), PreviousLocalToWorld,
+				GetBounds(), GetLocalBounds(), true, bHasPrecomputedVolumetricLightmap,
+				bOutputVelocity);
+#endif
+			BatchElement.PrimitiveUniformBufferResource =
+				&DynamicPrimitiveUniformBuffer.UniformBuffer;
+
+			BatchElement.FirstIndex = 0;
+			BatchElement.NumPrimitives = Lod.IndexBuffer.Indices.Num() / 3;
+			BatchElement.MinVertexIndex = 0;
+			BatchElement.MaxVertexIndex =
+				Lod.VertexBuffers.PositionVertexBuffer.GetNumVertices() - 1;
+			Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+			// Backface culling is disabled since the tube ends are open.
+			Mesh.bDisableBackfaceCulling = true;
+			Mesh.Type = PT_TriangleList;
+			Mesh.DepthPriorityGroup = SDPG_World;
+			Mesh.bCanApplyViewModeOverrides = false;
+			Collector.AddMesh(ViewIndex, Mesh);
+		}
+	}
+
+	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
+	{
+		FPrimitiveViewRelevance Result;
+		Result.bDrawRelevance = IsShown(View);
+		Result.bShadowRelevance = IsShadowCast(View);
+		Result.bDynamicRelevance = true;
+		Result.bRenderInMainPass = ShouldRenderInMainPass();
+		Result.bUsesLightingChannels = GetLightingChannelMask() != GetDefaultLightingChannelMask();
+		Result.bRenderCustomDepth = ShouldRenderCustomDepth();
+		Result.bTranslucentSelfShadow = bCastVolumetricTranslucentShadow;
+		MaterialRelevance.SetPrimitiveViewRelevance(Result);
+		Result.bVelocityRelevance = IsMovable() && Result.bOpaque && Result.bRenderInMainPass;
+		return Result;
+	}
+
+	virtual bool CanBeOccluded() const override
+	{
+		return !MaterialRelevance.bDisableDepthTest;
+	}
+
+	virtual uint32 GetMemoryFootprint(void) const override
+	{
+		return (sizeof(*this) + GetAllocatedSize());
+	}
+
+	uint32 GetAllocatedSize(void) const
+	{
+		SIZE_T Size = FPrimitiveSceneProxy::GetAllocatedSize() + Points.GetAllocatedSize() +
+					  Lods.GetAllocatedSize();
+		for (const TUniquePtr<FAGX_WireTubeLod>& Lod : Lods)
+		{
+			Size += sizeof(FAGX_WireTubeLod) + Lod->IndexBuffer.Indices.GetAllocatedSize() +
+					Lod->VertexBuffers.PositionVertexBuffer.GetAllocatedSize() +
+					Lod->VertexBuffers.StaticMeshVertexBuffer.GetResourceSize() +
+					Lod->VertexBuffers.ColorVertexBuffer.GetAllocatedSize();
+		}
+
+		return static_cast<uint32>(Size);
+	}
+
+private:
+	/**
+	 * Build the tube of every LOD level from the given nodes and upload it. This is the only place
+	 * where the tube is sampled and triangulated.
+	 */
+	void BuildLods(FRHICommandListImmediate& RHICmdList, TArray<FVector3f>&& Nodes)
+	{
+		using namespace AGX_WireTubeComponent_helpers;
+		check(IsInRenderingThread());
+
+		for (int32 Level = 0; Level < Lods.Num(); ++Level)
+		{
+			FAGX_WireTubeLod& Lod = *Lods[Level];
+			if (Nodes.Num() < 2)
+			{
+				Lod.IndexBuffer.Indices.Reset();
+			}
+			else
+			{
+				const int32 NumSides = FMath::Max(MaxSides >> Level, 3);
+				const int32 Subdivisions = FMath::Max(MaxSubdivisions >> Level, 1);
+				SampleCenterline(Nodes, Subdivisions, Points);
+				BuildTube(Points, Radius, NumSides, Lod.VertexBuffers, Lod.IndexBuffer.Indices);
+			}
+
+			Lod.InitResources(RHICmdList);
+		}
+	}
+
+private:
+	UMaterialInterface* Material;
+	FMaterialRelevance MaterialRelevance;
+	TArray<TUniquePtr<FAGX_WireTubeLod>> Lods;
+	// Centerline sample scratch buffer, kept to avoid reallocating it on every update.
+	TArray<FVector3f> Points;
+	float Radius;
+	int32 MaxSides;
+	int32 MaxSubdivisions;
+	float LodDistance;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+UAGX_WireTubeComponent::UAGX_WireTubeComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetCanEverAffectNavigation(false);
+}
+
+void UAGX_WireTubeComponent::SetResolution(
+	int32 InMaxSides, int32 InMaxSubdivisions, float InLodDistance)
+{
+	MaxSides = FMath::Clamp(InMaxSides, 3, 64);
+	MaxSubdivisions = FMath::Clamp(InMaxSubdivisions, 1, 16);
+	LodDistance = FMath::Max(InLodDistance, 1.f);
+	MarkRenderStateDirty();
+}
+
+void UAGX_WireTubeComponent::SetNodes(const TArray<FVector>& WorldLocations, float InRadius)
+{
+	const FTransform& ComponentTransform = GetComponentTransform();
+	LocalNodes.Reset(WorldLocations.Num());
+	LocalBox.Init();
+	for (const FVector& WorldLocation : WorldLocations)
+	{
+		const FVector LocalLocation = ComponentTransform.InverseTransformPosition(WorldLocation);
+		LocalNodes.Add(FVector3f(LocalLocation));
+		LocalBox += LocalLocation;
+	}
+
+	Radius = InRadius;
+	SendNodesToRenderThread();
+}
+
+void UAGX_WireTubeComponent::ClearNodes()
+{
+	if (LocalNodes.Num() == 0)
+		return;
+
+	LocalNodes.Reset();
+	LocalBox.Init();
+	SendNodesToRenderThread();
+}
+
+int32 UAGX_WireTubeComponent::GetNumNodes() const
+{
+	return LocalNodes.Num();
+}
+
+void UAGX_WireTubeComponent::SendNodesToRenderThread()
+{
+	UpdateBounds();
+
+	if (SceneProxy == nullptr)
+	{
+		MarkRenderStateDirty();
+		return;
+	}
+
+	// Only the node positions are sent, the scene proxy is kept. The new bounds are sent with the
+	// transform update.
+	MarkRenderTransformDirty();
+	FAGX_WireTubeSceneProxy* Proxy = static_cast<FAGX_WireTubeSceneProxy*>(SceneProxy);
+	ENQUEUE_RENDER_COMMAND(FAGX_WireTubeSetNodes)
+	(
+		[Proxy, Nodes = LocalNodes,
+		 TubeRadius = Radius](FRHICommandListImmediate& RHICmdList) mutable
+		{ Proxy->SetNodes_RenderThread(RHICmdList, MoveTemp(Nodes), TubeRadius); });
+}
+
+FPrimitiveSceneProxy* UAGX_WireTubeComponent::CreateSceneProxy()
+{
+	return new FAGX_WireTubeSceneProxy(this);
+}
+
+int32 UAGX_WireTubeComponent::GetNumMaterials() const
+{
+	return 1;
+}
+
+FBoxSphereBounds UAGX_WireTubeComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+	if (!LocalBox.IsValid)
+		return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0.f);
+
+	// The spline may overshoot the nodes slightly in sharp bends, so add some margin.
+	return FBoxSphereBounds(LocalBox.ExpandBy(2.0 * Radius)).TransformBy(LocalToWorld);
+}
@@ -0,0 +1,14 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "Wire/AGX_WireVisualLod.h"
+
+int32 FAGX_WireVisualLod::GetNodeStride(double ViewDistance) const
+{
+	if (NodeMergeDistance <= 0.0 || ViewDistance < NodeMergeDistance || MaxNodeStride <= 1)
+		return 1;
+
+	// Stride 2 at NodeMergeDistance, doubled at every doubling of the distance.
+	const int32 NumDoublings = FMath::FloorToInt32(FMath::Log2(ViewDistance / NodeMergeDistance));
+	const int32 Stride = 1 << FMath::Clamp(NumDoublings + 1, 1, 30);
+	return FMath::Min(Stride, MaxNodeStride);
+}
@@ -17,6 +17,7 @@
 #include "AGX_RigidBodyComponent.generated.h"
 
 class UAGX_ShapeComponent;
+class UAGX_Simulation;
 
 struct FAGX_ImportContext;
 
@@ -542,6 +543,16 @@ private:
 	// Create the native AGX Dynamics object.
 	void InitializeNative();
 
+	/**
+	 * Create the native AGX Dynamics object, and those of the given Shapes, as a clone of the
+	 * native of the Rigid Body registered for this Rigid Body's template by SpawnInstances.
+	 *
+	 * @return False, without creating anything, if there is no such Rigid Body or if its Shapes
+	 * don't correspond to the given Shapes.
+	 */
+	bool InitializeNativeFromPrototype(
+		const UAGX_Simulation& Simulation, const TArray<UAGX_ShapeComponent*>& Shapes);
+
 	// Set native's MotionControl and ensure Unreal has corresponding mobility.
 	void InitializeMotionControl();
 
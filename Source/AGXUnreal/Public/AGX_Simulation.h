@@ -7,18 +7,22 @@
 #include "Contacts/AGX_ShapeContact.h"
 #include "Contacts/AGX_ContactEnums.h"
 #include "Contacts/ShapeContactBarrier.h"
+#include "Shapes/AGX_ShapeInstancingKey.h"
 #include "SimulationBarrier.h"
+#include "Wire/AGX_WireVisualLod.h"
 
 // Unreal Engine includes.
 #include "Containers/Map.h"
 #include "CoreMinimal.h"
 #include "Engine/EngineTypes.h"
+#include "Engine/World.h"
 #include "Framework/Commands/InputChord.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "AGX_Simulation.generated.h"
 
+class AAGX_ShapeInstanceRenderer;
 class AAGX_Stepper;
 class AAGX_Terrain;
 class UAGX_ConstraintComponent;
@@ -29,12 +33,13 @@ class UAGX_ShovelComponent;
 class UAGX_StaticMeshComponent;
 class UAGX_ShapeComponent;
 class UAGX_TireComponent;
+class UAGX_TrackComponent;
 class UAGX_WireComponent;
 
 class AActor;
 class UActorComponent;
-class UWorld;
 class FShapeBarrier;
+class FShovelBarrier;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPreStepForward, double, Time);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPostStepForward, double, Time);
@@ -52,6 +57,25 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
 	FOnSeparation, double, TimeStamp, UAGX_ShapeComponent*, FirstShape, UAGX_ShapeComponent*,
 	SecondShape);
 
+/**
+ * A per-frame visual synchronization job, run by the Simulation after it has been stepped.
+ *
+ * Prepare runs on the game thread and returns false if there is nothing to do this frame. Extract
+ * runs on a worker thread, in parallel with the Extract of other jobs, and should read native data
+ * into staging buffers owned by the job. It must not modify any UObject or the simulation. Apply
+ * runs on the game thread after all Extract functions have finished and should move the staged
+ * data to components, render resources and the like. Prepare and Apply may add or remove visual
+ * synchronization jobs, for example by destroying a component. Added jobs are first run the next
+ * frame and removed jobs are not run again. Extract must not add or remove jobs.
+ */
+struct FAGX_VisualSyncJob
+{
+	TWeakObjectPtr<const UObject> Owner;
+	TFunction<bool()> Prepare;
+	TFunction<void()> Extract;
+	TFunction<void()> Apply;
+};
+
 /**
  * Manages an AGX simulation instance.
  *
@@ -208,6 +232,24 @@ public: // Properties.
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Simulation")
 	bool bEnableGlobalContactEventListener {true};
 
+	/**
+	 * Set to true to initialize a level's AGX Dynamics objects in two phases.
+	 *
+	 * First, once the level's actors have been initialized, the expensive data the native objects
+	 * are created from is prepared in parallel on worker threads. That is the triangle data of
+	 * Trimesh Shapes and the heights of Height Field Shapes and Terrains. Then, during Begin Play,
+	 * the native objects are created on the game thread from the prepared data. Rigid Bodies and
+	 * Shapes are not added to the simulation one by one but in a single pass when the level has
+	 * begun play, or earlier if something that may reference them, such as a Constraint or a
+	 * Wire, is added.
+	 *
+	 * Wires and Constraints are not prepared in parallel since they are created from the natives
+	 * of the Rigid Bodies they are attached to. Trimeshes whose triangle data is only available
+	 * in GPU memory, or that use a Collision Data Asset, are also not prepared in parallel.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Startup")
+	bool bParallelNativePreparation {true};
+
 	/**
 	 * If enabled, whenever a Blueprint Asset from an imported OpenPLX file is deleted, the
 	 * corresponding OpenPLX files located in Project/OpenPLXModels used by that Blueprint is
@@ -338,6 +380,40 @@ public: // Properties.
 		Meta = (ClampMin = "0.0", UIMin = "0.0"))
 	float ConstraintVisualizationScalingDistanceMax = 400.f;
 
+	/**
+	 * Whether or not Wire Components should reduce how often and how detailed their visuals are
+	 * updated during Play. Individual Wire Components may override the Wire Visual LOD settings.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Rendering")
+	bool bEnableWireVisualLod {false};
+
+	/**
+	 * The Wire Visual LOD settings used by all Wire Components that don't override them.
+	 */
+	UPROPERTY(
+		Config, EditAnywhere, BlueprintReadOnly, Category = "Rendering",
+		Meta = (EditCondition = "bEnableWireVisualLod"))
+	FAGX_WireVisualLod WireVisualLod;
+
+	/**
+	 * Whether the native data extraction of the visual synchronization done after each Step should
+	 * run in parallel on worker threads. When disabled, which is the default, everything runs on
+	 * the game thread.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Rendering")
+	bool bParallelVisualSync {false};
+
+	/**
+	 * Whether Box, Sphere and Cylinder Shape Components should be rendered as instances of a shared
+	 * Static Mesh per primitive type during Play, instead of one procedural mesh each. Reduces
+	 * the number of draw calls in scenes with many primitive Shapes.
+	 *
+	 * Instanced Shape visuals use the first material of the Shape. Capsules are never instanced
+	 * since their hemispheres cannot be represented by a scaled shared mesh.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Rendering")
+	bool bInstancedShapeVisuals {false};
+
 public: // Member functions.
 	UFUNCTION(BlueprintCallable, Category = "Solver")
 	void SetEnableContactWarmstarting(bool bEnable);
@@ -489,8 +565,17 @@ public: // Member functions.
 	void Add(UAGX_StaticMeshComponent& Body);
 	void Add(AAGX_Terrain& Terrain);
 	void Add(UAGX_TireComponent& Tire);
+	void Add(UAGX_TrackComponent& Track);
 	void Add(UAGX_WireComponent& Wire);
 
+	/**
+	 * Add a Shovel that isn't owned by a Shovel Component, such as the deprecated
+	 * AAGX_Terrain::Shovels.
+	 *
+	 * @return True if the Shovel was added.
+	 */
+	bool Add(FShovelBarrier& Shovel);
+
 	void Remove(UAGX_ConstraintComponent& Constraint);
 	void Remove(UAGX_RigidBodyComponent& Body);
 	void Remove(UAGX_ShapeComponent& Shape);
@@ -501,6 +586,76 @@ public: // Member functions.
 	void Remove(UAGX_TireComponent& Tire);
 	void Remove(UAGX_WireComponent& Wire);
 
+	/**
+	 * Register a visual synchronization job that is run once per frame in which the Simulation has
+	 * been stepped. See FAGX_VisualSyncJob for the rules for each function.
+	 */
+	void AddVisualSyncJob(
+		const UObject& Owner, TFunction<bool()> Prepare, TFunction<void()> Extract,
+		TFunction<void()> Apply);
+
+	/**
+	 * Remove all visual synchronization jobs registered for the given owner.
+	 */
+	void RemoveVisualSyncJobs(const UObject& Owner);
+
+	/**
+	 * Spawn one Actor of the given class at each of the given transforms, with the AGX Dynamics
+	 * setup of all instances done as a batch.
+	 *
+	 * While spawning, Rigid Bodies and Shapes are not added to the AGX Dynamics simulation one by
+	 * one but in a single pass when the last instance has been spawned, or earlier if something
+	 * that may reference them, such as a Constraint, is added. Trimesh Shapes reading the same
+	 * Static Mesh with the same LOD, preprocessing and placement share a single AGX Dynamics
+	 * collision mesh instead of each reading and welding the triangle data.
+	 *
+	 * The first Rigid Body created from each Blueprint template is created, configured and has
+	 * its Shape Materials resolved as usual. The following Rigid Bodies created from the same
+	 * template get a clone of that Rigid Body's native, with all its Shapes, instead, provided
+	 * that neither the Rigid Body nor its Shapes have been modified from the template, for
+	 * example in a Construction Script. Intended for spawning many copies of the same
+	 * Blueprint, for example debris or rocks, within a single frame.
+	 *
+	 * @param ActorClass The class, typically a Blueprint, to spawn instances of.
+	 * @param Transforms One transform per instance to spawn.
+	 * @return The spawned Actors.
+	 */
+	UFUNCTION(
+		BlueprintCallable, Category = "Simulation", Meta = (DeterminesOutputType = "ActorClass"))
+	TArray<AActor*> SpawnInstances(
+		TSubclassOf<AActor> ActorClass, const TArray<FTransform>& Transforms);
+
+	/// @return True while SpawnInstances is running.
+	bool IsSpawningInstances() const;
+
+	/**
+	 * While SpawnInstances is running, find the Shape Component that was first registered with
+	 * the given key. Shape Components whose native only depends on data described by the key may
+	 * share the native data of that Shape Component instead of creating their own.
+	 *
+	 * @return The registered Shape Component, or nullptr if there is none or if SpawnInstances
+	 * isn't running.
+	 */
+	UAGX_ShapeComponent* FindInstancedShapePrototype(const FAGX_ShapeInstancingKey& Key) const;
+
+	/// Register a Shape Component for FindInstancedShapePrototype. Ignored if SpawnInstances isn't
+	/// running.
+	void RegisterInstancedShapePrototype(
+		const FAGX_ShapeInstancingKey& Key, UAGX_ShapeComponent& Shape);
+
+	/**
+	 * While SpawnInstances is running, find the Rigid Body Component that was first registered
+	 * for the given archetype, i.e. the template the Rigid Body Component was created from.
+	 *
+	 * @return The registered Rigid Body Component, or nullptr if there is none or if
+	 * SpawnInstances isn't running.
+	 */
+	UAGX_RigidBodyComponent* FindInstancedBodyPrototype(const UObject& Archetype) const;
+
+	/// Register a Rigid Body Component, by its archetype, for FindInstancedBodyPrototype. Ignored
+	/// if SpawnInstances isn't running.
+	void RegisterInstancedBodyPrototype(UAGX_RigidBodyComponent& Body);
+
 	void Register(UAGX_ContactMaterial& Material);
 	void Unregister(UAGX_ContactMaterial& Material);
 
@@ -514,6 +669,11 @@ public: // Member functions.
 
 	bool HasNative() const;
 
+	/**
+	 * Get the native AGX Dynamics simulation. Rigid Bodies and Shapes whose addition has been
+	 * deferred are added first, so that the returned simulation contains everything that has
+	 * begun play.
+	 */
 	FSimulationBarrier* GetNative();
 	const FSimulationBarrier* GetNative() const;
 
@@ -580,6 +740,12 @@ public: // Member functions.
 	 */
 	void EnsureStepperCreated();
 
+	/**
+	 * Get the actor that renders instanced Shape visuals, spawning it if it does not exist yet.
+	 * Only used when Instanced Shape Visuals is enabled.
+	 */
+	AAGX_ShapeInstanceRenderer* GetOrCreateShapeInstanceRenderer();
+
 	friend class AAGX_Stepper;
 
 private:
@@ -605,6 +771,17 @@ private:
 	 */
 	void OnLevelTransition();
 
+	/**
+	 * Called when all actors in a world have been initialized, but before Begin Play. Runs the
+	 * preparation tasks of the world's Trimesh Shapes, Height Field Shapes and Terrains in
+	 * parallel, and defers the addition of Rigid Bodies and Shapes until OnWorldBeginPlay, if
+	 * bParallelNativePreparation is set.
+	 */
+	void OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params);
+
+	/// Called when all actors in the world prepared by OnWorldInitializedActors have begun play.
+	void OnWorldBeginPlay();
+
 	int32 StepCatchUpImmediately(double DeltaTime);
 	int32 StepCatchUpOverTime(double DeltaTime);
 	int32 StepCatchUpOverTimeCapped(double DeltaTime);
@@ -612,6 +789,7 @@ private:
 
 	void PreStep();
 	void PostStep();
+	void SyncVisuals();
 
 	/**
 	 * Called by AGX Dynamics when two Shapes first touch, if Enable Global Contact Event Listener
@@ -644,6 +822,24 @@ private:
 	void SeparationCallback(
 		double TimeStamp, FAnyShapeBarrier& FirstShape, FAnyShapeBarrier& SecondShape);
 
+	/**
+	 * @return True while the addition of Rigid Bodies and Shapes is deferred, either by
+	 * SpawnInstances or by a level's Begin Play.
+	 */
+	bool IsDeferringAdds() const;
+
+	/**
+	 * Add the Rigid Bodies and Shapes whose addition was deferred, in a single pass through
+	 * FSimulationBarrier. Called before anything that may reference them is added.
+	 */
+	void FlushDeferredAdds();
+
+	/**
+	 * Called first by every Add of an object that may reference Rigid Bodies or Shapes. Ensures
+	 * that there is a Stepper and flushes the deferred adds.
+	 */
+	void PrepareAdd();
+
 	void EnsureValidLicense();
 
 	void SetGravity();
@@ -664,6 +860,24 @@ private:
 	double LastTotalStepTime {0.0};
 
 	TWeakObjectPtr<AAGX_Stepper> Stepper;
+	TWeakObjectPtr<AAGX_ShapeInstanceRenderer> ShapeInstanceRenderer;
+
+	FDelegateHandle WorldInitializedActorsHandle;
+
+	// State used while SpawnInstances is running, or while the world set by
+	// OnWorldInitializedActors begins play. Rigid Bodies and Shapes are collected instead of
+	// being added immediately.
+	int32 SpawnInstancesDepth {0};
+	TWeakObjectPtr<UWorld> BeginPlayWorld;
+	FDelegateHandle WorldBeginPlayHandle;
+	TArray<TWeakObjectPtr<UAGX_RigidBodyComponent>> DeferredBodies;
+	TArray<TWeakObjectPtr<UAGX_ShapeComponent>> DeferredShapes;
+	// Searched linearly since the keys are compared with a tolerance. A SpawnInstances call
+	// typically has only a handful of distinct keys.
+	TArray<TPair<FAGX_ShapeInstancingKey, TWeakObjectPtr<UAGX_ShapeComponent>>>
+		InstancedShapePrototypes;
+	TMap<TWeakObjectPtr<const UObject>, TWeakObjectPtr<UAGX_RigidBodyComponent>>
+		InstancedBodyPrototypes;
 
 	// Record for keeping track of the number of times any Contact Material has been
 	// registered/unregistered. Value is incremented on Register() and decremented on Unregister().
@@ -673,5 +887,13 @@ private:
 	FOnPreStepForwardInternal PreStepForwardInternal;
 	FOnPostStepForwardInternal PostStepForwardInternal;
 
+	// Per-frame visual synchronization, run after stepping.
+	// Jobs added while SyncVisuals runs are kept in PendingVisualSyncJobs until it is done, and
+	// removed jobs only have their Owner cleared, so that indices into VisualSyncJobs remain valid.
+	TArray<FAGX_VisualSyncJob> VisualSyncJobs;
+	TArray<FAGX_VisualSyncJob> PendingVisualSyncJobs;
+	TArray<int32> ActiveVisualSyncJobs;
+	bool bSyncingVisuals {false};
+
 	friend class FAGX_InternalDelegateAccessor;
 };
@@ -4,16 +4,25 @@
 
 // AGX Dynamics for Unreal includes.
 #include "ROS2/AGX_ROS2Messages.h"
+#include "ROS2/AGX_ROS2MessageTypeTraits.h"
 #include "ROS2/ROS2PublisherBarrier.h"
 #include "ROS2/AGX_ROS2Enums.h"
 #include "ROS2/AGX_ROS2Qos.h"
+#include "ROS2/AGX_ROS2TopicHandle.h"
+#include "Sensors/AGX_LidarOutputPositionIntensity.h"
+#include "Sensors/AGX_LidarOutputTypes.h"
+#include "Sensors/AGX_LidarPointCloudFrame.h"
 
 // Unreal Engine includes.
 #include "Components/SceneComponent.h"
 #include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
 
 #include "AGX_ROS2PublisherComponent.generated.h"
 
+class FAGX_ROS2PublishQueue;
+
 /**
  * Class representing a ROS2 Publisher used for sending ROS2 messages.
  * A single ROS2 Publisher Component can be used to send messages on multiple topics and message
@@ -46,12 +55,98 @@ public:
 	UPROPERTY(EditAnywhere, Category = "AGX ROS2")
 	uint8 DomainID {0};
 
+	/**
+	 * Publish messages from a background thread instead of from the Game Thread.
+	 *
+	 * When enabled, the Send functions only queue a copy of the message and return. Conversion to
+	 * the native message and the actual send, which may take several milliseconds for large
+	 * messages such as images and point clouds, is done by a thread owned by this Component.
+	 * Messages are sent in the order they were queued. A return value of true from a Send function
+	 * then means that the message was queued, not that it has been sent.
+	 *
+	 * Send Lidar Output Position Intensity always sends on the Game Thread since the native Lidar
+	 * Output is overwritten by the next step.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX ROS2 Async")
+	bool bAsyncPublish {false};
+
+	/**
+	 * The maximum number of messages waiting to be sent by the background thread. The message
+	 * currently being sent is not counted.
+	 */
+	UPROPERTY(
+		EditAnywhere, Category = "AGX ROS2 Async",
+		Meta = (EditCondition = "bAsyncPublish", ClampMin = "1", UIMin = "1"))
+	int32 AsyncQueueCapacity {16};
+
+	/**
+	 * What to do when a message is sent while the queue is full.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX ROS2 Async", Meta = (EditCondition = "bAsyncPublish"))
+	EAGX_ROS2PublishDropPolicy AsyncDropPolicy {EAGX_ROS2PublishDropPolicy::DropOldest};
+
+	/**
+	 * The number of messages that have been discarded because the queue was full.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX ROS2 Async")
+	int64 GetNumDroppedMessages() const;
+
+	/**
+	 * Block until all queued messages have been sent. Does nothing if Async Publish is disabled.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX ROS2 Async")
+	void FlushAsyncPublish();
+
 	/**
 	 * Returns a Barrier object from the Barrier pool, given the specific Topic.
 	 * If no previous Barrier exists for the passed Topic, a new one is created and stored.
 	 */
 	FROS2PublisherBarrier* GetOrCreateBarrier(EAGX_ROS2MessageType Type, const FString& Topic);
 
+	/**
+	 * Resolve a Topic to a handle that can be used to send messages without a Topic lookup.
+	 * Creates the native Publisher for the Topic if it doesn't exist already. Returns an invalid
+	 * handle if the Topic is empty, if not in Play, or if the Topic is already used with another
+	 * message type.
+	 */
+	FAGX_ROS2TopicHandle GetTopicHandle(EAGX_ROS2MessageType Type, const FString& Topic);
+
+	/**
+	 * Returns the Barrier that the given handle refers to, or nullptr if the handle is invalid.
+	 */
+	FROS2PublisherBarrier* GetBarrier(const FAGX_ROS2TopicHandle& Handle) const;
+
+	/**
+	 * Send any message type through a Topic handle. The message type must match the type the
+	 * handle was created for.
+	 *
+	 * With async publish an rvalue message is moved into the queue, an lvalue message is copied.
+	 */
+	template <typename MessageType>
+	bool Send(const FAGX_ROS2TopicHandle& Handle, MessageType&& Message);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Get sensor_msgs::PointCloud2 Topic Handle"))
+	FAGX_ROS2TopicHandle GetSensorMsgsPointCloud2TopicHandle(const FString& Topic);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Get sensor_msgs::Image Topic Handle"))
+	FAGX_ROS2TopicHandle GetSensorMsgsImageTopicHandle(const FString& Topic);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::PointCloud2 By Handle"))
+	bool SendSensorMsgsPointCloud2ByHandle(
+		const FAGX_SensorMsgsPointCloud2& Message, const FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::Image By Handle"))
+	bool SendSensorMsgsImageByHandle(
+		const FAGX_SensorMsgsImage& Message, const FAGX_ROS2TopicHandle& Handle);
+
 	// AgxMsgs
 
 	UFUNCTION(BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Send agx_msgs::Any"))
@@ -524,6 +619,54 @@ public:
 	bool SendSensorMsgsTimeReference(
 		const FAGX_SensorMsgsTimeReference& Message, const FString& Topic);
 
+	// Lidar
+
+	/**
+	 * Send the current data of a Lidar Output Position Intensity as a sensor_msgs::PointCloud2
+	 * message with the same layout as UAGX_ROS2Utilities::ConvertPositionIntensityData, i.e. x,
+	 * y, z [m] and intensity as floats in ROS2 coordinates.
+	 *
+	 * The data is copied directly from the native Lidar Output into the ROS2 message, which is
+	 * much faster than reading the Output Data and sending it using Send sensor_msgs::PointCloud2.
+	 */
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send Lidar Output Position Intensity", AdvancedDisplay = "FrameId"))
+	bool SendLidarOutputPositionIntensity(
+		UPARAM(ref) FAGX_LidarOutputPositionIntensity& Output, double TimeStamp,
+		const FString& Topic, const FString& FrameId = "");
+
+	/**
+	 * Send Lidar Output Position Intensity Data as a sensor_msgs::PointCloud2 message with the same
+	 * layout as UAGX_ROS2Utilities::ConvertPositionIntensityData, without creating an intermediate
+	 * FAGX_SensorMsgsPointCloud2.
+	 */
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta =
+			(DisplayName = "Send Lidar Output Position Intensity Data",
+			 AdvancedDisplay = "FrameId"))
+	bool SendLidarOutputPositionIntensityData(
+		const TArray<FAGX_LidarOutputPositionIntensityData>& Data, double TimeStamp,
+		const FString& Topic, const FString& FrameId = "");
+
+	/**
+	 * Send a Lidar point cloud frame as a sensor_msgs::PointCloud2 message with the same layout as
+	 * FAGX_ROS2Utilities::ConvertXYZ, written directly into the ROS2 message. With Async Publish
+	 * the frame is shared with the publish thread, not copied.
+	 */
+	bool SendLidarPointCloudFrame(
+		const FAGX_LidarPointCloudFrameRef& Frame, const FString& Topic,
+		const FString& FrameId = "");
+
+	// ~Begin UActorComponent interface.
+	virtual void EndPlay(const EEndPlayReason::Type Reason) override;
+	// ~End UActorComponent interface.
+
+	// ~Begin UObject interface.
+	virtual void BeginDestroy() override;
+	// ~End UObject interface.
+
 private:
 #if WITH_EDITOR
 	// ~Begin UActorComponent interface.
@@ -531,6 +674,58 @@ private:
 	// ~Begin UActorComponent interface.
 #endif
 
-	// Key is the Topic.
-	TMap<FString, FROS2PublisherBarrier> NativeBarriers;
+	template <typename MessageType>
+	bool Send(EAGX_ROS2MessageType Type, const FString& Topic, MessageType&& Message);
+
+	/**
+	 * Run the given send on the publish thread, creating the thread if needed.
+	 */
+	bool EnqueueSend(TUniqueFunction<void()>&& SendFunction);
+
+	void StopAsyncPublish();
+
+	// Barriers are heap allocated so that the publish thread may hold on to them while new Topics
+	// are added. A Topic handle is an index into this array.
+	TArray<TUniquePtr<FROS2PublisherBarrier>> NativeBarriers;
+
+	// Key is the Topic, value is the index into NativeBarriers.
+	TMap<FString, int32> TopicToBarrier;
+
+	// Declared after NativeBarriers so that it is destroyed, and drained, first.
+	TSharedPtr<FAGX_ROS2PublishQueue> PublishQueue;
 };
+
+template <typename MessageType>
+bool UAGX_ROS2PublisherComponent::Send(const FAGX_ROS2TopicHandle& Handle, MessageType&& Message)
+{
+	using FMessage = typename TDecay<MessageType>::Type;
+	constexpr EAGX_ROS2MessageType Type = TAGX_ROS2MessageType<FMessage>::Value;
+	static_assert(
+		Type != EAGX_ROS2MessageType::Invalid,
+		"Send requires a ROS2 message type with an EAGX_ROS2MessageType.");
+
+	FROS2PublisherBarrier* Barrier = GetBarrier(Handle);
+	if (Barrier == nullptr)
+		return false;
+
+	if (!ensureMsgf(
+			Handle.MessageType == Type,
+			TEXT("ROS2 Topic handle message type does not match the type of the message sent.")))
+	{
+		return false;
+	}
+
+	if (!bAsyncPublish)
+		return Barrier->SendMsg(Message);
+
+	return EnqueueSend(
+		[Barrier, Message = FMessage(Forward<MessageType>(Message))]()
+		{ Barrier->SendMsg(Message); });
+}
+
+template <typename MessageType>
+bool UAGX_ROS2PublisherComponent::Send(
+	EAGX_ROS2MessageType Type, const FString& Topic, MessageType&& Message)
+{
+	return Send(GetTopicHandle(Type, Topic), Forward<MessageType>(Message));
+}
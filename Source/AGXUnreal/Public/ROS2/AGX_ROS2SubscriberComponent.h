@@ -46,6 +46,29 @@ public:
 	UPROPERTY(EditAnywhere, Category = "AGX ROS2")
 	uint8 DomainID {0};
 
+	/**
+	 * How received messages are handed out by the Receive functions.
+	 *
+	 * Queued: every message is received, oldest first.
+	 * Latest Only: only the newest message is received and all older messages are discarded. Use
+	 * this for high rate command Topics where only the current value matters, so that a backlog
+	 * cannot build up when the frame rate drops. The History QOS of the native Subscriber is set to
+	 * Keep Last with a depth of 1 for these Topics.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX ROS2")
+	EAGX_ROS2ReceiveMode ReceiveMode {EAGX_ROS2ReceiveMode::Queued};
+
+	/**
+	 * Receive Mode for specific Topics, overriding Receive Mode.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX ROS2")
+	TMap<FString, EAGX_ROS2ReceiveMode> TopicReceiveModes;
+
+	/**
+	 * The Receive Mode used for the given Topic.
+	 */
+	EAGX_ROS2ReceiveMode GetReceiveMode(const FString& Topic) const;
+
 	/**
 	 * Returns a Barrier object from the Barrier pool, given the specific Topic.
 	 * If no previous Barrier exists for the passed Topic, a new one is created and stored.
@@ -58,11 +81,22 @@ public:
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive agx_msgs::Any"))
 	bool ReceiveAgxMsgsAny(FAGX_AgxMsgsAny& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All agx_msgs::Any"))
+	int32 ReceiveAllAgxMsgsAny(TArray<FAGX_AgxMsgsAny>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive agx_msgs::AnySequence"))
 	bool ReceiveAgxMsgsAnySequence(FAGX_AgxMsgsAnySequence& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All agx_msgs::AnySequence"))
+	int32 ReceiveAllAgxMsgsAnySequence(
+		TArray<FAGX_AgxMsgsAnySequence>& OutMessages, const FString& Topic);
+
 	// BuiltinInterfaces
 
 	UFUNCTION(
@@ -70,12 +104,24 @@ public:
 		Meta = (DisplayName = "Receive builtin_interfaces::Time"))
 	bool ReceiveBuiltinInterfacesTime(FAGX_BuiltinInterfacesTime& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All builtin_interfaces::Time"))
+	int32 ReceiveAllBuiltinInterfacesTime(
+		TArray<FAGX_BuiltinInterfacesTime>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive builtin_interfaces::Duration"))
 	bool ReceiveBuiltinInterfacesDuration(
 		FAGX_BuiltinInterfacesDuration& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All builtin_interfaces::Duration"))
+	int32 ReceiveAllBuiltinInterfacesDuration(
+		TArray<FAGX_BuiltinInterfacesDuration>& OutMessages, const FString& Topic);
+
 	// RosgraphMsgs
 
 	UFUNCTION(
@@ -83,143 +129,301 @@ public:
 		Meta = (DisplayName = "Receive rosgraph_msgs::Clock"))
 	bool ReceiveRosgraphMsgsClock(FAGX_RosgraphMsgsClock& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All rosgraph_msgs::Clock"))
+	int32 ReceiveAllRosgraphMsgsClock(
+		TArray<FAGX_RosgraphMsgsClock>& OutMessages, const FString& Topic);
+
 	// StdMsgs
 
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Bool"))
 	bool ReceiveStdMsgsBool(FAGX_StdMsgsBool& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Bool"))
+	int32 ReceiveAllStdMsgsBool(TArray<FAGX_StdMsgsBool>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Byte"))
 	bool ReceiveStdMsgsByte(FAGX_StdMsgsByte& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Byte"))
+	int32 ReceiveAllStdMsgsByte(TArray<FAGX_StdMsgsByte>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::ByteMultiArray"))
 	bool ReceiveStdMsgsByteMultiArray(FAGX_StdMsgsByteMultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::ByteMultiArray"))
+	int32 ReceiveAllStdMsgsByteMultiArray(
+		TArray<FAGX_StdMsgsByteMultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Char"))
 	bool ReceiveStdMsgsChar(FAGX_StdMsgsChar& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Char"))
+	int32 ReceiveAllStdMsgsChar(TArray<FAGX_StdMsgsChar>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::ColorRGBA"))
 	bool ReceiveStdMsgsColorRGBA(FAGX_StdMsgsColorRGBA& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::ColorRGBA"))
+	int32 ReceiveAllStdMsgsColorRGBA(
+		TArray<FAGX_StdMsgsColorRGBA>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Empty"))
 	bool ReceiveStdMsgsEmpty(FAGX_StdMsgsEmpty& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Empty"))
+	int32 ReceiveAllStdMsgsEmpty(TArray<FAGX_StdMsgsEmpty>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Float32"))
 	bool ReceiveStdMsgsFloat32(FAGX_StdMsgsFloat32& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Float32"))
+	int32 ReceiveAllStdMsgsFloat32(TArray<FAGX_StdMsgsFloat32>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Float32MultiArray"))
 	bool ReceiveStdMsgsFloat32MultiArray(
 		FAGX_StdMsgsFloat32MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Float32MultiArray"))
+	int32 ReceiveAllStdMsgsFloat32MultiArray(
+		TArray<FAGX_StdMsgsFloat32MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Float64"))
 	bool ReceiveStdMsgsFloat64(FAGX_StdMsgsFloat64& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Float64"))
+	int32 ReceiveAllStdMsgsFloat64(TArray<FAGX_StdMsgsFloat64>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Float64MultiArray"))
 	bool ReceiveStdMsgsFloat64MultiArray(
 		FAGX_StdMsgsFloat64MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Float64MultiArray"))
+	int32 ReceiveAllStdMsgsFloat64MultiArray(
+		TArray<FAGX_StdMsgsFloat64MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Int16"))
 	bool ReceiveStdMsgsInt16(FAGX_StdMsgsInt16& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int16"))
+	int32 ReceiveAllStdMsgsInt16(TArray<FAGX_StdMsgsInt16>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Int16MultiArray"))
 	bool ReceiveStdMsgsInt16MultiArray(
 		FAGX_StdMsgsInt16MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int16MultiArray"))
+	int32 ReceiveAllStdMsgsInt16MultiArray(
+		TArray<FAGX_StdMsgsInt16MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Int32"))
 	bool ReceiveStdMsgsInt32(FAGX_StdMsgsInt32& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int32"))
+	int32 ReceiveAllStdMsgsInt32(TArray<FAGX_StdMsgsInt32>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Int32MultiArray"))
 	bool ReceiveStdMsgsInt32MultiArray(
 		FAGX_StdMsgsInt32MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int32MultiArray"))
+	int32 ReceiveAllStdMsgsInt32MultiArray(
+		TArray<FAGX_StdMsgsInt32MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Int64"))
 	bool ReceiveStdMsgsInt64(FAGX_StdMsgsInt64& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int64"))
+	int32 ReceiveAllStdMsgsInt64(TArray<FAGX_StdMsgsInt64>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Int64MultiArray"))
 	bool ReceiveStdMsgsInt64MultiArray(
 		FAGX_StdMsgsInt64MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int64MultiArray"))
+	int32 ReceiveAllStdMsgsInt64MultiArray(
+		TArray<FAGX_StdMsgsInt64MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Int8"))
 	bool ReceiveStdMsgsInt8(FAGX_StdMsgsInt8& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int8"))
+	int32 ReceiveAllStdMsgsInt8(TArray<FAGX_StdMsgsInt8>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::Int8MultiArray"))
 	bool ReceiveStdMsgsInt8MultiArray(FAGX_StdMsgsInt8MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Int8MultiArray"))
+	int32 ReceiveAllStdMsgsInt8MultiArray(
+		TArray<FAGX_StdMsgsInt8MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::String"))
 	bool ReceiveStdMsgsString(FAGX_StdMsgsString& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::String"))
+	int32 ReceiveAllStdMsgsString(TArray<FAGX_StdMsgsString>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::UInt16"))
 	bool ReceiveStdMsgsUInt16(FAGX_StdMsgsUInt16& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt16"))
+	int32 ReceiveAllStdMsgsUInt16(TArray<FAGX_StdMsgsUInt16>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::UInt16MultiArray"))
 	bool ReceiveStdMsgsUInt16MultiArray(
 		FAGX_StdMsgsUInt16MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt16MultiArray"))
+	int32 ReceiveAllStdMsgsUInt16MultiArray(
+		TArray<FAGX_StdMsgsUInt16MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::UInt32"))
 	bool ReceiveStdMsgsUInt32(FAGX_StdMsgsUInt32& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt32"))
+	int32 ReceiveAllStdMsgsUInt32(TArray<FAGX_StdMsgsUInt32>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::UInt32MultiArray"))
 	bool ReceiveStdMsgsUInt32MultiArray(
 		FAGX_StdMsgsUInt32MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt32MultiArray"))
+	int32 ReceiveAllStdMsgsUInt32MultiArray(
+		TArray<FAGX_StdMsgsUInt32MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::UInt64"))
 	bool ReceiveStdMsgsUInt64(FAGX_StdMsgsUInt64& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt64"))
+	int32 ReceiveAllStdMsgsUInt64(TArray<FAGX_StdMsgsUInt64>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::UInt64MultiArray"))
 	bool ReceiveStdMsgsUInt64MultiArray(
 		FAGX_StdMsgsUInt64MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt64MultiArray"))
+	int32 ReceiveAllStdMsgsUInt64MultiArray(
+		TArray<FAGX_StdMsgsUInt64MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::UInt8"))
 	bool ReceiveStdMsgsUInt8(FAGX_StdMsgsUInt8& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt8"))
+	int32 ReceiveAllStdMsgsUInt8(TArray<FAGX_StdMsgsUInt8>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive std_msgs::UInt8MultiArray"))
 	bool ReceiveStdMsgsUInt8MultiArray(
 		FAGX_StdMsgsUInt8MultiArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::UInt8MultiArray"))
+	int32 ReceiveAllStdMsgsUInt8MultiArray(
+		TArray<FAGX_StdMsgsUInt8MultiArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive std_msgs::Header"))
 	bool ReceiveStdMsgsHeader(FAGX_StdMsgsHeader& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All std_msgs::Header"))
+	int32 ReceiveAllStdMsgsHeader(TArray<FAGX_StdMsgsHeader>& OutMessages, const FString& Topic);
+
 	// GeometryMsgs
 
 	UFUNCTION(
@@ -227,163 +431,337 @@ public:
 		Meta = (DisplayName = "Receive geometry_msgs::Vector3"))
 	bool ReceiveGeometryMsgsVector3(FAGX_GeometryMsgsVector3& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Vector3"))
+	int32 ReceiveAllGeometryMsgsVector3(
+		TArray<FAGX_GeometryMsgsVector3>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Quaternion"))
 	bool ReceiveGeometryMsgsQuaternion(
 		FAGX_GeometryMsgsQuaternion& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Quaternion"))
+	int32 ReceiveAllGeometryMsgsQuaternion(
+		TArray<FAGX_GeometryMsgsQuaternion>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Accel"))
 	bool ReceiveGeometryMsgsAccel(FAGX_GeometryMsgsAccel& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Accel"))
+	int32 ReceiveAllGeometryMsgsAccel(
+		TArray<FAGX_GeometryMsgsAccel>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::AccelStamped"))
 	bool ReceiveGeometryMsgsAccelStamped(
 		FAGX_GeometryMsgsAccelStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::AccelStamped"))
+	int32 ReceiveAllGeometryMsgsAccelStamped(
+		TArray<FAGX_GeometryMsgsAccelStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::AccelWithCovariance"))
 	bool ReceiveGeometryMsgsAccelWithCovariance(
 		FAGX_GeometryMsgsAccelWithCovariance& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::AccelWithCovariance"))
+	int32 ReceiveAllGeometryMsgsAccelWithCovariance(
+		TArray<FAGX_GeometryMsgsAccelWithCovariance>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::AccelWithCovarianceStamped"))
 	bool ReceiveGeometryMsgsAccelWithCovarianceStamped(
 		FAGX_GeometryMsgsAccelWithCovarianceStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::AccelWithCovarianceStamped"))
+	int32 ReceiveAllGeometryMsgsAccelWithCovarianceStamped(
+		TArray<FAGX_GeometryMsgsAccelWithCovarianceStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Inertia"))
 	bool ReceiveGeometryMsgsInertia(FAGX_GeometryMsgsInertia& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Inertia"))
+	int32 ReceiveAllGeometryMsgsInertia(
+		TArray<FAGX_GeometryMsgsInertia>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::InertiaStamped"))
 	bool ReceiveGeometryMsgsInertiaStamped(
 		FAGX_GeometryMsgsInertiaStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::InertiaStamped"))
+	int32 ReceiveAllGeometryMsgsInertiaStamped(
+		TArray<FAGX_GeometryMsgsInertiaStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Point"))
 	bool ReceiveGeometryMsgsPoint(FAGX_GeometryMsgsPoint& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Point"))
+	int32 ReceiveAllGeometryMsgsPoint(
+		TArray<FAGX_GeometryMsgsPoint>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Point32"))
 	bool ReceiveGeometryMsgsPoint32(FAGX_GeometryMsgsPoint32& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Point32"))
+	int32 ReceiveAllGeometryMsgsPoint32(
+		TArray<FAGX_GeometryMsgsPoint32>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::PointStamped"))
 	bool ReceiveGeometryMsgsPointStamped(
 		FAGX_GeometryMsgsPointStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::PointStamped"))
+	int32 ReceiveAllGeometryMsgsPointStamped(
+		TArray<FAGX_GeometryMsgsPointStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Polygon"))
 	bool ReceiveGeometryMsgsPolygon(FAGX_GeometryMsgsPolygon& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Polygon"))
+	int32 ReceiveAllGeometryMsgsPolygon(
+		TArray<FAGX_GeometryMsgsPolygon>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::PolygonStamped"))
 	bool ReceiveGeometryMsgsPolygonStamped(
 		FAGX_GeometryMsgsPolygonStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::PolygonStamped"))
+	int32 ReceiveAllGeometryMsgsPolygonStamped(
+		TArray<FAGX_GeometryMsgsPolygonStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Pose"))
 	bool ReceiveGeometryMsgsPose(FAGX_GeometryMsgsPose& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Pose"))
+	int32 ReceiveAllGeometryMsgsPose(
+		TArray<FAGX_GeometryMsgsPose>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Pose2D"))
 	bool ReceiveGeometryMsgsPose2D(FAGX_GeometryMsgsPose2D& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Pose2D"))
+	int32 ReceiveAllGeometryMsgsPose2D(
+		TArray<FAGX_GeometryMsgsPose2D>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::PoseArray"))
 	bool ReceiveGeometryMsgsPoseArray(FAGX_GeometryMsgsPoseArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::PoseArray"))
+	int32 ReceiveAllGeometryMsgsPoseArray(
+		TArray<FAGX_GeometryMsgsPoseArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::PoseStamped"))
 	bool ReceiveGeometryMsgsPoseStamped(
 		FAGX_GeometryMsgsPoseStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::PoseStamped"))
+	int32 ReceiveAllGeometryMsgsPoseStamped(
+		TArray<FAGX_GeometryMsgsPoseStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::PoseWithCovariance"))
 	bool ReceiveGeometryMsgsPoseWithCovariance(
 		FAGX_GeometryMsgsPoseWithCovariance& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::PoseWithCovariance"))
+	int32 ReceiveAllGeometryMsgsPoseWithCovariance(
+		TArray<FAGX_GeometryMsgsPoseWithCovariance>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::PoseWithCovarianceStamped"))
 	bool ReceiveGeometryMsgsPoseWithCovarianceStamped(
 		FAGX_GeometryMsgsPoseWithCovarianceStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::PoseWithCovarianceStamped"))
+	int32 ReceiveAllGeometryMsgsPoseWithCovarianceStamped(
+		TArray<FAGX_GeometryMsgsPoseWithCovarianceStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::QuaternionStamped"))
 	bool ReceiveGeometryMsgsQuaternionStamped(
 		FAGX_GeometryMsgsQuaternionStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::QuaternionStamped"))
+	int32 ReceiveAllGeometryMsgsQuaternionStamped(
+		TArray<FAGX_GeometryMsgsQuaternionStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Transform"))
 	bool ReceiveGeometryMsgsTransform(FAGX_GeometryMsgsTransform& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Transform"))
+	int32 ReceiveAllGeometryMsgsTransform(
+		TArray<FAGX_GeometryMsgsTransform>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::TransformStamped"))
 	bool ReceiveGeometryMsgsTransformStamped(
 		FAGX_GeometryMsgsTransformStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::TransformStamped"))
+	int32 ReceiveAllGeometryMsgsTransformStamped(
+		TArray<FAGX_GeometryMsgsTransformStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Twist"))
 	bool ReceiveGeometryMsgsTwist(FAGX_GeometryMsgsTwist& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Twist"))
+	int32 ReceiveAllGeometryMsgsTwist(
+		TArray<FAGX_GeometryMsgsTwist>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::TwistStamped"))
 	bool ReceiveGeometryMsgsTwistStamped(
 		FAGX_GeometryMsgsTwistStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::TwistStamped"))
+	int32 ReceiveAllGeometryMsgsTwistStamped(
+		TArray<FAGX_GeometryMsgsTwistStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::TwistWithCovariance"))
 	bool ReceiveGeometryMsgsTwistWithCovariance(
 		FAGX_GeometryMsgsTwistWithCovariance& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::TwistWithCovariance"))
+	int32 ReceiveAllGeometryMsgsTwistWithCovariance(
+		TArray<FAGX_GeometryMsgsTwistWithCovariance>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::TwistWithCovarianceStamped"))
 	bool ReceiveGeometryMsgsTwistWithCovarianceStamped(
 		FAGX_GeometryMsgsTwistWithCovarianceStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::TwistWithCovarianceStamped"))
+	int32 ReceiveAllGeometryMsgsTwistWithCovarianceStamped(
+		TArray<FAGX_GeometryMsgsTwistWithCovarianceStamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Vector3Stamped"))
 	bool ReceiveGeometryMsgsVector3Stamped(
 		FAGX_GeometryMsgsVector3Stamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Vector3Stamped"))
+	int32 ReceiveAllGeometryMsgsVector3Stamped(
+		TArray<FAGX_GeometryMsgsVector3Stamped>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::Wrench"))
 	bool ReceiveGeometryMsgsWrench(FAGX_GeometryMsgsWrench& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::Wrench"))
+	int32 ReceiveAllGeometryMsgsWrench(
+		TArray<FAGX_GeometryMsgsWrench>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive geometry_msgs::WrenchStamped"))
 	bool ReceiveGeometryMsgsWrenchStamped(
 		FAGX_GeometryMsgsWrenchStamped& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All geometry_msgs::WrenchStamped"))
+	int32 ReceiveAllGeometryMsgsWrenchStamped(
+		TArray<FAGX_GeometryMsgsWrenchStamped>& OutMessages, const FString& Topic);
+
 	// SensorMsgs
 
 	UFUNCTION(
@@ -392,145 +770,305 @@ public:
 	bool ReceiveSensorMsgsBatteryState(
 		FAGX_SensorMsgsBatteryState& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::BatteryState"))
+	int32 ReceiveAllSensorMsgsBatteryState(
+		TArray<FAGX_SensorMsgsBatteryState>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::ChannelFloat32"))
 	bool ReceiveSensorMsgsChannelFloat32(
 		FAGX_SensorMsgsChannelFloat32& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::ChannelFloat32"))
+	int32 ReceiveAllSensorMsgsChannelFloat32(
+		TArray<FAGX_SensorMsgsChannelFloat32>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::CompressedImage"))
 	bool ReceiveSensorMsgsCompressedImage(
 		FAGX_SensorMsgsCompressedImage& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::CompressedImage"))
+	int32 ReceiveAllSensorMsgsCompressedImage(
+		TArray<FAGX_SensorMsgsCompressedImage>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::FluidPressure"))
 	bool ReceiveSensorMsgsFluidPressure(
 		FAGX_SensorMsgsFluidPressure& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::FluidPressure"))
+	int32 ReceiveAllSensorMsgsFluidPressure(
+		TArray<FAGX_SensorMsgsFluidPressure>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::Illuminance"))
 	bool ReceiveSensorMsgsIlluminance(FAGX_SensorMsgsIlluminance& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::Illuminance"))
+	int32 ReceiveAllSensorMsgsIlluminance(
+		TArray<FAGX_SensorMsgsIlluminance>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::Image"))
 	bool ReceiveSensorMsgsImage(FAGX_SensorMsgsImage& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::Image"))
+	int32 ReceiveAllSensorMsgsImage(
+		TArray<FAGX_SensorMsgsImage>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive sensor_msgs::Imu"))
 	bool ReceiveSensorMsgsImu(FAGX_SensorMsgsImu& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::Imu"))
+	int32 ReceiveAllSensorMsgsImu(TArray<FAGX_SensorMsgsImu>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::JointState"))
 	bool ReceiveSensorMsgsJointState(FAGX_SensorMsgsJointState& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::JointState"))
+	int32 ReceiveAllSensorMsgsJointState(
+		TArray<FAGX_SensorMsgsJointState>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Receive sensor_msgs::Joy"))
 	bool ReceiveSensorMsgsJoy(FAGX_SensorMsgsJoy& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::Joy"))
+	int32 ReceiveAllSensorMsgsJoy(TArray<FAGX_SensorMsgsJoy>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::JoyFeedback"))
 	bool ReceiveSensorMsgsJoyFeedback(FAGX_SensorMsgsJoyFeedback& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::JoyFeedback"))
+	int32 ReceiveAllSensorMsgsJoyFeedback(
+		TArray<FAGX_SensorMsgsJoyFeedback>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::JoyFeedbackArray"))
 	bool ReceiveSensorMsgsJoyFeedbackArray(
 		FAGX_SensorMsgsJoyFeedbackArray& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::JoyFeedbackArray"))
+	int32 ReceiveAllSensorMsgsJoyFeedbackArray(
+		TArray<FAGX_SensorMsgsJoyFeedbackArray>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::LaserEcho"))
 	bool ReceiveSensorMsgsLaserEcho(FAGX_SensorMsgsLaserEcho& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::LaserEcho"))
+	int32 ReceiveAllSensorMsgsLaserEcho(
+		TArray<FAGX_SensorMsgsLaserEcho>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::LaserScan"))
 	bool ReceiveSensorMsgsLaserScan(FAGX_SensorMsgsLaserScan& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::LaserScan"))
+	int32 ReceiveAllSensorMsgsLaserScan(
+		TArray<FAGX_SensorMsgsLaserScan>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::MagneticField"))
 	bool ReceiveSensorMsgsMagneticField(
 		FAGX_SensorMsgsMagneticField& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::MagneticField"))
+	int32 ReceiveAllSensorMsgsMagneticField(
+		TArray<FAGX_SensorMsgsMagneticField>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::MultiDOFJointState"))
 	bool ReceiveSensorMsgsMultiDOFJointState(
 		FAGX_SensorMsgsMultiDOFJointState& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::MultiDOFJointState"))
+	int32 ReceiveAllSensorMsgsMultiDOFJointState(
+		TArray<FAGX_SensorMsgsMultiDOFJointState>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::MultiEchoLaserScan"))
 	bool ReceiveSensorMsgsMultiEchoLaserScan(
 		FAGX_SensorMsgsMultiEchoLaserScan& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::MultiEchoLaserScan"))
+	int32 ReceiveAllSensorMsgsMultiEchoLaserScan(
+		TArray<FAGX_SensorMsgsMultiEchoLaserScan>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::NavSatStatus"))
 	bool ReceiveSensorMsgsNavSatStatus(
 		FAGX_SensorMsgsNavSatStatus& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::NavSatStatus"))
+	int32 ReceiveAllSensorMsgsNavSatStatus(
+		TArray<FAGX_SensorMsgsNavSatStatus>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::NavSatFix"))
 	bool ReceiveSensorMsgsNavSatFix(FAGX_SensorMsgsNavSatFix& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::NavSatFix"))
+	int32 ReceiveAllSensorMsgsNavSatFix(
+		TArray<FAGX_SensorMsgsNavSatFix>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::PointCloud"))
 	bool ReceiveSensorMsgsPointCloud(FAGX_SensorMsgsPointCloud& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::PointCloud"))
+	int32 ReceiveAllSensorMsgsPointCloud(
+		TArray<FAGX_SensorMsgsPointCloud>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::PointField"))
 	bool ReceiveSensorMsgsPointField(FAGX_SensorMsgsPointField& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::PointField"))
+	int32 ReceiveAllSensorMsgsPointField(
+		TArray<FAGX_SensorMsgsPointField>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::PointCloud2"))
 	bool ReceiveSensorMsgsPointCloud2(FAGX_SensorMsgsPointCloud2& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::PointCloud2"))
+	int32 ReceiveAllSensorMsgsPointCloud2(
+		TArray<FAGX_SensorMsgsPointCloud2>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::Range"))
 	bool ReceiveSensorMsgsRange(FAGX_SensorMsgsRange& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::Range"))
+	int32 ReceiveAllSensorMsgsRange(
+		TArray<FAGX_SensorMsgsRange>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::RegionOfInterest"))
 	bool ReceiveSensorMsgsRegionOfInterest(
 		FAGX_SensorMsgsRegionOfInterest& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::RegionOfInterest"))
+	int32 ReceiveAllSensorMsgsRegionOfInterest(
+		TArray<FAGX_SensorMsgsRegionOfInterest>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::CameraInfo"))
 	bool ReceiveSensorMsgsCameraInfo(FAGX_SensorMsgsCameraInfo& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::CameraInfo"))
+	int32 ReceiveAllSensorMsgsCameraInfo(
+		TArray<FAGX_SensorMsgsCameraInfo>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::RelativeHumidity"))
 	bool ReceiveSensorMsgsRelativeHumidity(
 		FAGX_SensorMsgsRelativeHumidity& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::RelativeHumidity"))
+	int32 ReceiveAllSensorMsgsRelativeHumidity(
+		TArray<FAGX_SensorMsgsRelativeHumidity>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::Temperature"))
 	bool ReceiveSensorMsgsTemperature(FAGX_SensorMsgsTemperature& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::Temperature"))
+	int32 ReceiveAllSensorMsgsTemperature(
+		TArray<FAGX_SensorMsgsTemperature>& OutMessages, const FString& Topic);
+
 	UFUNCTION(
 		BlueprintCallable, Category = "AGX ROS2",
 		Meta = (DisplayName = "Receive sensor_msgs::TimeReference"))
 	bool ReceiveSensorMsgsTimeReference(
 		FAGX_SensorMsgsTimeReference& OutMessage, const FString& Topic);
 
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive All sensor_msgs::TimeReference"))
+	int32 ReceiveAllSensorMsgsTimeReference(
+		TArray<FAGX_SensorMsgsTimeReference>& OutMessages, const FString& Topic);
+
 private:
 #if WITH_EDITOR
 	// ~Begin UActorComponent interface.
@@ -538,6 +1076,20 @@ private:
 	// ~Begin UActorComponent interface.
 #endif
 
+	/**
+	 * Receive a single message according to the Receive Mode of the Topic.
+	 */
+	template <typename MessageType>
+	bool Receive(EAGX_ROS2MessageType Type, const FString& Topic, MessageType& OutMessage);
+
+	/**
+	 * Receive all waiting messages into the given array, replacing its content but reusing its
+	 * allocation. With Receive Mode Latest Only at most one message is received.
+	 */
+	template <typename MessageType>
+	int32 ReceiveAll(
+		EAGX_ROS2MessageType Type, const FString& Topic, TArray<MessageType>& OutMessages);
+
 	// Key is the Topic.
 	TMap<FString, FROS2SubscriberBarrier> NativeBarriers;
 };
@@ -0,0 +1,32 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "ROS2/AGX_ROS2Enums.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+#include "AGX_ROS2TopicHandle.generated.h"
+
+/**
+ * A pre-resolved Topic of a ROS2 Publisher Component.
+ *
+ * Sending through a handle avoids looking up the Topic string on every send. A handle is only valid
+ * for the ROS2 Publisher Component that created it, and only during the Play session in which it
+ * was created.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_ROS2TopicHandle
+{
+	GENERATED_BODY()
+
+	int32 Index {INDEX_NONE};
+	EAGX_ROS2MessageType MessageType {EAGX_ROS2MessageType::Invalid};
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+};
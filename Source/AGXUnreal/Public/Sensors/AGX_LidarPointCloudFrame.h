@@ -0,0 +1,115 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * A compact, single precision point cloud produced by a Lidar Sensor.
+ *
+ * Only hits are stored, one entry per point in each array. Positions are in the Lidar's local
+ * coordinate system [cm]. Frames are reference counted and handed out by a
+ * FAGX_LidarPointCloudFramePool, which reuses the memory of a frame once the last reference to it
+ * has been released. A frame must not be modified after it has been handed to listeners.
+ */
+struct AGXUNREAL_API FAGX_LidarPointCloudFrame
+{
+	/// The time stamp of the first point in the frame [s].
+	double TimeStamp {0.0};
+
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+	TArray<float> Intensity;
+
+	/// Per-point time relative to TimeStamp [s].
+	TArray<float> TimeOffset;
+
+	/// The row, or ring, and column of the ray that produced each point. Only filled if requested
+	/// from the Lidar Sensor, empty otherwise.
+	TArray<uint16> Ring;
+	TArray<uint16> Column;
+
+	int32 Num() const
+	{
+		return X.Num();
+	}
+
+	bool HasRayIndices() const
+	{
+		return Ring.Num() == Num() && Column.Num() == Num();
+	}
+
+	/// Reserve room for the given number of points.
+	void Reserve(int32 NumPoints, bool bRayIndices);
+
+	/// Add a point. Reserve should be called first.
+	void Add(const FVector& Position, float InIntensity, float InTimeOffset)
+	{
+		X.Add(static_cast<float>(Position.X));
+		Y.Add(static_cast<float>(Position.Y));
+		Z.Add(static_cast<float>(Position.Z));
+		Intensity.Add(InIntensity);
+		TimeOffset.Add(InTimeOffset);
+	}
+
+	/**
+	 * Add the given number of points at the end without initializing them, so that they can be
+	 * written by index, possibly from several threads.
+	 *
+	 * @return The index of the first added point.
+	 */
+	int32 AddUninitialized(int32 NumPoints, bool bRayIndices);
+
+	/**
+	 * Remove the points from First to the end for which Keep is zero, keeping the order of the
+	 * remaining points. Used to drop misses after AddUninitialized. Keeps the allocated memory.
+	 */
+	void Compact(int32 First, TConstArrayView<uint8> Keep);
+
+	/**
+	 * Add all points of Other at the end, with their time offsets made relative to this frame's
+	 * time stamp. The ray indices are kept only if both frames have them.
+	 */
+	void Append(const FAGX_LidarPointCloudFrame& Other);
+
+	/// Remove all points but keep the allocated memory.
+	void Reset();
+};
+
+using FAGX_LidarPointCloudFrameRef =
+	TSharedRef<const FAGX_LidarPointCloudFrame, ESPMode::ThreadSafe>;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FAGX_OnLidarPointCloudFrame, const FAGX_LidarPointCloudFrameRef& /*Frame*/);
+
+/**
+ * Hands out point cloud frames whose memory is returned to the pool, instead of being freed, when
+ * the last reference to the frame is released. May be used from any thread.
+ */
+class AGXUNREAL_API FAGX_LidarPointCloudFramePool
+	: public TSharedFromThis<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe>
+{
+public:
+	/**
+	 * @param InMaxFreeFrames The maximum number of unused frames kept in the pool. Frames released
+	 * when the pool is full are freed.
+	 */
+	explicit FAGX_LidarPointCloudFramePool(int32 InMaxFreeFrames = 4);
+	~FAGX_LidarPointCloudFramePool();
+
+	/// Get an empty frame, reusing the memory of a previously released frame if possible.
+	TSharedRef<FAGX_LidarPointCloudFrame, ESPMode::ThreadSafe> Acquire();
+
+	int32 GetNumFree() const;
+
+private:
+	void Release(FAGX_LidarPointCloudFrame* Frame);
+
+	mutable FCriticalSection Lock;
+	TArray<FAGX_LidarPointCloudFrame*> FreeFrames;
+	int32 MaxFreeFrames;
+};
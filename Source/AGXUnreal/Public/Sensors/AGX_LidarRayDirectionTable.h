@@ -0,0 +1,86 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Sensors/AGX_LidarLineTraceEnums.h"
+
+// Unreal Engine includes.
+#include "Containers/ContainerAllocationPolicies.h"
+#include "CoreMinimal.h"
+
+/**
+ * The local ray directions of a line trace Lidar scan pattern, one entry per ray in scan order.
+ *
+ * The directions are given in the Lidar's local coordinate system, x forward, y right and z up.
+ * Each coordinate is stored in its own aligned array so that a range of rays can be transformed
+ * to world space with a few tight loops instead of per-ray trigonometry.
+ *
+ * The table only depends on FOV, Resolution and Scan Pattern and is rebuilt by the Lidar when any
+ * of them change.
+ */
+struct AGXUNREAL_API FAGX_LidarRayDirectionTable
+{
+	using FAlignedFloatArray = TArray<float, TAlignedHeapAllocator<16>>;
+
+	FAlignedFloatArray X;
+	FAlignedFloatArray Y;
+	FAlignedFloatArray Z;
+
+	/// The number of rays along the horizontal and vertical directions of the FOV.
+	int32 NumRaysX {0};
+	int32 NumRaysY {0};
+
+	FVector2D FOV {FVector2D::ZeroVector};
+	FVector2D Resolution {FVector2D::ZeroVector};
+	EAGX_LidarLineTraceScanPattern ScanPattern {EAGX_LidarLineTraceScanPattern::HorizontalSweep};
+
+	/// Recompute the table for the given scan pattern parameters.
+	void Build(
+		const FVector2D& InFOV, const FVector2D& InResolution,
+		EAGX_LidarLineTraceScanPattern InScanPattern);
+
+	/// @return True if the table was built for the given scan pattern parameters.
+	bool IsValidFor(
+		const FVector2D& InFOV, const FVector2D& InResolution,
+		EAGX_LidarLineTraceScanPattern InScanPattern) const;
+
+	int32 Num() const
+	{
+		return X.Num();
+	}
+
+	/// The horizontal and vertical ray index, i.e. column and row, of the given ray.
+	void GetRayIndices(int32 Ray, int32& OutIndexX, int32& OutIndexY) const
+	{
+		if (ScanPattern == EAGX_LidarLineTraceScanPattern::VerticalSweep)
+		{
+			OutIndexX = Ray % NumRaysX;
+			OutIndexY = Ray / NumRaysX;
+		}
+		else
+		{
+			OutIndexX = Ray / NumRaysY;
+			OutIndexY = Ray % NumRaysY;
+		}
+	}
+
+	/**
+	 * Find the range of horizontal and vertical ray indices whose angles lie within the given
+	 * windows [deg]. The ranges are inclusive and empty, i.e. Min > Max, if no ray is inside.
+	 */
+	void GetWindowIndexRanges(
+		const FVector2D& WindowX, const FVector2D& WindowY, FIntPoint& OutRangeX,
+		FIntPoint& OutRangeY) const;
+
+	/// The horizontal and vertical angle [deg] of the ray with the given indices.
+	double GetAngleX(int32 IndexX) const
+	{
+		return -FOV.X / 2.0 + Resolution.X * static_cast<double>(IndexX);
+	}
+
+	double GetAngleY(int32 IndexY) const
+	{
+		return -FOV.Y / 2.0 + Resolution.Y * static_cast<double>(IndexY);
+	}
+};
@@ -5,6 +5,8 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_Real.h"
 #include "Sensors/AGX_LidarLineTraceEnums.h"
+#include "Sensors/AGX_LidarPointCloudFrame.h"
+#include "Sensors/AGX_LidarRayDirectionTable.h"
 #include "Sensors/AGX_LidarScanPoint.h"
 
 // Unreal Engine includes.
@@ -13,6 +15,7 @@
 
 class UTextureRenderTarget2D;
 
+struct FAGX_LidarPendingScan;
 struct FAGX_SensorMsgsPointCloud2;
 
 #include "AGX_LidarSensorLineTraceComponent.generated.h"
@@ -77,6 +80,23 @@ public:
 			 ExposeOnSpawn))
 	double OutputFrequency {20};
 
+	/**
+	 * Whether the line traces of automatic scans should run in the background instead of blocking
+	 * the end of the simulation step.
+	 *
+	 * When enabled, the line traces for a step are run in chunks on worker threads by a background
+	 * task while the game thread continues. The scan is completed at the start of the next step,
+	 * so the point cloud data is delayed by one step. Scans still in progress when the Lidar
+	 * Sensor is disabled are dropped.
+	 * Only used in ExecutionMode Auto.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Lidar",
+		Meta =
+			(EditCondition = "ExecutionMode == EAGX_LidarLineTraceExecutonMode::Auto",
+			 ExposeOnSpawn))
+	bool bAsyncScan {false};
+
 	/**
 	 * Delegate that is executed each time the Lidar Sensor outputs point cloud data.
 	 * The OutputFrequency determines how often this delegate is executed in ExecutionMode Auto.
@@ -94,6 +114,25 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "AGX Lidar")
 	FOnPointCloudDataOutput PointCloudDataOutput;
 
+	/**
+	 * Native counterpart to PointCloudDataOutput, executed right before it with the same points.
+	 *
+	 * The frame only contains hits, stored in a compact single precision layout, and may be kept by
+	 * listeners after the broadcast, for example to be converted or recorded on another thread.
+	 * Frames are taken from a pool and their memory is reused once all references are released,
+	 * so listeners should not keep frames longer than needed.
+	 *
+	 * The frame is only created if something is bound to this delegate.
+	 */
+	FAGX_OnLidarPointCloudFrame PointCloudFrameOutput;
+
+	/**
+	 * Whether the frames passed to Point Cloud Frame Output should include the ring, i.e. row, and
+	 * column of the ray that produced each point.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Lidar", AdvancedDisplay)
+	bool bPointCloudFrameRayIndices {false};
+
 	/**
 	 * Determines in what order points are scanned during a scan cycle.
 	 */
@@ -238,9 +277,32 @@ private:
 	// Buffer for storing scan data until the next data output is run.
 	TArray<FAGX_LidarScanPoint> Buffer;
 
+	// Memory for the frames passed to PointCloudFrameOutput.
+	TSharedPtr<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe> FramePool;
+
+	// The frame scans write their hits to until the next data output, if PointCloudFrameOutput is
+	// bound.
+	TSharedPtr<FAGX_LidarPointCloudFrame, ESPMode::ThreadSafe> OutputFrame;
+	bool bOutputFrameRayIndices {false};
+
+	// Local ray directions for the current FOV, Resolution and Scan Pattern.
+	FAGX_LidarRayDirectionTable RayDirections;
+
+	// The async scan started by the previous step, if any. See StartAsyncScan.
+	TSharedPtr<FAGX_LidarPendingScan> PendingScan;
+
 	bool CheckValid() const;
 	void OnStepForward(double TimeStamp);
 	void UpdateElapsedTime(double TimeStamp);
 	void ScanAutoCPU();
+	void StartAsyncScan(
+		const FTransform& Origin, double FractionStart, double FractionEnd,
+		double BeamExitRadius, double BeamDivergenceRad);
+	void CompletePendingScan();
+	void DropPendingScan();
+	const FAGX_LidarRayDirectionTable& GetRayDirections();
 	void OutputPointCloudDataIfReady();
+	void BroadcastBuffer();
+	bool ShouldFillBuffer() const;
+	FAGX_LidarPointCloudFrame* GetOutputFrame();
 };
@@ -6,8 +6,10 @@
 #include "Sensors/SensorEnvironmentBarrier.h"
 #include "Sensors/AGX_LidarSensorReference.h"
 #include "Sensors/AGX_ShapeInstanceData.h"
+#include "Shapes/AGX_MeshPreprocessingSettings.h"
 
 // Unreal Engine includes.
+#include "Components/SceneComponent.h"
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 
@@ -59,6 +61,39 @@ public:
 		Meta = (EditCondition = "bAutoAddObjects"))
 	bool bIgnoreInvisibleObjects {true};
 
+	/**
+	 * Objects are added when they get this far outside the Max Range of a Lidar [cm], so that they
+	 * are ready to be detected once within range. Mostly useful together with Add Objects Async.
+	 * Zero adds objects when they get within Max Range.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Sensor Environment",
+		Meta = (EditCondition = "bAutoAddObjects", ClampMin = "0.0", UIMin = "0.0"))
+	double PrefetchDistance {0.0};
+
+	/**
+	 * If set to true, the triangle data of Static Meshes that gets within the range of a Lidar is
+	 * read on a background task, and the object is added to this Environment once ready. This
+	 * avoids hitches when many new objects get within range at the same time.
+	 * Instanced Static Meshes and objects added using any of the Add... functions are always added
+	 * immediately. In cooked builds, Static Meshes that don't allow CPU access are also added
+	 * immediately since their triangle data can only be read on the Game Thread.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Sensor Environment", AdvancedDisplay,
+		Meta = (EditCondition = "bAutoAddObjects"))
+	bool bAddObjectsAsync {false};
+
+	/**
+	 * The maximum time per Tick spent creating raytrace shapes from triangle data read on a
+	 * background task [ms]. Shapes that don't fit within the budget are created in later Ticks.
+	 * At least one shape is created per Tick.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Sensor Environment", AdvancedDisplay,
+		Meta = (EditCondition = "bAutoAddObjects && bAddObjectsAsync", ClampMin = "0.0"))
+	float AsyncAddTimeBudget {2.f};
+
 	/**
 	 * Default LOD index used when reading Meshes that are added to this Environment.
 	 * If set to a negative value, the highest valid LOD index is used (lowest resolution).
@@ -68,6 +103,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AGX Sensor Environment")
 	int32 DefaultLODIndex {-1};
 
+	/**
+	 * Clean-up and simplification applied to the triangle data read from Static Meshes that are
+	 * added to this Environment, before the raytrace shape is created.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AGX Sensor Environment", AdvancedDisplay)
+	FAGX_MeshPreprocessingSettings MeshPreprocessing;
+
 	/**
 	 * The Ambient material used by the Sensor Environment.
 	 * This is used to simulate atmospheric effects on the Lidar laser rays, such as rain or fog.
@@ -82,6 +124,7 @@ public:
 	 * As an optimization, this can be disabled by setting this property to false. Note that any
 	 * transformation change of an Instanced Static Mesh Instance during Play will not be reflected
 	 * in the Lidar simulation.
+	 * Instanced Static Meshes with Static mobility are never updated.
 	 */
 	UPROPERTY(
 		EditAnywhere, BlueprintReadWrite, Category = "AGX Sensor Environment", AdvancedDisplay)
@@ -230,24 +273,45 @@ private:
 	void UpdateTrackedLidars();
 	void UpdateTrackedMeshes();
 	void UpdateTrackedInstancedMeshes();
-	void UpdateTrackedAGXMeshes();
 	void UpdateAmbientMaterial();
 	void TickTrackedLidars() const;
 
-	bool AddMesh(
-		UStaticMeshComponent* Mesh, const TArray<FVector>& Vertices,
-		const TArray<FTriIndices>& Indices);
+	/**
+	 * Get the raytrace shape for the Static Mesh asset and LOD used by the given component, creating
+	 * it if no other tracked component currently uses it. Returns nullptr if the triangle data could
+	 * not be read.
+	 */
+	TSharedPtr<FRtShapeBarrier> GetOrCreateSharedShape(UStaticMeshComponent& Mesh, int32 Lod);
+
+	/**
+	 * Add the Static Mesh Component once its raytrace shape has been created. The triangle data is
+	 * read on a background task unless a shape for the asset already exists.
+	 */
+	bool AddMeshAsync(UStaticMeshComponent& Mesh);
+	void UpdatePendingMeshes();
+	void ClearPendingMeshes();
+
+	bool AddMesh(UStaticMeshComponent* Mesh, const TSharedPtr<FRtShapeBarrier>& Shape);
 
 	bool AddMesh(
 		UAGX_SimpleMeshComponent* Mesh, const TArray<FVector>& Vertices,
 		const TArray<FTriIndices>& Indices);
 
 	bool AddInstancedMesh(
-		UInstancedStaticMeshComponent* Mesh, const TArray<FVector>& Vertices,
-		const TArray<FTriIndices>& Indices);
+		UInstancedStaticMeshComponent* Mesh, const TSharedPtr<FRtShapeBarrier>& Shape);
 
 	bool AddInstancedMeshInstance_Internal(UInstancedStaticMeshComponent* Mesh, int32 Index);
 
+	/**
+	 * Movable tracked meshes report transform changes through their TransformUpdated event and are
+	 * synchronized once per Tick. Meshes with Static mobility are not listened to until their
+	 * mobility is changed.
+	 */
+	void ListenToTransformUpdates(USceneComponent& Mesh, FAGX_RtShapeInstanceData& Data);
+	void OnTrackedMeshTransformUpdated(
+		USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags,
+		ETeleportType Teleport);
+
 	UFUNCTION()
 	void OnLidarBeginOverlapComponent(
 		UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
@@ -275,5 +339,21 @@ private:
 		TrackedInstancedMeshes;
 	TMap<TWeakObjectPtr<UAGX_SimpleMeshComponent>, FAGX_RtShapeInstanceData> TrackedAGXMeshes;
 
+	/**
+	 * Raytrace shapes keyed on Static Mesh asset and LOD index, shared by all tracked Static Mesh
+	 * Components and Instanced Static Mesh Components using that asset. The tracked mesh data owns
+	 * the shapes, so an entry expires when the last component using it is removed.
+	 */
+	TMap<FAGX_RtShapeKey, TWeakPtr<FRtShapeBarrier>> SharedMeshShapes;
+
+	/// Raytrace shapes whose triangle data is being read on a background task.
+	TMap<FAGX_RtShapeKey, FAGX_PendingRtShape> PendingMeshShapes;
+
+	/// Static Mesh Components waiting for a shape in PendingMeshShapes.
+	TMap<TWeakObjectPtr<UStaticMeshComponent>, FAGX_PendingRtShapeInstance> PendingMeshes;
+
+	/// Tracked Static Mesh and AGX Mesh components that have moved since the last Tick.
+	TSet<TWeakObjectPtr<USceneComponent>> DirtyMeshes;
+
 	FSensorEnvironmentBarrier NativeBarrier;
 };
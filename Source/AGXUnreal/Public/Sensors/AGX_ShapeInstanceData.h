@@ -7,6 +7,14 @@
 #include "Sensors/RtShapeInstanceBarrier.h"
 #include "Sensors/RtShapeBarrier.h"
 
+// Unreal Engine includes.
+#include "Engine/StaticMesh.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/StrongObjectPtr.h"
+
+/// Identifies a raytrace shape created from a Static Mesh asset, by asset and LOD index.
+using FAGX_RtShapeKey = TPair<TObjectKey<UStaticMesh>, int32>;
 
 struct FAGX_RtInstanceData
 {
@@ -23,14 +31,46 @@ struct FAGX_RtInstanceData
 	}
 };
 
+/**
+ * The Shape may be shared between several Shape Instance Data, for example by all Static Mesh
+ * Components using the same Static Mesh asset. It is released when the last user is removed.
+ * InstanceData is declared after Shape so that the instance is destroyed before the shape.
+ */
 struct FAGX_RtShapeInstanceData
 {
-	FRtShapeBarrier Shape;
+	TSharedPtr<FRtShapeBarrier> Shape;
 	FAGX_RtInstanceData InstanceData;
+
+	/// Binding to the component's TransformUpdated event. Not set for components with Static
+	/// mobility.
+	FDelegateHandle TransformUpdatedHandle;
+};
+
+struct FAGX_RtShapeTriangleData
+{
+	TArray<FVector> Vertices;
+	TArray<FTriIndices> Indices;
+};
+
+/**
+ * A raytrace shape whose triangle data is being read and preprocessed on a background task. The
+ * Static Mesh is kept alive until the task has completed.
+ */
+struct FAGX_PendingRtShape
+{
+	TStrongObjectPtr<UStaticMesh> Mesh;
+	UE::Tasks::TTask<FAGX_RtShapeTriangleData> Task;
+};
+
+/// A component waiting for its raytrace shape to be created.
+struct FAGX_PendingRtShapeInstance
+{
+	FAGX_RtShapeKey ShapeKey;
+	size_t RefCount {1};
 };
 
 struct FAGX_RtInstancedShapeInstanceData
 {
-	FRtShapeBarrier Shape;
+	TSharedPtr<FRtShapeBarrier> Shape;
 	TMap<int32, FAGX_RtInstanceData> InstancesData;
 };
@@ -5,6 +5,7 @@
 // AGX Dynamics for Unreal includes.
 #include "Shapes/AGX_ShapeComponent.h"
 #include "Shapes/HeightFieldShapeBarrier.h"
+#include "Utilities/AGX_HeightFieldUtilities.h"
 
 // Unreal Engine includes.
 #include "CoreMinimal.h"
@@ -41,6 +42,16 @@ public:
 	/// Get the native AGX Dynamics representation of this HeightField. May return nullptr.
 	FHeightFieldShapeBarrier* GetNativeHeightField();
 
+	/**
+	 * Create a task that reads the heights from the Source Landscape. The task may be run on any
+	 * thread before Begin Play and the result is used by the next native creation, which then
+	 * doesn't need to read the Landscape itself.
+	 *
+	 * Must be called from the game thread. Returns an empty function if there is nothing to
+	 * prepare.
+	 */
+	TFunction<void()> CreatePrepareHeightsTask();
+
 	virtual void DestroyComponent(bool bPromoteChildren) override;
 
 protected:
@@ -63,4 +74,7 @@ private:
 
 private:
 	FHeightFieldShapeBarrier NativeBarrier;
+
+	// Heights read by the task created by CreatePrepareHeightsTask.
+	TSharedPtr<AGX_HeightFieldUtilities::FPreparedHeights, ESPMode::ThreadSafe> PreparedHeights;
 };
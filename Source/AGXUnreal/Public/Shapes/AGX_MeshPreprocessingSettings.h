@@ -0,0 +1,60 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+#include "AGX_MeshPreprocessingSettings.generated.h"
+
+/**
+ * Settings for the clean-up and simplification that is applied to triangle data read from a Static
+ * Mesh before it is handed to AGX Dynamics. See AGX_MeshPreprocessing.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_MeshPreprocessingSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * Merge vertices that are closer to each other than Weld Tolerance. Vertices at exactly the
+	 * same location are always merged, this setting is for meshes, typically from CAD, where
+	 * vertices that should coincide are slightly apart.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Mesh Preprocessing")
+	bool bWeldVertices {false};
+
+	/**
+	 * The largest distance between two vertices that are merged, in the Static Mesh's local
+	 * coordinate system [cm].
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Mesh Preprocessing",
+		Meta = (EditCondition = "bWeldVertices", ClampMin = "0.0", UIMin = "0.0"))
+	double WeldTolerance {0.01};
+
+	/**
+	 * Remove triangles that have two or more identical corners or an area close to zero. Such
+	 * triangles do not contribute to the collision shape but cost time during collision detection.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Mesh Preprocessing")
+	bool bRemoveDegenerateTriangles {false};
+
+	/**
+	 * Reduce the number of triangles to at most Target Triangle Count by collapsing the edges that
+	 * change the shape of the mesh the least, measured with quadric error metrics.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Mesh Preprocessing")
+	bool bDecimate {false};
+
+	/** The number of triangles that decimation should reduce the mesh to. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Mesh Preprocessing",
+		Meta = (EditCondition = "bDecimate", ClampMin = "1", UIMin = "1"))
+	int32 TargetTriangleCount {1000};
+
+	/// True if any preprocessing step is enabled.
+	bool IsEnabled() const;
+
+	bool operator==(const FAGX_MeshPreprocessingSettings& Other) const;
+};
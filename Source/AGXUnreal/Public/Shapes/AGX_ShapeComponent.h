@@ -9,6 +9,7 @@
 #include "Shapes/AGX_SimpleMeshComponent.h"
 #include "Contacts/AGX_ShapeContact.h"
 #include "Shapes/AGX_ShapeEnums.h"
+#include "Shapes/AGX_ShapeInstancingKey.h"
 #include "Shapes/ShapeBarrier.h"
 #include "Utilities/AGX_ObjectUtilities.h"
 
@@ -21,9 +22,12 @@
 
 struct FAGX_ImportContext;
 
+class AAGX_ShapeInstanceRenderer;
 class UAGX_ShapeMaterial;
+class UAGX_Simulation;
 class UBodySetup;
 class UMaterial;
+class UStaticMesh;
 
 UCLASS(
 	ClassGroup = "AGX", Category = "AGX", Abstract, Meta = (BlueprintSpawnableComponent),
@@ -187,6 +191,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AGX Shape")
 	void UpdateVisualMesh();
 
+	/**
+	 * Get the shared Static Mesh, and the transform that places it relative to this Shape, to use
+	 * when this Shape's visual is rendered as an instance by the Shape Instance Renderer.
+	 *
+	 * @return False if this Shape type does not support instanced visuals.
+	 */
+	virtual bool GetInstancedVisual(UStaticMesh*& OutMesh, FTransform& OutMeshTransform) const
+	{
+		return false;
+	}
+
+	/**
+	 * Identifies the data this Shape's native collision data is created from, beyond the Shape's
+	 * own properties, for Shapes whose collision data is read from an asset.
+	 *
+	 * @return An invalid key if the collision data is fully described by the Shape's properties.
+	 */
+	virtual FAGX_ShapeInstancingKey GetInstancingKey() const
+	{
+		return FAGX_ShapeInstancingKey();
+	}
+
+	/**
+	 * @return True if this Shape's visual is currently rendered by the Shape Instance Renderer
+	 * instead of by this Component.
+	 */
+	bool IsVisualInstanced() const;
+
 	/**
 	 * Get the Native Barrier for this shape. Will return nullptr if this Shape doesn't have an
 	 * associated AGX Dynamics object yet.
@@ -237,6 +269,10 @@ public:
 	virtual void OnAttachmentChanged() override;
 	//~ End USceneComponent interface
 
+	//~ Begin UMeshComponent interface
+	virtual void SetMaterial(int32 ElementIndex, UMaterialInterface* Material) override;
+	//~ End UMeshComponent interface
+
 	// ~Begin UObject interface.
 	virtual void PostInitProperties() override;
 	virtual void PostLoad() override; // When loaded in Editor or Game
@@ -324,6 +360,8 @@ protected:
 
 	// ~Begin UPrimitiveComponent interface.
 	virtual UBodySetup* GetBodySetup() override;
+	virtual void OnVisibilityChanged() override;
+	virtual void OnHiddenInGameChanged() override;
 	// ~End UPrimitiveComponent interface.
 
 	void CreateShapeBodySetupIfNeeded();
@@ -336,6 +374,13 @@ protected:
 private:
 	bool UpdateNativeMaterial();
 
+	/// Hand the visual over to the Shape Instance Renderer, if enabled and supported.
+	void TryInstanceVisual(UAGX_Simulation& Simulation);
+
+	// Set and reset by the Shape Instance Renderer when it starts and stops rendering this Shape.
+	TWeakObjectPtr<AAGX_ShapeInstanceRenderer> InstanceRenderer;
+	friend class AAGX_ShapeInstanceRenderer;
+
 	// UAGX_ShapeComponent does not own the Barrier object because it cannot
 	// name its type. It is instead owned by the typed subclass, such as
 	// UAGX_BoxShapeComponent. Access to it is provided using virtual Get
@@ -42,3 +42,22 @@ enum EAGX_StaticMeshSourceLocation
 	/** Directly from explicitly chosen Static Mesh Asset. */
 	TSL_STATIC_MESH_ASSET UMETA(DisplayName = "Asset")
 };
+
+/**
+ * Specifies what kind of AGX Dynamics collision shape a Trimesh Shape Component creates from its
+ * Static Mesh source.
+ */
+UENUM(BlueprintType)
+enum class EAGX_TrimeshCollisionType : uint8
+{
+	/** A single triangle mesh using the triangles of the Static Mesh source. */
+	Trimesh,
+
+	/**
+	 * A set of convex shapes, either a convex decomposition generated by the Trimesh Shape
+	 * Component or the convex simple collision of the Static Mesh source. Convex-convex contacts
+	 * are cheaper and more robust than contacts involving triangle meshes, especially for dynamic
+	 * bodies.
+	 */
+	ConvexDecomposition
+};
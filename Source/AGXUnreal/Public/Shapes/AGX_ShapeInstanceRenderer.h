@@ -0,0 +1,123 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+
+#include "AGX_ShapeInstanceRenderer.generated.h"
+
+class UAGX_ShapeComponent;
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class USceneComponent;
+class UStaticMesh;
+
+/**
+ * All instanced Shape visuals that share the same Static Mesh, material and shadow casting.
+ */
+USTRUCT()
+struct FAGX_ShapeInstanceBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Instances;
+
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> Mesh;
+
+	UPROPERTY()
+	TObjectPtr<UMaterialInterface> Material;
+
+	bool bCastShadow {true};
+
+	// One element per instance in all arrays below.
+	TArray<TWeakObjectPtr<UAGX_ShapeComponent>> Shapes;
+
+	// The transform from the Static Mesh to the Shape, i.e. size and orientation of the mesh.
+	TArray<FTransform> MeshTransforms;
+
+	// World transforms of the instances.
+	TArray<FTransform> Transforms;
+
+	bool bTransformsDirty {false};
+};
+
+/**
+ * Renders the visuals of primitive Shape Components as instances of a shared Static Mesh during
+ * Play, one Instanced Static Mesh Component per Static Mesh, material and shadow casting, instead
+ * of one procedural mesh per Shape. Spawned by the AGX Simulation when Instanced Shape Visuals is
+ * enabled in the AGX Simulation settings.
+ *
+ * Shapes that are hidden remain registered but have no instance. Changes to the visibility or
+ * material of a Shape are forwarded by the Shape, changes to its shadow casting are detected on
+ * Tick.
+ */
+UCLASS(ClassGroup = "AGX", Category = "AGX", NotPlaceable, Transient)
+class AGXUNREAL_API AAGX_ShapeInstanceRenderer : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AAGX_ShapeInstanceRenderer();
+
+	/**
+	 * Start rendering the given Shape as an instance. Fails, returning false, if the Shape type
+	 * does not support instanced visuals.
+	 */
+	bool Add(UAGX_ShapeComponent& Shape);
+
+	void Remove(UAGX_ShapeComponent& Shape);
+
+	/**
+	 * Move the instance of the given Shape to the batch matching the Shape's current visibility,
+	 * material and shadow casting, removing it if the Shape is hidden.
+	 */
+	void UpdateInstance(UAGX_ShapeComponent& Shape);
+
+	/**
+	 * Recompute the size of the instance for the given Shape. Call when the Shape's geometry
+	 * properties, such as radius or half extent, have changed.
+	 */
+	void UpdateMeshTransform(UAGX_ShapeComponent& Shape);
+
+	/// The number of registered Shapes, including hidden ones.
+	int32 GetNumInstances() const;
+
+	/**
+	 * @return The Instanced Static Mesh Component that currently renders the given Shape, or
+	 * nullptr if the Shape is not registered or is hidden.
+	 */
+	UInstancedStaticMeshComponent* GetInstances(const UAGX_ShapeComponent& Shape) const;
+
+	// ~Begin AActor interface.
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type Reason) override;
+	// ~End AActor interface.
+
+private:
+	struct FInstanceHandle
+	{
+		// INDEX_NONE if the Shape is hidden.
+		int32 Batch {INDEX_NONE};
+		int32 Instance {INDEX_NONE};
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	int32 GetOrCreateBatch(UStaticMesh& Mesh, UMaterialInterface* Material, bool bCastShadow);
+	void AddInstance(
+		UAGX_ShapeComponent& Shape, FInstanceHandle& Handle, int32 BatchIndex,
+		const FTransform& MeshTransform);
+	void RemoveInstance(FInstanceHandle& Handle);
+	void OnShapeTransformUpdated(
+		USceneComponent* Component, EUpdateTransformFlags Flags, ETeleportType Teleport);
+
+private:
+	UPROPERTY()
+	TArray<FAGX_ShapeInstanceBatch> Batches;
+
+	TMap<TObjectKey<UAGX_ShapeComponent>, FInstanceHandle> Handles;
+};
@@ -0,0 +1,37 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Shapes/AGX_MeshPreprocessingSettings.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * Describes the data a Shape's native collision data is created from, used by
+ * UAGX_Simulation::SpawnInstances to find Shapes that may share native collision data.
+ *
+ * The transform is compared with a tolerance since it is computed from each instance's own
+ * Component transforms and may differ in the last few bits between otherwise identical instances.
+ */
+struct AGXUNREAL_API FAGX_ShapeInstancingKey
+{
+	/// The asset the collision data is read from, for example a Static Mesh.
+	TWeakObjectPtr<const UObject> Source;
+
+	int32 LodIndex {0};
+
+	/// The transform baked into the collision data, relative to the Shape [cm].
+	FTransform RelativeTransform;
+
+	FAGX_MeshPreprocessingSettings Preprocessing;
+
+	/// The largest difference in translation [cm], rotation and scale considered equal.
+	static constexpr double TransformTolerance = 1.e-4;
+
+	bool IsValid() const;
+
+	bool Matches(const FAGX_ShapeInstancingKey& Other) const;
+};
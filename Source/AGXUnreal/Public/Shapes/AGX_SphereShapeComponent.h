@@ -61,6 +61,8 @@ protected:
 	virtual const FShapeBarrier* GetNativeBarrier() const override;
 	virtual void ReleaseNative() override;
 	void CreateVisualMesh(FAGX_SimpleMeshData& OutMeshData) override;
+	virtual bool GetInstancedVisual(
+		UStaticMesh*& OutMesh, FTransform& OutMeshTransform) const override;
 	virtual bool SupportsShapeBodySetup() override;
 	virtual void UpdateBodySetup() override;
 	virtual void AddShapeBodySetupGeometry() override;
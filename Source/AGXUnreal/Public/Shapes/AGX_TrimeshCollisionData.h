@@ -0,0 +1,161 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Shapes/AGX_MeshPreprocessingSettings.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "Interface_CollisionDataProviderCore.h"
+
+#include "AGX_TrimeshCollisionData.generated.h"
+
+class UStaticMesh;
+
+/**
+ * Welded and preprocessed triangle data read from one LOD of a Static Mesh, stored in the Static
+ * Mesh's local coordinate system so that it can be saved in a Trimesh Collision Data Asset and
+ * reused at Begin Play instead of reading, welding and preprocessing the Static Mesh's render
+ * buffers again.
+ *
+ * The source description is used to detect when the stored data no longer matches the Static Mesh
+ * it was created from. In the editor the render data's derived data key identifies the mesh
+ * content, so a reimport that keeps the vertex and index counts is still detected. Cooked builds
+ * don't have the key and only compare mesh, LOD and buffer sizes.
+ */
+USTRUCT()
+struct AGXUNREAL_API FAGX_TrimeshCollisionData
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSoftObjectPtr<UStaticMesh> SourceMesh;
+
+	UPROPERTY()
+	int32 SourceLodIndex {-1};
+
+	UPROPERTY()
+	int32 SourceNumVertices {0};
+
+	UPROPERTY()
+	int32 SourceNumIndices {0};
+
+	/// The derived data key of the Static Mesh's render data when the data was built.
+	UPROPERTY()
+	FString SourceDerivedDataKey;
+
+	/// The preprocessing that has been applied to the triangle data.
+	UPROPERTY()
+	FAGX_MeshPreprocessingSettings Preprocessing;
+
+	/// Welded vertex positions in the Static Mesh's local coordinate system.
+	UPROPERTY()
+	TArray<FVector3f> Vertices;
+
+	/// Three consecutive indices form a triangle.
+	UPROPERTY()
+	TArray<uint32> Indices;
+
+	bool IsEmpty() const;
+
+	void Reset();
+
+	/**
+	 * Read, weld and preprocess the triangle data of the given LOD of the Static Mesh, replacing
+	 * any previously stored data.
+	 */
+	bool Build(
+		const UStaticMesh& StaticMesh, uint32 LodIndex,
+		const FAGX_MeshPreprocessingSettings& InPreprocessing);
+
+	/**
+	 * Check if the stored data was created from the given LOD of the given Static Mesh with the
+	 * given preprocessing, and that the Static Mesh's render data hasn't changed since then.
+	 */
+	bool IsValidFor(
+		const UStaticMesh& StaticMesh, uint32 LodIndex,
+		const FAGX_MeshPreprocessingSettings& InPreprocessing) const;
+};
+
+/**
+ * A single convex hull in a Static Mesh's local coordinate system. Three consecutive indices form
+ * a triangle, wound the same way as the Static Mesh's render triangles.
+ */
+USTRUCT()
+struct AGXUNREAL_API FAGX_ConvexHull
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FVector3f> Vertices;
+
+	UPROPERTY()
+	TArray<uint32> Indices;
+};
+
+/**
+ * A convex decomposition of one LOD of a Static Mesh, stored in a Trimesh Collision Data Asset so
+ * that the Static Mesh's own simple collision is left untouched.
+ *
+ * The source description is the same as for FAGX_TrimeshCollisionData and is used to detect when
+ * the decomposition no longer matches the Static Mesh it was created from.
+ */
+USTRUCT()
+struct AGXUNREAL_API FAGX_ConvexDecompositionData
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSoftObjectPtr<UStaticMesh> SourceMesh;
+
+	UPROPERTY()
+	int32 SourceLodIndex {-1};
+
+	UPROPERTY()
+	int32 SourceNumVertices {0};
+
+	UPROPERTY()
+	int32 SourceNumIndices {0};
+
+	UPROPERTY()
+	FString SourceDerivedDataKey;
+
+	/// The parameters the decomposition was generated with.
+	UPROPERTY()
+	int32 MaxHulls {0};
+
+	UPROPERTY()
+	int32 MaxHullVertices {0};
+
+	UPROPERTY()
+	int32 Resolution {0};
+
+	UPROPERTY()
+	TArray<FAGX_ConvexHull> Hulls;
+
+	bool IsEmpty() const;
+
+	void Reset();
+
+#if WITH_EDITOR
+	/**
+	 * Compute a convex decomposition of the given LOD of the Static Mesh, replacing any previously
+	 * stored hulls. See AGX_MeshUtilities::GenerateConvexDecomposition.
+	 */
+	bool Build(
+		const UStaticMesh& StaticMesh, uint32 LodIndex, int32 InMaxHulls, int32 InMaxHullVertices,
+		int32 InResolution);
+#endif
+
+	/**
+	 * Check if the stored hulls were created from the given LOD of the given Static Mesh, and that
+	 * the Static Mesh's render data hasn't changed since then.
+	 */
+	bool IsValidFor(const UStaticMesh& StaticMesh, uint32 LodIndex) const;
+
+	/// Transform the hulls into the representation passed to AGX Dynamics.
+	void GetHulls(
+		const FTransform& Transform, TArray<TArray<FVector>>& OutVertices,
+		TArray<TArray<FTriIndices>>& OutIndices) const;
+};
@@ -0,0 +1,88 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Shapes/AGX_TrimeshCollisionData.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "AGX_TrimeshCollisionDataAsset.generated.h"
+
+class UStaticMesh;
+
+/**
+ * Collision data derived from a Static Mesh, stored once per Static Mesh in an asset next to it
+ * and shared by all Trimesh Shape Components that use that Static Mesh.
+ *
+ * The Static Mesh itself is never modified. Stale triangle data, for example after a reimport of
+ * the Static Mesh, is rebuilt when the asset is saved or cooked. A stale convex decomposition must
+ * be regenerated explicitly since it is expensive to compute. Stale data is ignored at Begin Play.
+ */
+UCLASS(ClassGroup = "AGX", Category = "AGX")
+class AGXUNREAL_API UAGX_TrimeshCollisionDataAsset : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/// The Static Mesh that the collision data was derived from.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Trimesh Collision Data")
+	TSoftObjectPtr<UStaticMesh> SourceMesh;
+
+	/**
+	 * Welded and preprocessed triangle data, one entry per combination of Static Mesh LOD and
+	 * preprocessing settings that has been requested.
+	 */
+	UPROPERTY()
+	TArray<FAGX_TrimeshCollisionData> TriangleData;
+
+	/// Convex hulls created by Generate Convex Decomposition on a Trimesh Shape Component.
+	UPROPERTY()
+	FAGX_ConvexDecompositionData ConvexDecomposition;
+
+	/**
+	 * Find the triangle data for the given LOD of the given Static Mesh with the given
+	 * preprocessing.
+	 *
+	 * @return The triangle data, or nullptr if there is none or if it is stale.
+	 */
+	const FAGX_TrimeshCollisionData* FindTriangleData(
+		const UStaticMesh& StaticMesh, uint32 LodIndex,
+		const FAGX_MeshPreprocessingSettings& Preprocessing) const;
+
+	/**
+	 * Get the convex decomposition of the given LOD of the given Static Mesh.
+	 *
+	 * @return The convex decomposition, or nullptr if there is none or if it is stale.
+	 */
+	const FAGX_ConvexDecompositionData* FindConvexDecomposition(
+		const UStaticMesh& StaticMesh, uint32 LodIndex) const;
+
+#if WITH_EDITOR
+	/**
+	 * Make sure there is up-to-date triangle data for the given LOD of the Static Mesh with the
+	 * given preprocessing, building it if necessary.
+	 *
+	 * @return True if the asset was modified.
+	 */
+	bool UpdateTriangleData(
+		const UStaticMesh& StaticMesh, uint32 LodIndex,
+		const FAGX_MeshPreprocessingSettings& Preprocessing);
+
+	/**
+	 * Find the collision data asset stored next to the given Static Mesh, creating it if it
+	 * doesn't exist. Returns nullptr for Static Meshes that are not stored in a writable content
+	 * folder, such as engine content or transient meshes.
+	 */
+	static UAGX_TrimeshCollisionDataAsset* FindOrCreate(UStaticMesh& StaticMesh);
+
+	/// The package path of the collision data asset for the given Static Mesh.
+	static FString GetPackagePath(const UStaticMesh& StaticMesh);
+
+	// ~Begin UObject interface.
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+	// ~End UObject interface.
+#endif
+};
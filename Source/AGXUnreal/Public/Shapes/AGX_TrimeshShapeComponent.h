@@ -3,7 +3,9 @@
 #pragma once
 
 // AGX Dynamics for Unreal includes.
+#include "Shapes/AGX_MeshPreprocessingSettings.h"
 #include "Shapes/AGX_ShapeComponent.h"
+#include "Shapes/AGX_ShapeInstancingKey.h"
 #include "Shapes/TrimeshShapeBarrier.h"
 
 // Unreal Engine includes.
@@ -12,6 +14,8 @@
 
 #include "AGX_TrimeshShapeComponent.generated.h"
 
+class UAGX_TrimeshCollisionDataAsset;
+
 /**
  * Uses triangle data from a Static Mesh to generate an AGX Triangle Collision Mesh.
  *
@@ -48,6 +52,50 @@ public:
 			ExposeOnSpawn))
 	UStaticMesh* MeshSourceAsset;
 
+	/**
+	 * Whether the AGX Dynamics collision shape should be a triangle mesh or a set of convex shapes.
+	 *
+	 * The convex shapes are those created by Generate Convex Decomposition, stored in the
+	 * Collision Data Asset. If there are none, the convex simple collision of the Static Mesh
+	 * source is used. Falls back to a triangle mesh if neither exists.
+	 *
+	 * Only used during initialization, changing this value after Begin Play has no effect.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Shape", Meta = (ExposeOnSpawn))
+	EAGX_TrimeshCollisionType CollisionType {EAGX_TrimeshCollisionType::Trimesh};
+
+	/** The maximum number of convex shapes created by Generate Convex Decomposition. */
+	UPROPERTY(
+		EditAnywhere, Category = "AGX Shape|Convex Decomposition",
+		Meta = (ClampMin = "1", ClampMax = "64"))
+	int32 MaxConvexHulls {8};
+
+	/**
+	 * The maximum number of vertices in each convex shape created by Generate Convex
+	 * Decomposition.
+	 */
+	UPROPERTY(
+		EditAnywhere, Category = "AGX Shape|Convex Decomposition",
+		Meta = (ClampMin = "4", ClampMax = "256"))
+	int32 MaxConvexHullVertices {32};
+
+	/**
+	 * Voxel resolution used by Generate Convex Decomposition. Higher values produce shapes that
+	 * follow the Static Mesh more closely, at the cost of a longer generation time.
+	 */
+	UPROPERTY(
+		EditAnywhere, Category = "AGX Shape|Convex Decomposition",
+		Meta = (ClampMin = "10000", ClampMax = "10000000"))
+	int32 ConvexDecompositionResolution {100000};
+
+	/**
+	 * Compute a convex decomposition of the triangle data of the Static Mesh source and store it
+	 * in the Collision Data Asset for the Static Mesh. The Static Mesh itself, and its simple
+	 * collision used by other systems, is not modified.
+	 */
+	UFUNCTION(CallInEditor, Category = "AGX Shape|Convex Decomposition")
+	void GenerateConvexDecomposition();
+
 	/**
 	 * Whether to explicitly set LOD Level to read triangle data from here
 	 * or to use the setting that already exists on the Static Mesh source.
@@ -64,16 +112,68 @@ public:
 		Meta = (EditCondition = "bOverrideMeshSourceLodIndex"))
 	uint32 MeshSourceLodIndex;
 
+	/**
+	 * Whether the welded triangle data read from the Static Mesh source should be stored in a
+	 * Trimesh Collision Data Asset next to the Static Mesh.
+	 *
+	 * When enabled, Begin Play uses the stored triangle data instead of reading and welding the
+	 * Static Mesh's render buffers, which can be a significant part of level load time for large
+	 * meshes. The asset is shared by all Trimesh Shape Components using the same Static Mesh. The
+	 * stored data is ignored if the Static Mesh source has changed since it was built.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX Shape", AdvancedDisplay)
+	bool bCacheCollisionData {false};
+
+	/**
+	 * The asset holding the cached triangle data and the convex decomposition for the Static Mesh
+	 * source. Created by Update Collision Data Asset and Generate Convex Decomposition.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape", AdvancedDisplay)
+	UAGX_TrimeshCollisionDataAsset* CollisionDataAsset {nullptr};
+
+	/**
+	 * Create or update the Trimesh Collision Data Asset for the current Static Mesh source and
+	 * save it. Must be called again if the Static Mesh source is replaced by another Static Mesh.
+	 */
+	UFUNCTION(CallInEditor, Category = "AGX Shape")
+	void UpdateCollisionDataAsset();
+
+	/**
+	 * Clean-up and simplification applied to the triangle data read from the Static Mesh source
+	 * before the AGX Dynamics Trimesh is created. Done in the Static Mesh's local coordinate
+	 * system, before the component's scale is applied.
+	 *
+	 * Only used during initialization, changing this value after Begin Play has no effect.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX Shape", AdvancedDisplay)
+	FAGX_MeshPreprocessingSettings MeshPreprocessing;
+
 	// ~Begin UAGX_ShapeComponent interface.
 	FShapeBarrier* GetNative() override;
 	const FShapeBarrier* GetNative() const override;
 	FShapeBarrier* GetOrCreateNative() override;
 	virtual void UpdateNativeProperties() override;
+
+	/// Identifies the collision data for sharing between instances spawned by SpawnInstances.
+	virtual FAGX_ShapeInstancingKey GetInstancingKey() const override;
 	// ~End UAGX_ShapeComponent interface.
 
 	/// Get the native AGX Dynamics representation of this Trimesh. May return nullptr.
 	FTrimeshShapeBarrier* GetNativeTrimesh();
 
+	/**
+	 * Create a task that reads and welds the triangle data from the Static Mesh source. The task
+	 * may be run on any thread and the result is used by the next native creation, typically in
+	 * Begin Play, which then doesn't need to read the Static Mesh itself. The task only accesses
+	 * state it owns, the result is handed over through a shared object, but the Static Mesh must
+	 * be kept alive until the task has finished.
+	 *
+	 * Must be called from the game thread. Returns an empty function if there is nothing to
+	 * prepare or if the triangle data cannot be read off the game thread, which is the case when
+	 * it is only available in GPU memory.
+	 */
+	TFunction<void()> CreatePrepareCollisionDataTask();
+
 	/**
 	 * Copy properties from the given AGX Dynamics trimesh into this component.
 	 * @param Barrier The AGX Dynamics trimesh to copy from.
@@ -110,12 +210,30 @@ private:
 	/// Create the AGX Dynamics object owned by this Trimesh Shape Component.
 	void CreateNative();
 
+	/**
+	 * Create one native Convex per convex hull in the Collision Data Asset's convex decomposition,
+	 * or in the Static Mesh source's simple collision if there is no such decomposition.
+	 */
+	bool CreateNativeConvexDecomposition();
+
 	bool GetStaticMeshCollisionData(
 		TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices) const;
 
+	FAGX_MeshWithTransform FindMeshSource() const;
+
 	UMeshComponent* FindMeshComponent(
 		TEnumAsByte<EAGX_StaticMeshSourceLocation> MeshSourceLocation) const;
 
 private:
+	// Triangle data produced by the task created by CreatePrepareCollisionDataTask. Shared with
+	// the task so that the task never touches this component.
+	struct FPreparedCollisionData
+	{
+		TArray<FVector> Vertices;
+		TArray<FTriIndices> Indices;
+		bool bValid {false};
+	};
+	TSharedPtr<FPreparedCollisionData, ESPMode::ThreadSafe> PreparedCollisionData;
+
 	FTrimeshShapeBarrier NativeBarrier;
 };
@@ -11,6 +11,7 @@
 #include "Terrain/AGX_TerrainPagingSettings.h"
 #include "Terrain/AGX_Shovel.h"
 #include "AGX_ShovelReference.h"
+#include "Utilities/AGX_HeightFieldUtilities.h"
 
 // Unreal Engine includes.
 #include "Misc/EngineVersionComparison.h"
@@ -346,6 +347,16 @@ public:
 	FTerrainPagerBarrier* GetNativeTerrainPager();
 	const FTerrainPagerBarrier* GetNativeTerrainPager() const;
 
+	/**
+	 * Create a task that reads the heights from the Source Landscape. The task may be run on any
+	 * thread before Begin Play and the result is used by the next native creation, which then
+	 * doesn't need to read the Landscape itself.
+	 *
+	 * Must be called from the game thread. Returns an empty function if there is nothing to
+	 * prepare, which is the case when Terrain Paging is enabled.
+	 */
+	TFunction<void()> CreatePrepareHeightsTask();
+
 #if WITH_EDITOR
 	virtual void PostInitProperties() override;
 	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& Event) override;
@@ -375,6 +386,13 @@ private:
 	bool InitializeParticleSystem();
 	bool InitializeParticleSystemComponent();
 	void UpdateParticlesArrays();
+
+	// UpdateParticlesArrays split into phases so that the Simulation can run ExtractParticleData
+	// on a worker thread. PrepareParticlesUpdate and ApplyParticleData must run on the game
+	// thread.
+	bool PrepareParticlesUpdate() const;
+	void ExtractParticleData();
+	void ApplyParticleData();
 #if WITH_EDITOR
 	void InitPropertyDispatcher();
 	virtual void PostLoad() override;
@@ -441,6 +459,7 @@ private:
 	FDelegateHandle PostStepForwardHandle;
 
 	// Height field related variables.
+	TSharedPtr<AGX_HeightFieldUtilities::FPreparedHeights, ESPMode::ThreadSafe> PreparedHeights;
 	std::mutex OriginalHeightsMutex;
 	TArray<float> OriginalHeights;
 	TArray<float> CurrentHeights;
@@ -453,6 +472,14 @@ private:
 	// Particle related variables.
 	UNiagaraComponent* ParticleSystemComponent = nullptr;
 
+	// Staging buffers written by ExtractParticleData and read by ApplyParticleData.
+	FParticleDataById StagedParticleData;
+	TArray<FVector4> StagedPositionsAndScale;
+	TArray<FVector4> StagedOrientations;
+
+	// True while the particles are updated by a Simulation visual sync job instead of on tick.
+	bool bParticlesSyncedBySimulation {false};
+
 	/**
 	 * Thread safe convenience function for reading heights from the source Landscape.
 	 * The WorldPosStart is projected onto the Landscape and acts as the starting point (corner) of
@@ -5,6 +5,10 @@
 // AGX Dynamics for Unreal includes.
 #include "Shapes/HeightFieldShapeBarrier.h"
 
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+
 // Standard library includes.
 #include <tuple>
 
@@ -12,10 +16,35 @@ class ALandscape;
 
 namespace AGX_HeightFieldUtilities
 {
+	// Landscape heights read ahead of native creation by a task created by
+	// CreatePrepareHeightsTask. Shared between the task and the creator of the native.
+	struct FPreparedHeights
+	{
+		FVector StartPos {FVector::ZeroVector};
+		double LengthX {0.0};
+		double LengthY {0.0};
+		TArray<float> Heights;
+		bool bValid {false};
+	};
+
 	// StartPos is in world coordinate system.
 	AGXUNREAL_API FHeightFieldShapeBarrier CreateHeightField(
 		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY);
 
+	// Same as above, but uses the heights in Prepared, if any, instead of reading them from the
+	// Landscape. Prepared is reset.
+	AGXUNREAL_API FHeightFieldShapeBarrier CreateHeightField(
+		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		TSharedPtr<FPreparedHeights, ESPMode::ThreadSafe>& Prepared);
+
+	// Create a task that reads the heights for a CreateHeightField call with the same arguments
+	// into OutPrepared. The task may be run on any thread as long as nothing modifies the
+	// Landscape, which is the case between actor initialization and Begin Play. The Landscape
+	// must be kept alive until the task has finished.
+	AGXUNREAL_API TFunction<void()> CreatePrepareHeightsTask(
+		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		TSharedPtr<FPreparedHeights, ESPMode::ThreadSafe>& OutPrepared);
+
 	// Overall resolution using outer bounds (i.e. holes does not affect this value unless a
 	// complete part if a side has been removed using the Landscape tool.
 	AGXUNREAL_API std::tuple<int32, int32> GetLandscapeNumberOfVertsXY(const ALandscape& Landscape);
@@ -0,0 +1,75 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "Interface_CollisionDataProviderCore.h"
+
+struct FAGX_MeshPreprocessingSettings;
+
+/**
+ * Clean-up and simplification of triangle data, in the form produced by
+ * AGX_MeshUtilities::GetStaticMeshCollisionData, before it is passed to AGX Dynamics.
+ *
+ * All functions modify the given vertex and index arrays in place. Per-vertex and per-triangle
+ * work is done in parallel where the result does not depend on processing order, so the output is
+ * deterministic.
+ */
+class AGXUNREAL_API AGX_MeshPreprocessing
+{
+public:
+	/**
+	 * Run the steps enabled in Settings, in the order weld, remove degenerate triangles, decimate.
+	 * Vertices no longer referenced by any triangle are removed.
+	 */
+	static void Process(
+		TArray<FVector>& Vertices, TArray<FTriIndices>& Indices,
+		const FAGX_MeshPreprocessingSettings& Settings);
+
+	/**
+	 * Same as above but for triangle data in the form produced by
+	 * AGX_MeshUtilities::GetStaticMeshWeldedTriangleData, where three consecutive indices form a
+	 * triangle.
+	 */
+	static void Process(
+		TArray<FVector3f>& Vertices, TArray<uint32>& Indices,
+		const FAGX_MeshPreprocessingSettings& Settings);
+
+	/**
+	 * Merge vertices that are at most Tolerance apart, using a uniform grid spatial hash with cell
+	 * size Tolerance. Each vertex is merged into the first earlier vertex found within Tolerance.
+	 *
+	 * @return The number of vertices that were merged away.
+	 */
+	static int32 WeldVertices(
+		TArray<FVector>& Vertices, TArray<FTriIndices>& Indices, double Tolerance);
+
+	/**
+	 * Remove triangles that reference the same vertex more than once or whose area is at most
+	 * AreaTolerance.
+	 *
+	 * @return The number of triangles that were removed.
+	 */
+	static int32 RemoveDegenerateTriangles(
+		const TArray<FVector>& Vertices, TArray<FTriIndices>& Indices,
+		double AreaTolerance = UE_DOUBLE_SMALL_NUMBER);
+
+	/**
+	 * Reduce the triangle count to at most TargetTriangleCount using quadric error metric edge
+	 * collapses. Collapses that would change the topology of the mesh, checked with the link
+	 * condition, or turn the normal of a triangle too far are rejected, so the target may not be
+	 * reached for some meshes.
+	 *
+	 * @return The number of triangles that were removed.
+	 */
+	static int32 Decimate(
+		TArray<FVector>& Vertices, TArray<FTriIndices>& Indices, int32 TargetTriangleCount);
+
+	/**
+	 * Remove vertices that are not referenced by any triangle and update the indices accordingly.
+	 *
+	 * @return The number of vertices that were removed.
+	 */
+	static int32 RemoveUnusedVertices(TArray<FVector>& Vertices, TArray<FTriIndices>& Indices);
+};
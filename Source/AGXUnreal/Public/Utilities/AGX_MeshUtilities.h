@@ -341,6 +341,73 @@ public:
 		TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices,
 		const uint32* LodIndexOverride = nullptr);
 
+	/**
+	 * The LOD index that collision data should be read from, either the override or the Static
+	 * Mesh's LOD For Collision, clamped to the available LODs.
+	 */
+	static uint32 GetCollisionLodIndex(
+		const UStaticMesh& StaticMesh, const uint32* LodIndexOverride = nullptr);
+
+	/**
+	 * Read the triangles of the given LOD of the Static Mesh and merge vertices that share the same
+	 * position. The result is given in the Static Mesh's local coordinate system, without any
+	 * transform applied, which makes it possible to store and reuse it for any placement of the
+	 * mesh.
+	 *
+	 * Three consecutive indices in OutIndices form a triangle.
+	 */
+	static bool GetStaticMeshWeldedTriangleData(
+		const UStaticMesh& StaticMesh, uint32 LodIndex, TArray<FVector3f>& OutVertices,
+		TArray<uint32>& OutIndices);
+
+	/**
+	 * Convert welded triangle data, as produced by GetStaticMeshWeldedTriangleData, into the
+	 * representation passed to AGX Dynamics, applying the given transform to each vertex.
+	 */
+	static void TransformWeldedTriangleData(
+		const TArray<FVector3f>& Vertices, const TArray<uint32>& Indices,
+		const FTransform& Transform, TArray<FVector>& OutVertices,
+		TArray<FTriIndices>& OutIndices);
+
+	/**
+	 * Read the convex hulls stored in the simple collision of the Static Mesh and transform them
+	 * the same way as GetStaticMeshCollisionData transforms the triangle data. There is one entry
+	 * in OutVertices and OutIndices per hull.
+	 *
+	 * Only the hull vertices are read, the triangles are computed with TriangulateConvexHull since
+	 * the hulls' index data may be missing, for example in cooked builds.
+	 *
+	 * @return True if at least one hull was found.
+	 */
+	static bool GetStaticMeshConvexHulls(
+		const FAGX_MeshWithTransform& InMesh, const FTransform& RelativeTo,
+		TArray<TArray<FVector>>& OutVertices, TArray<TArray<FTriIndices>>& OutIndices);
+
+	/**
+	 * Replace Vertices with the vertices on the convex hull of the given points and fill
+	 * OutIndices with the hull's triangles, wound the same way as the render triangles of a
+	 * Static Mesh.
+	 *
+	 * @return False if the points don't span a volume.
+	 */
+	static bool TriangulateConvexHull(TArray<FVector>& Vertices, TArray<FTriIndices>& OutIndices);
+
+#if WITH_EDITOR
+	/**
+	 * Compute a convex decomposition of the given LOD of the Static Mesh, in the Static Mesh's
+	 * local coordinate system. The Static Mesh itself, including its simple collision, is not
+	 * modified. There is one entry in OutVertices and OutIndices per hull.
+	 *
+	 * @param MaxHulls The maximum number of convex hulls to generate.
+	 * @param MaxHullVertices The maximum number of vertices in each hull.
+	 * @param Resolution Voxel resolution used by the decomposition, higher is more accurate.
+	 */
+	static bool GenerateConvexDecomposition(
+		const UStaticMesh& StaticMesh, uint32 LodIndex, int32 MaxHulls, int32 MaxHullVertices,
+		int32 Resolution, TArray<TArray<FVector>>& OutVertices,
+		TArray<TArray<FTriIndices>>& OutIndices);
+#endif
+
 	static TArray<FAGX_MeshWithTransform> ToMeshWithTransformArray(
 		const TArray<AStaticMeshActor*> Actors);
 
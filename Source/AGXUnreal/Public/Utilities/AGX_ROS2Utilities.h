@@ -9,6 +9,7 @@
 #include "AGX_ROS2Utilities.generated.h"
 
 struct FAGX_LidarOutputPositionData;
+struct FAGX_LidarPointCloudFrame;
 struct FAGX_LidarOutputPositionIntensityData;
 struct FAGX_LidarScanPoint;
 struct FAGX_SensorMsgsImage;
@@ -23,6 +24,20 @@ public:
 	static FAGX_SensorMsgsImage Convert(
 		const TArray<FFloat16Color>& Image, double TimeStamp, const FIntPoint& Resolution,
 		bool Grayscale);
+
+	/**
+	 * Convert a Lidar point cloud frame into a sensor_msgs::PointCloud2 message with position x, y,
+	 * z and intensity written as floats in the platform's native byte order, i.e. 16 bytes per
+	 * point. Is Bigendian is set to match the platform.
+	 *
+	 * Same fields and offsets as UAGX_ROS2Utilities::ConvertXYZ with single precision, but the
+	 * data is written in a single pass over the frame instead of one byte at a time. On
+	 * little-endian platforms the two produce identical data. On big-endian platforms
+	 * UAGX_ROS2Utilities::ConvertXYZ still writes little endian data.
+	 */
+	static FAGX_SensorMsgsPointCloud2 ConvertXYZ(
+		const FAGX_LidarPointCloudFrame& Frame, bool ROSCoordinates = true,
+		const FString& FrameId = "");
 };
 
 UCLASS(ClassGroup = "AGX ROS2 Utilities")
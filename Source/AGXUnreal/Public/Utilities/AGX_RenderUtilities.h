@@ -9,11 +9,14 @@
 #include "AGX_RenderUtilities.generated.h"
 
 class FShapeContactBarrier;
+class UInstancedStaticMeshComponent;
+class UWorld;
 class UTextureRenderTarget2D;
 class UMaterial;
 class UStaticMesh;
 
 struct FAGX_SensorMsgsImage;
+struct FConvexVolume;
 struct FUpdateTextureRegion2D;
 
 class AGXUNREAL_API FAGX_RenderUtilities
@@ -29,6 +32,22 @@ public:
 	 */
 	static void DrawContactPoints(
 		const TArray<FShapeContactBarrier>& ShapeContacts, float LifeTime, UWorld* World);
+
+	/**
+	 * Add or remove instances at the end of the Instanced Static Mesh Component so that it has
+	 * exactly Num instances. All instances are added, or removed, in a single call. New instances
+	 * are given the identity transform.
+	 */
+	static void SetInstanceCount(UInstancedStaticMeshComponent& Component, int32 Num);
+
+	/**
+	 * Get the view frustum of the first local player's camera, as of the last camera update.
+	 *
+	 * Returns false if there is no such camera, or if more than one view was rendered last frame.
+	 * With split screen or additional scene captures an object may be visible without being
+	 * inside the first player's frustum.
+	 */
+	static bool GetPlayerViewFrustum(const UWorld& World, FConvexVolume& OutFrustum);
 };
 
 UCLASS(ClassGroup = "AGX Render Utilities")
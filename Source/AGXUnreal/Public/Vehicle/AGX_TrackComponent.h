@@ -14,6 +14,7 @@
 
 #include "AGX_TrackComponent.generated.h"
 
+class AAGX_TrackFleetRenderer;
 class UAGX_ShapeMaterial;
 class UAGX_TrackProperties;
 class UAGX_TrackInternalMergeProperties;
@@ -369,6 +370,13 @@ public:
 		Meta = (EditCondition = "bAutoScaleAndOffset"))
 	FVector LocalMeshBoundsMin {-FVector::OneVector * 50.0f};
 
+	/**
+	 * If set, this Track is rendered by the given Track Fleet Renderer during Play instead of by
+	 * its own instanced mesh. Useful when there are many tracked vehicles in the scene.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AGX Track Visual")
+	TObjectPtr<AAGX_TrackFleetRenderer> FleetRenderer;
+
 public:
 	/**
 	 * Call whenever a property etc that affects the track preview data has changed.
@@ -458,9 +466,20 @@ private:
 private:
 	void CreateVisuals();
 	void UpdateVisuals();
+
+	// UpdateVisuals split into phases so that the Simulation can run ExtractVisualTransforms on a
+	// worker thread. PrepareVisualsUpdate and ApplyVisuals must run on the game thread.
+	// ExtractVisualTransforms only reads the native, everything else is read in
+	// PrepareVisualsUpdate.
+	bool PrepareVisualsUpdate();
+	void ExtractVisualTransforms();
+	void ApplyVisuals();
+
 	bool ShouldRenderSelf() const;
+	bool IsRenderedByFleet() const;
 	void SetVisualsInstanceCount(int32 Num);
 	bool ComputeNodeTransforms(TArray<FTransform>& OutTransforms);
+	void ComputeNativeVisualTransform(FVector& OutVisualScale, FVector& OutVisualOffset) const;
 	bool ComputeVisualScaleAndOffset(
 		FVector& OutVisualScale, FVector& OutVisualOffset, const FVector& PhysicsNodeSize) const;
 	void WriteRenderMaterialsToVisualMesh();
@@ -479,12 +498,24 @@ private:
 	TArray<FTransform> NodeTransformsCache;
 	TArray<FTransform> NodeTransformsCachePrev;
 
+	// Set by PrepareVisualsUpdate for ExtractVisualTransforms. If bExtractNodeTransforms is false
+	// then NodeTransformsCache has already been filled from the preview data.
+	bool bExtractNodeTransforms {false};
+	FVector VisualScaleCache {FVector::OneVector};
+	FVector VisualOffsetCache {FVector::ZeroVector};
+	FQuat VisualRotationCache {FQuat::Identity};
+
+	// True while the visuals are updated by a Simulation visual sync job instead of on tick.
+	bool bVisualsSyncedBySimulation {false};
+
 	mutable bool MayAttemptTrackPreview = false;
 
 	mutable TSharedPtr<FAGX_TrackPreviewData> TrackPreview = nullptr;
 	mutable bool bTrackPreviewNeedsUpdate = true;
 
 	FTrackPreviewNeedsUpdateEvent TrackPreviewNeedsUpdateEvent;
+
+	friend class AAGX_TrackFleetRenderer;
 };
 
 /**
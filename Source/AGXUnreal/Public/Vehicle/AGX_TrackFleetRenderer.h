@@ -0,0 +1,166 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "ConvexVolume.h"
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#include "AGX_TrackFleetRenderer.generated.h"
+
+class UAGX_RigidBodyComponent;
+class UAGX_TrackComponent;
+class UHierarchicalInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+
+/**
+ * A track that is rendered by a Track Fleet Renderer, and where in the shared instanced mesh its
+ * nodes are.
+ */
+USTRUCT()
+struct FAGX_TrackFleetEntry
+{
+	GENERATED_BODY()
+
+	TWeakObjectPtr<UAGX_TrackComponent> Track;
+
+	// Range of mesh instances owned by this track.
+	int32 FirstInstance {0};
+	int32 NumInstances {0};
+
+	// The world space bounds of the track nodes the last time the track was updated.
+	FBox Bounds {ForceInit};
+
+	// The Rigid Body of each track wheel, and the distance from the body's origin within which
+	// the track passes around that wheel [cm]. Used to compute the current bounds of the track
+	// without reading its nodes.
+	TArray<TPair<TWeakObjectPtr<const UAGX_RigidBodyComponent>, double>> WheelBodies;
+
+	int32 NumSkippedUpdates {0};
+};
+
+/**
+ * All tracks that share the same render mesh and render materials, rendered by a single
+ * Hierarchical Instanced Static Mesh Component.
+ */
+USTRUCT()
+struct FAGX_TrackFleetBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UHierarchicalInstancedStaticMeshComponent> Mesh;
+
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> RenderMesh;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UMaterialInterface>> RenderMaterials;
+
+	TArray<FAGX_TrackFleetEntry> Tracks;
+
+	// Set when tracks have been added or removed, or a track has changed its number of nodes,
+	// so that the instance ranges must be recomputed.
+	bool bLayoutDirty {true};
+};
+
+/**
+ * Renders the track nodes of many Track Components during Play, merging all tracks that use the
+ * same Render Mesh and Render Materials into a single Hierarchical Instanced Static Mesh
+ * Component. Intended for scenes with many tracked vehicles, where one instanced mesh per track
+ * is a significant cost.
+ *
+ * A Track Component is rendered by a Track Fleet Renderer by setting the Track Component's Fleet
+ * Renderer property. Tracks far away from the camera are updated less often, and tracks outside
+ * the view frustum are not updated at all.
+ */
+UCLASS(ClassGroup = "AGX", Blueprintable, Category = "AGX")
+class AGXUNREAL_API AAGX_TrackFleetRenderer : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AAGX_TrackFleetRenderer();
+
+	/**
+	 * Tracks closer to the camera than this are updated every frame [cm]. The update interval
+	 * doubles at every doubling of the distance beyond this, up to Max Update Interval.
+	 *
+	 * Set to 0 to update all tracks every frame.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Track Fleet Renderer",
+		Meta = (ClampMin = "0.0", UIMin = "0.0"))
+	double FullRateDistance {5000.0};
+
+	/**
+	 * The largest number of frames between two updates of a track's visuals.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Track Fleet Renderer",
+		Meta = (ClampMin = "1", UIMin = "1", UIMax = "32"))
+	int32 MaxUpdateInterval {8};
+
+	/**
+	 * Do not update tracks that are outside the view frustum of the local player's camera.
+	 * The instances keep their last transforms and updating resumes when the track is in view
+	 * again.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Track Fleet Renderer")
+	bool bSkipTracksOutsideFrustum {true};
+
+	/**
+	 * Margin added around each track's bounds when testing against the view frustum [cm].
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Track Fleet Renderer",
+		Meta = (ClampMin = "0.0", UIMin = "0.0", EditCondition = "bSkipTracksOutsideFrustum"))
+	double FrustumMargin {200.0};
+
+	/**
+	 * Start rendering the given Track Component. Called by the Track Component during Begin Play
+	 * if this renderer is set as its Fleet Renderer.
+	 */
+	void Register(UAGX_TrackComponent& Track);
+
+	/**
+	 * Stop rendering the given Track Component, removing its mesh instances.
+	 */
+	void Unregister(UAGX_TrackComponent& Track);
+
+	UFUNCTION(BlueprintCallable, Category = "AGX Track Fleet Renderer")
+	int32 GetNumTracks() const;
+
+	// ~Begin AActor interface.
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type Reason) override;
+	// ~End AActor interface.
+
+private:
+	FAGX_TrackFleetBatch& GetOrCreateBatch(const UAGX_TrackComponent& Track);
+	void UpdateLayout(FAGX_TrackFleetBatch& Batch);
+	void UpdateBatch(FAGX_TrackFleetBatch& Batch);
+	bool ShouldSkipUpdate(FAGX_TrackFleetEntry& Entry) const;
+
+	/**
+	 * The current world space bounds of the track, computed from its wheel bodies. Falls back to
+	 * the bounds from the last update for tracks without wheel bodies.
+	 */
+	FBox GetCurrentBounds(const FAGX_TrackFleetEntry& Entry) const;
+
+	/// Recompute view locations and the view frustum for this frame, if any.
+	void UpdateViews();
+
+private:
+	UPROPERTY()
+	TArray<FAGX_TrackFleetBatch> Batches;
+
+	// Reused between tracks and frames so that updating doesn't allocate.
+	TArray<FTransform> NodeTransforms;
+
+	TArray<FVector> ViewLocations;
+	FConvexVolume ViewFrustum;
+	bool bHasViewFrustum {false};
+};
@@ -0,0 +1,108 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Wire/AGX_WireEnums.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+#include "AGX_WireAdaptiveResolution.generated.h"
+
+/**
+ * Settings for a Wire Component that adapts its resolution during Play to how the wire is loaded
+ * and bent. Straight, tensioned wires are simulated with long segments and bent, slack or
+ * contacting wires with short segments. The wire is not refined below its Min Segment Length
+ * unless Allow Finer Than Min Segment Length is set.
+ *
+ * AGX Dynamics has a single resolution per wire, so the segment length used is the shortest one
+ * required anywhere along the wire. Within that limit AGX Dynamics merges and splits lumped nodes
+ * locally, as configured by the Wire Parameter Controller.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_WireAdaptiveResolution
+{
+	GENERATED_BODY()
+
+	/**
+	 * The shortest segment length the wire may be refined to [cm]. Used where the wire is in
+	 * contact or sharply bent. The wire's Min Segment Length is used instead if it is longer,
+	 * unless Allow Finer Than Min Segment Length is set.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Adaptive Resolution",
+		Meta = (ClampMin = "0.1", UIMin = "0.1"))
+	double FinestSegmentLength {10.0};
+
+	/**
+	 * Whether the wire may be refined to segments shorter than its Min Segment Length, down to
+	 * Finest Segment Length.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wire Adaptive Resolution")
+	bool bAllowFinerThanMinSegmentLength {false};
+
+	/**
+	 * The longest segment length the wire may be coarsened to [cm]. Used where the wire is
+	 * straight and tensioned.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Adaptive Resolution",
+		Meta = (ClampMin = "0.1", UIMin = "0.1"))
+	double CoarsestSegmentLength {200.0};
+
+	/**
+	 * The bend angle at a node, including Eye nodes, at which the Finest Segment Length is
+	 * required [deg]. Smaller bend angles give proportionally longer segments.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Adaptive Resolution",
+		Meta = (ClampMin = "0.1", UIMin = "0.1", UIMax = "90.0"))
+	double FullRefinementAngle {20.0};
+
+	/**
+	 * Nodes with a tension below this are considered slack [N]. The wire is never coarser than
+	 * its Min Segment Length at slack nodes.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Adaptive Resolution",
+		Meta = (ClampMin = "0.0", UIMin = "0.0"))
+	double SlackTension {1.0};
+
+	/**
+	 * Time between two evaluations of the wire's resolution [s].
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Adaptive Resolution",
+		Meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float UpdateInterval {0.5f};
+
+	/**
+	 * The fraction by which the required segment length must differ from the current one for the
+	 * resolution to be changed. Prevents the wire from switching back and forth between two
+	 * resolutions.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Adaptive Resolution",
+		Meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "1.0"))
+	double Hysteresis {0.25};
+
+	/**
+	 * Compute the segment length required by the given render nodes [cm].
+	 *
+	 * @param Locations The world location of each render node [cm].
+	 * @param Types The type of each render node.
+	 * @param Tensions The tension at each render node [N].
+	 * @param MinSegmentLength The wire's Min Segment Length [cm]. The longest segment length
+	 * allowed at slack nodes and, unless finer is allowed, the shortest one used.
+	 */
+	double ComputeSegmentLength(
+		const TArray<FVector>& Locations, const TArray<EWireNodeType>& Types,
+		const TArray<double>& Tensions, double MinSegmentLength) const;
+
+	/**
+	 * @return True if a wire currently using Current Segment Length should switch to Required
+	 * Segment Length.
+	 */
+	bool ShouldChange(double CurrentSegmentLength, double RequiredSegmentLength) const;
+};
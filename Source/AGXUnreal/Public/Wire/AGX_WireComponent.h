@@ -5,9 +5,12 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_WireRenderIterator.h"
 #include "AMOR/AGX_WireMergeSplitProperties.h"
+#include "Wire/AGX_WireAdaptiveResolution.h"
 #include "Wire/AGX_WireEnums.h"
 #include "Wire/AGX_WireRoutingNode.h"
 #include "Wire/AGX_WireParameterController.h"
+#include "Wire/AGX_WireRouteCache.h"
+#include "Wire/AGX_WireVisualLod.h"
 #include "Wire/AGX_WireWinch.h"
 #include "Wire/WireBarrier.h"
 
@@ -19,6 +22,7 @@
 #include "AGX_WireComponent.generated.h"
 
 class UAGX_ShapeMaterial;
+class UAGX_WireTubeComponent;
 class UAGX_WireWinchComponent;
 class UInstancedStaticMeshComponent;
 class UMaterialInterface;
@@ -71,6 +75,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AGX Wire")
 	void SetMinSegmentLength(float InMinSegmentLength);
 
+	UPROPERTY(
+		EditAnywhere, Category = "AGX Wire",
+		Meta = (PinHiddenByDefault, InlineEditConditionToggle))
+	bool bEnableAdaptiveResolution {false};
+
+	/**
+	 * Let the wire's segment length vary during Play, between the bounds given here, based on the
+	 * tension and curvature along the wire. Min Segment Length is then used at slack parts of the
+	 * wire and is the shortest segment length used, unless finer segments are allowed.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Wire",
+		Meta = (EditCondition = "bEnableAdaptiveResolution"))
+	FAGX_WireAdaptiveResolution AdaptiveResolution;
+
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire")
+	void SetEnableAdaptiveResolution(bool bEnable);
+
+	/**
+	 * The segment length currently used by the simulation [cm]. Differs from Min Segment Length
+	 * when Adaptive Resolution is enabled.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire")
+	float GetActiveSegmentLength() const;
+
 	/**
 	 * Velocity damping value of the wire [kg/s].
 	 *
@@ -138,6 +167,57 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AGX Wire")
 	void SetRenderMaterial(UMaterialInterface* Material);
 
+	/**
+	 * How the Wire is rendered. Instanced Meshes renders one cylinder and one sphere per wire
+	 * segment. Tube renders a single smooth tube through the wire nodes, generated on the render
+	 * thread with a resolution that depends on the distance to the camera.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AGX Wire Rendering")
+	EWireRenderMode RenderMode {EWireRenderMode::InstancedMeshes};
+
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Rendering")
+	void SetRenderMode(EWireRenderMode InRenderMode);
+
+	/**
+	 * The view distance at which the tube resolution is first halved when using the Tube Render
+	 * Mode [cm]. The resolution is halved again at every doubling of the distance.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Wire Rendering",
+		Meta =
+			(EditCondition = "RenderMode == EWireRenderMode::Tube", ClampMin = "1.0",
+			 UIMin = "1.0"))
+	float TubeLodDistance {2000.f};
+
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Rendering")
+	void SetTubeLodDistance(float InTubeLodDistance);
+
+	UPROPERTY(
+		EditAnywhere, Category = "AGX Wire Rendering",
+		Meta = (PinHiddenByDefault, InlineEditConditionToggle))
+	bool bOverrideVisualLod {false};
+
+	/**
+	 * How often and how detailed the wire visuals are updated during Play, used instead of the
+	 * global Wire Visual LOD settings in the AGX Simulation settings when enabled.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Wire Rendering",
+		Meta = (EditCondition = "bOverrideVisualLod"))
+	FAGX_WireVisualLod VisualLod;
+
+	/**
+	 * Make this Wire use the given Visual LOD settings instead of the global ones.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Rendering")
+	void SetVisualLod(const FAGX_WireVisualLod& InVisualLod);
+
+	/**
+	 * Make this Wire use the global Visual LOD settings from the AGX Simulation settings.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Rendering")
+	void ClearVisualLodOverride();
+
 	/*
 	 * Begin winch.
 	 */
@@ -687,6 +767,64 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Wire Route")
 	TArray<FWireRoutingNode> RouteNodes;
 
+	/**
+	 * Whether Begin Play should restore the wire shape captured in the Route Cache, when the cache
+	 * is valid, instead of routing the wire from the Route Nodes alone.
+	 *
+	 * Eye and Body Fixed route nodes are always created from the Route Nodes. The Free route
+	 * nodes are replaced by the cached free and lumped nodes, which places the wire in the shape
+	 * it had when the cache was captured, for example a wire that has settled under gravity.
+	 *
+	 * This does not make Begin Play faster. AGX Dynamics still initializes the wire from its route
+	 * nodes, and there are more of them when restoring a captured shape.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "AGX Wire Route",
+		Meta = (DisplayName = "Restore Captured Shape"))
+	bool bUseRouteCache {false};
+
+	/**
+	 * The shape of the initialized wire, captured with Capture Route Cache during Play and
+	 * restored at Begin Play when Restore Captured Shape is enabled. Use Keep Simulation Changes to
+	 * store a cache captured in Play In Editor with the level.
+	 *
+	 * The cache is ignored, with a warning, if the radius, minimum segment length, winches,
+	 * winch Pulled In Lengths or any Route Node have changed since the cache was captured, or if
+	 * an Eye or Body Fixed node has moved relative to the Wire Component.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route", AdvancedDisplay)
+	FAGX_WireRouteCache RouteCache;
+
+	/**
+	 * Store the current node layout of the initialized wire in the Route Cache.
+	 *
+	 * @return True if the cache was captured, false if the wire is not initialized or its nodes
+	 * cannot be matched with the Route Nodes.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Route")
+	bool CaptureRouteCache();
+
+	/**
+	 * Store the given node layout in the Route Cache, as Capture Route Cache does with the render
+	 * nodes of the initialized wire.
+	 *
+	 * @param WorldLocations The world location of each node [cm].
+	 * @param Types The type of each node.
+	 * @return True if the cache was captured, false if the nodes cannot be matched with the Route
+	 * Nodes.
+	 */
+	bool CaptureRouteCacheFrom(
+		const TArray<FVector>& WorldLocations, const TArray<EWireNodeType>& Types);
+
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Route")
+	void ClearRouteCache();
+
+	/**
+	 * @return True if the Route Cache is non-empty and matches the current wire configuration.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Route")
+	bool IsRouteCacheValid() const;
+
 	/**
 	 * Create a new default-constructed routing node at the end of the wire.
 	 */
@@ -859,6 +997,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AGX Wire")
 	TArray<FVector> GetRenderNodeLocations() const;
 
+	/**
+	 * Write the world locations of all render nodes, and optionally their types and the wire
+	 * tension at each node [N], into the given arrays in a single pass. The arrays are reset but
+	 * keep their allocations, reuse them between calls to avoid allocations.
+	 *
+	 * @return False if there is no native AGX Dynamics representation.
+	 */
+	bool GetRenderNodes(
+		TArray<FVector>& OutLocations, TArray<EWireNodeType>* OutTypes = nullptr,
+		TArray<double>* OutTensions = nullptr) const;
+
 #if WITH_EDITOR
 	// Callback functions related to route node parents.
 	void OnRouteNodeParentMoved(
@@ -979,11 +1128,29 @@ private:
 	bool DoesPropertyAffectVisuals(const FName& MemberPropertyName) const;
 #endif
 
-	TArray<FVector> GetNodesForRendering() const;
+	void GetNodesForRendering(TArray<FVector>& OutNodeLocations) const;
 	bool ShouldRenderSelf() const;
 	void UpdateVisuals();
+
+	// UpdateVisuals split into phases so that the Simulation can run ExtractVisualNodes on a
+	// worker thread. PrepareVisualsUpdate and ApplyVisuals must run on the game thread.
+	// PrepareVisualsUpdate reads everything ExtractVisualNodes needs from UObjects, so that
+	// ExtractVisualNodes only reads the native wire and members of this Component.
+	bool PrepareVisualsUpdate();
+	void ExtractVisualNodes();
+	void ApplyVisuals();
 	void RenderSelf(const TArray<FVector>& Points);
 	void SetVisualsInstanceCount(int32 Num);
+	void CreateVisualTube();
+	void RenderTube(const TArray<FVector>& Points);
+
+	/// The Visual LOD settings to use this frame, nullptr if the visuals should not be reduced.
+	const FAGX_WireVisualLod* GetActiveVisualLod() const;
+	bool ShouldSkipVisualsUpdate(const FAGX_WireVisualLod& Lod);
+	bool HasVisualsToRender() const;
+
+	/// Re-evaluate the resolution when Update Interval has passed since the last evaluation.
+	void UpdateAdaptiveResolution(float DeltaTime);
 
 	friend class UAGX_LidarSurfaceMaterialComponent;
 
@@ -991,6 +1158,42 @@ private:
 	FWireBarrier NativeBarrier;
 	TObjectPtr<UInstancedStaticMeshComponent> VisualCylinders;
 	TObjectPtr<UInstancedStaticMeshComponent> VisualSpheres;
+	TObjectPtr<UAGX_WireTubeComponent> VisualTube;
+
+	// Reused between frames so that collecting the nodes to render doesn't allocate.
+	TArray<FVector> RenderNodeLocations;
+
+	// The number of frames the visuals update has been skipped due to the Visual LOD Update
+	// Interval.
+	int32 NumSkippedVisualsUpdates {0};
+
+	// Game time when the wire's render nodes were last inside the player's view [s].
+	double LastTimeInView {0.0};
+
+	// The Visual LOD settings for the visuals update in progress, set by PrepareVisualsUpdate.
+	TOptional<FAGX_WireVisualLod> ActiveVisualLod;
+
+	// Set by PrepareVisualsUpdate. If true, ExtractVisualNodes reads the render nodes from the
+	// native wire. Otherwise PrepareVisualsUpdate has already written the route node locations.
+	bool bExtractRenderNodes {false};
+
+	// The view locations rendered last frame, copied by PrepareVisualsUpdate when Visual LOD is
+	// active.
+	TArray<FVector> VisualLodViewLocations;
+
+	// True while the visuals are updated by a Simulation visual sync job instead of on tick.
+	bool bVisualsSyncedBySimulation {false};
+
+	float TimeSinceAdaptiveResolutionUpdate {0.0f};
+
+	// Reused between evaluations so that Adaptive Resolution doesn't allocate.
+	TArray<FVector> AdaptiveResolutionLocations;
+	TArray<EWireNodeType> AdaptiveResolutionTypes;
+	TArray<double> AdaptiveResolutionTensions;
+
+	// Reused between frames so that rendering doesn't allocate.
+	TArray<FTransform> VisualCylinderTransforms;
+	TArray<FTransform> VisualSphereTransforms;
 
 	/**
 	 * Keep track which node frame parents we have registered a callback with. Note that a single
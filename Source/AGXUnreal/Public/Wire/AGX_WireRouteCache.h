@@ -0,0 +1,91 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Wire/AGX_WireEnums.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+#include "AGX_WireRouteCache.generated.h"
+
+/**
+ * The node layout of an initialized wire, stored with the Wire Component so that a later Begin
+ * Play can restore the captured wire shape by routing the wire through the same nodes. The native
+ * wire is still initialized from its route, so this restores a shape but does not skip routing.
+ *
+ * The wire is split into spans at the Eye and Body Fixed nodes, the anchors. Each span holds the
+ * locations of the free and lumped nodes between two anchors, or between an anchor and a wire end.
+ * All locations are relative to the Wire Component.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_WireRouteCache
+{
+	GENERATED_BODY()
+
+	/**
+	 * The free and lumped node locations of all spans, relative to the Wire Component [cm].
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	TArray<FVector> NodeLocations;
+
+	/**
+	 * Index of the first node of each span in Node Locations. Has one more element than there
+	 * are spans, the last being the number of node locations.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	TArray<int32> SpanOffsets;
+
+	/**
+	 * The locations of the Eye and Body Fixed nodes when the cache was captured, relative to the
+	 * Wire Component [cm]. Used to detect a cache that no longer matches the route.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	TArray<FVector> AnchorLocations;
+
+	/**
+	 * The wire radius the cache was captured with [cm].
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	float Radius {0.0f};
+
+	/**
+	 * The wire minimum segment length the cache was captured with [cm].
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	float MinSegmentLength {0.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	bool bHasBeginWinch {false};
+
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	bool bHasEndWinch {false};
+
+	/**
+	 * Hash of the type and location of every Route Node, and of the winch Pulled In Lengths, the
+	 * cache was captured with. Used to detect a cache that no longer matches the route.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "AGX Wire Route Cache")
+	uint32 RouteHash {0};
+
+	bool IsEmpty() const;
+
+	void Reset();
+
+	int32 GetNumSpans() const;
+
+	TArrayView<const FVector> GetSpan(int32 SpanIndex) const;
+
+	/**
+	 * Fill the cache from the render nodes of an initialized wire. Winch internal nodes are
+	 * skipped, contact nodes are stored as free nodes.
+	 *
+	 * @param WorldLocations The world location of each render node [cm].
+	 * @param Types The type of each render node.
+	 * @param WireTransform The world transform of the Wire Component.
+	 */
+	void Capture(
+		const TArray<FVector>& WorldLocations, const TArray<EWireNodeType>& Types,
+		const FTransform& WireTransform);
+};
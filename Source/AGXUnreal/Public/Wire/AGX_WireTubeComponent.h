@@ -0,0 +1,97 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "Components/MeshComponent.h"
+#include "CoreMinimal.h"
+
+#include "AGX_WireTubeComponent.generated.h"
+
+class FPrimitiveSceneProxy;
+
+/**
+ * Renders a smooth tube through a set of node positions, used by the Wire Component's Tube render
+ * mode.
+ *
+ * Updating the nodes only copies the node positions to the render thread. There the tube is built
+ * once for every LOD level, each with fewer sides and fewer interpolated rings than the previous
+ * one, into vertex and index buffers that are kept until the next update. Each view draws the LOD
+ * level matching its distance to the tube, without rebuilding anything.
+ */
+UCLASS(
+	ClassGroup = "AGX", Meta = (BlueprintSpawnableComponent),
+	HideCategories = (Object, LOD, Physics, Collision))
+class AGXUNREAL_API UAGX_WireTubeComponent : public UMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAGX_WireTubeComponent();
+
+	/**
+	 * The number of sides of the tube when viewed from close by.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Wire Tube",
+		Meta = (ClampMin = "3", UIMin = "3", ClampMax = "64", UIMax = "64"))
+	int32 MaxSides {12};
+
+	/**
+	 * The number of interpolated rings between two consecutive nodes when viewed from close by.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Wire Tube",
+		Meta = (ClampMin = "1", UIMin = "1", ClampMax = "16", UIMax = "16"))
+	int32 MaxSubdivisions {4};
+
+	/**
+	 * The view distance at which the number of sides and subdivisions is first halved [cm]. They
+	 * are halved again at every doubling of the distance.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Wire Tube",
+		Meta = (ClampMin = "1.0", UIMin = "1.0"))
+	float LodDistance {2000.f};
+
+	/**
+	 * Set the tube resolution settings. Recreates the render state.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX Wire Tube")
+	void SetResolution(int32 InMaxSides, int32 InMaxSubdivisions, float InLodDistance);
+
+	/**
+	 * Set the nodes, in world space, that the tube passes through and the tube radius [cm].
+	 */
+	void SetNodes(const TArray<FVector>& WorldLocations, float InRadius);
+
+	/**
+	 * Remove all nodes, rendering nothing.
+	 */
+	void ClearNodes();
+
+	int32 GetNumNodes() const;
+
+	// ~Begin UPrimitiveComponent interface.
+	virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+	// ~End UPrimitiveComponent interface.
+
+	// ~Begin UMeshComponent interface.
+	virtual int32 GetNumMaterials() const override;
+	// ~End UMeshComponent interface.
+
+	// ~Begin USceneComponent interface.
+	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	// ~End USceneComponent interface.
+
+private:
+	void SendNodesToRenderThread();
+
+private:
+	// Node positions in the local frame of this component.
+	TArray<FVector3f> LocalNodes;
+	FBox LocalBox {ForceInit};
+	float Radius {0.f};
+
+	friend class FAGX_WireTubeSceneProxy;
+};
@@ -0,0 +1,68 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+#include "AGX_WireVisualLod.generated.h"
+
+/**
+ * Settings that control how often and how detailed a Wire Component's visuals are updated during
+ * Play. Does not affect the simulation, only the rendered wire.
+ *
+ * The global settings are found in the AGX Simulation settings and can be overridden per Wire
+ * Component.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_WireVisualLod
+{
+	GENERATED_BODY()
+
+	/**
+	 * Update the wire visuals only every Update Interval frame. Set to 1 to update every frame.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Visual LOD",
+		Meta = (ClampMin = "1", UIMin = "1", UIMax = "16"))
+	int32 UpdateInterval {1};
+
+	/**
+	 * The view distance at which only every second render node is used when rendering the wire
+	 * [cm]. At every doubling of the distance the number of skipped nodes doubles, up to Max Node
+	 * Stride. The first and last nodes are always rendered.
+	 *
+	 * Set to 0 to always render all nodes.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Visual LOD",
+		Meta = (ClampMin = "0.0", UIMin = "0.0"))
+	double NodeMergeDistance {5000.0};
+
+	/**
+	 * The largest number of render nodes that may be merged into a single rendered segment.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Visual LOD",
+		Meta = (ClampMin = "1", UIMin = "1", UIMax = "32"))
+	int32 MaxNodeStride {8};
+
+	/**
+	 * Stop updating the wire visuals when the wire has been outside the player's view for this
+	 * long [s]. The visuals are kept as they were and updating resumes as soon as the wire is
+	 * within view again. Whether the wire is in view is determined from the current location of
+	 * its nodes, not from its frozen visuals. With split screen, or when there is no player
+	 * camera, the wire is always considered to be in view.
+	 *
+	 * Set to 0 to always update the wire visuals.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Wire Visual LOD",
+		Meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float NotRenderedTimeout {0.5f};
+
+	/**
+	 * The number of render nodes to step over for a wire at the given view distance [cm].
+	 */
+	int32 GetNodeStride(double ViewDistance) const;
+};
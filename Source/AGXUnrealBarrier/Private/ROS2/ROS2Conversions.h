@@ -11,6 +11,76 @@
 #include <agxROS2/Qos.h>
 #include "EndAGXIncludes.h"
 
+// Standard library includes.
+#include <type_traits>
+#include <vector>
+
+//
+// Bulk array conversions.
+//
+
+namespace ROS2Conversions_helpers
+{
+	/**
+	 * Arrays of element types with the same size and representation are copied as raw memory.
+	 * Integers of different signedness are included since a static_cast between them preserves the
+	 * bit pattern. bool is excluded since std::vector<bool> is not stored as one bool per element.
+	 */
+	template <typename TargetType, typename SourceType>
+	constexpr bool CanMemcpyArray = std::is_arithmetic_v<TargetType> &&
+									std::is_arithmetic_v<SourceType> &&
+									sizeof(TargetType) == sizeof(SourceType) &&
+									std::is_floating_point_v<TargetType> ==
+										std::is_floating_point_v<SourceType> &&
+									!std::is_same_v<TargetType, bool> &&
+									!std::is_same_v<SourceType, bool>;
+}
+
+/**
+ * Copy an array of numbers from an agxROS2 message to an Unreal message. The target is sized once
+ * and, when the element types allow it, filled with a single memcpy. Other element types are
+ * converted element by element.
+ */
+template <typename TargetType, typename SourceType, typename AllocatorType>
+inline void ConvertArray(const std::vector<SourceType, AllocatorType>& In, TArray<TargetType>& Out)
+{
+	static_assert(std::is_arithmetic_v<TargetType> && std::is_arithmetic_v<SourceType>);
+	const int32 Num = static_cast<int32>(In.size());
+	Out.SetNumUninitialized(Num);
+	if constexpr (ROS2Conversions_helpers::CanMemcpyArray<TargetType, SourceType>)
+	{
+		if (Num > 0)
+			FMemory::Memcpy(Out.GetData(), In.data(), Num * sizeof(TargetType));
+	}
+	else
+	{
+		for (int32 I = 0; I < Num; ++I)
+			Out[I] = static_cast<TargetType>(In[I]);
+	}
+}
+
+/**
+ * Copy an array of numbers from an Unreal message to an agxROS2 message. Same as above but in the
+ * other direction.
+ */
+template <typename TargetType, typename SourceType, typename AllocatorType>
+inline void ConvertArray(const TArray<SourceType>& In, std::vector<TargetType, AllocatorType>& Out)
+{
+	static_assert(std::is_arithmetic_v<TargetType> && std::is_arithmetic_v<SourceType>);
+	const int32 Num = In.Num();
+	Out.resize(static_cast<size_t>(Num));
+	if constexpr (ROS2Conversions_helpers::CanMemcpyArray<TargetType, SourceType>)
+	{
+		if (Num > 0)
+			FMemory::Memcpy(Out.data(), In.GetData(), Num * sizeof(TargetType));
+	}
+	else
+	{
+		for (int32 I = 0; I < Num; ++I)
+			Out[I] = static_cast<TargetType>(In[I]);
+	}
+}
+
 //
 // Qos
 //
@@ -95,11 +165,7 @@ inline FAGX_AgxMsgsAny Convert(const agxROS2::agxMsgs::Any& InMsg)
 {
 	FAGX_AgxMsgsAny Msg;
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Value : InMsg.data)
-	{
-		Msg.Data.Add(Value);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -121,11 +187,7 @@ inline agxROS2::agxMsgs::Any Convert(const FAGX_AgxMsgsAny& InMsg)
 {
 	agxROS2::agxMsgs::Any Msg;
 
-	Msg.data.reserve(InMsg.Data.Num());
-	for (const auto& Element : InMsg.Data)
-	{
-		Msg.data.push_back(Element);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -242,11 +304,7 @@ inline FAGX_StdMsgsByteMultiArray Convert(const agxROS2::stdMsgs::ByteMultiArray
 	FAGX_StdMsgsByteMultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Value : InMsg.data)
-	{
-		Msg.Data.Add(Value);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -286,11 +344,7 @@ inline FAGX_StdMsgsFloat32MultiArray Convert(const agxROS2::stdMsgs::Float32Mult
 	FAGX_StdMsgsFloat32MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Value : InMsg.data)
-	{
-		Msg.Data.Add(Value);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -307,11 +361,7 @@ inline FAGX_StdMsgsFloat64MultiArray Convert(const agxROS2::stdMsgs::Float64Mult
 	FAGX_StdMsgsFloat64MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Value : InMsg.data)
-	{
-		Msg.Data.Add(Value);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -327,12 +377,7 @@ inline FAGX_StdMsgsInt16MultiArray Convert(const agxROS2::stdMsgs::Int16MultiArr
 {
 	FAGX_StdMsgsInt16MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
-	Msg.Data.SetNum(InMsg.data.size());
-
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-	{
-		Msg.Data[i] = static_cast<int32>(InMsg.data[i]);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -349,11 +394,7 @@ inline FAGX_StdMsgsInt32MultiArray Convert(const agxROS2::stdMsgs::Int32MultiArr
 	FAGX_StdMsgsInt32MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Value : InMsg.data)
-	{
-		Msg.Data.Add(Value);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -370,11 +411,7 @@ inline FAGX_StdMsgsInt64MultiArray Convert(const agxROS2::stdMsgs::Int64MultiArr
 	FAGX_StdMsgsInt64MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Value : InMsg.data)
-	{
-		Msg.Data.Add(Value);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -390,12 +427,7 @@ inline FAGX_StdMsgsInt8MultiArray Convert(const agxROS2::stdMsgs::Int8MultiArray
 {
 	FAGX_StdMsgsInt8MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
-	Msg.Data.SetNum(InMsg.data.size());
-
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-	{
-		Msg.Data[i] = static_cast<int32>(InMsg.data[i]);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -418,12 +450,7 @@ inline FAGX_StdMsgsUInt16MultiArray Convert(const agxROS2::stdMsgs::UInt16MultiA
 {
 	FAGX_StdMsgsUInt16MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
-	Msg.Data.SetNum(InMsg.data.size());
-
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-	{
-		Msg.Data[i] = static_cast<int32>(InMsg.data[i]);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -440,11 +467,7 @@ inline FAGX_StdMsgsUInt32MultiArray Convert(const agxROS2::stdMsgs::UInt32MultiA
 	FAGX_StdMsgsUInt32MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
 
-	Msg.Data.SetNum(InMsg.data.size());
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-	{
-		Msg.Data[i] = static_cast<int64>(InMsg.data[i]);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -460,12 +483,7 @@ inline FAGX_StdMsgsUInt64MultiArray Convert(const agxROS2::stdMsgs::UInt64MultiA
 {
 	FAGX_StdMsgsUInt64MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
-	Msg.Data.SetNum(InMsg.data.size());
-
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-	{
-		Msg.Data[i] = static_cast<int64>(InMsg.data[i]);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -482,11 +500,7 @@ inline FAGX_StdMsgsUInt8MultiArray Convert(const agxROS2::stdMsgs::UInt8MultiArr
 	FAGX_StdMsgsUInt8MultiArray Msg;
 	Msg.Layout = Convert(InMsg.layout);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Value : InMsg.data)
-	{
-		Msg.Data.Add(Value);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -540,12 +554,7 @@ inline agxROS2::stdMsgs::ByteMultiArray Convert(const FAGX_StdMsgsByteMultiArray
 {
 	agxROS2::stdMsgs::ByteMultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& ByteElement : InMsg.Data)
-	{
-		Msg.data.push_back(ByteElement);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -584,12 +593,7 @@ inline agxROS2::stdMsgs::Float32MultiArray Convert(const FAGX_StdMsgsFloat32Mult
 {
 	agxROS2::stdMsgs::Float32MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& FloatElement : InMsg.Data)
-	{
-		Msg.data.push_back(FloatElement);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -605,12 +609,7 @@ inline agxROS2::stdMsgs::Float64MultiArray Convert(const FAGX_StdMsgsFloat64Mult
 {
 	agxROS2::stdMsgs::Float64MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& DoubleElement : InMsg.Data)
-	{
-		Msg.data.push_back(DoubleElement);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -626,12 +625,7 @@ inline agxROS2::stdMsgs::Int16MultiArray Convert(const FAGX_StdMsgsInt16MultiArr
 {
 	agxROS2::stdMsgs::Int16MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& Int16Element : InMsg.Data)
-	{
-		Msg.data.push_back(static_cast<int16_t>(Int16Element));
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -647,12 +641,7 @@ inline agxROS2::stdMsgs::Int32MultiArray Convert(const FAGX_StdMsgsInt32MultiArr
 {
 	agxROS2::stdMsgs::Int32MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& Int32Element : InMsg.Data)
-	{
-		Msg.data.push_back(Int32Element);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -668,12 +657,7 @@ inline agxROS2::stdMsgs::Int64MultiArray Convert(const FAGX_StdMsgsInt64MultiArr
 {
 	agxROS2::stdMsgs::Int64MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& Int64Element : InMsg.Data)
-	{
-		Msg.data.push_back(Int64Element);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -689,12 +673,7 @@ inline agxROS2::stdMsgs::Int8MultiArray Convert(const FAGX_StdMsgsInt8MultiArray
 {
 	agxROS2::stdMsgs::Int8MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& Int8Element : InMsg.Data)
-	{
-		Msg.data.push_back(static_cast<int8_t>(Int8Element));
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -717,12 +696,7 @@ inline agxROS2::stdMsgs::UInt16MultiArray Convert(const FAGX_StdMsgsUInt16MultiA
 {
 	agxROS2::stdMsgs::UInt16MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& UInt16Element : InMsg.Data)
-	{
-		Msg.data.push_back(static_cast<uint16_t>(UInt16Element));
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -738,12 +712,7 @@ inline agxROS2::stdMsgs::UInt32MultiArray Convert(const FAGX_StdMsgsUInt32MultiA
 {
 	agxROS2::stdMsgs::UInt32MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& UInt32Element : InMsg.Data)
-	{
-		Msg.data.push_back(static_cast<uint32_t>(UInt32Element));
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -759,12 +728,7 @@ inline agxROS2::stdMsgs::UInt64MultiArray Convert(const FAGX_StdMsgsUInt64MultiA
 {
 	agxROS2::stdMsgs::UInt64MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& UInt64Element : InMsg.Data)
-	{
-		Msg.data.push_back(static_cast<uint64_t>(UInt64Element));
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -780,12 +744,7 @@ inline agxROS2::stdMsgs::UInt8MultiArray Convert(const FAGX_StdMsgsUInt8MultiArr
 {
 	agxROS2::stdMsgs::UInt8MultiArray Msg;
 	Msg.layout = Convert(InMsg.Layout);
-	Msg.data.reserve(InMsg.Data.Num());
-
-	for (const auto& UInt8Element : InMsg.Data)
-	{
-		Msg.data.push_back(UInt8Element);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -1370,17 +1329,9 @@ inline FAGX_SensorMsgsBatteryState Convert(const agxROS2::sensorMsgs::BatterySta
 	Msg.PowerSupplyTechnology = InMsg.power_supply_technology;
 	Msg.Present = InMsg.present;
 
-	Msg.CellVoltage.Reserve(InMsg.cell_voltage.size());
-	for (const auto& Value : InMsg.cell_voltage)
-	{
-		Msg.CellVoltage.Add(Value);
-	}
+	ConvertArray(InMsg.cell_voltage, Msg.CellVoltage);
 
-	Msg.CellTemperature.Reserve(InMsg.cell_temperature.size());
-	for (const auto& Value : InMsg.cell_temperature)
-	{
-		Msg.CellTemperature.Add(Value);
-	}
+	ConvertArray(InMsg.cell_temperature, Msg.CellTemperature);
 
 	Msg.Location = FString(InMsg.location.c_str());
 	Msg.SerialNumber = FString(InMsg.serial_number.c_str());
@@ -1393,9 +1344,7 @@ inline FAGX_SensorMsgsChannelFloat32 Convert(const agxROS2::sensorMsgs::ChannelF
 	FAGX_SensorMsgsChannelFloat32 Msg;
 	Msg.Name = FString(InMsg.name.c_str());
 
-	Msg.Values.SetNum(InMsg.values.size());
-	for (int32 i = 0; i < InMsg.values.size(); ++i)
-		Msg.Values[i] = InMsg.values[i];
+	ConvertArray(InMsg.values, Msg.Values);
 
 	return Msg;
 }
@@ -1406,9 +1355,7 @@ inline FAGX_SensorMsgsCompressedImage Convert(const agxROS2::sensorMsgs::Compres
 	Msg.Header = Convert(InMsg.header);
 	Msg.Format = FString(InMsg.format.c_str());
 
-	Msg.Data.SetNum(InMsg.data.size());
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-		Msg.Data[i] = InMsg.data[i];
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -1441,9 +1388,7 @@ inline FAGX_SensorMsgsImage Convert(const agxROS2::sensorMsgs::Image& InMsg)
 	Msg.IsBigendian = static_cast<uint8>(InMsg.is_bigendian);
 	Msg.Step = static_cast<int64>(InMsg.step);
 
-	Msg.Data.SetNum(InMsg.data.size());
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-		Msg.Data[i] = InMsg.data[i];
+	ConvertArray(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -1485,17 +1430,11 @@ inline FAGX_SensorMsgsJointState Convert(const agxROS2::sensorMsgs::JointState&
 	for (int32 i = 0; i < InMsg.name.size(); ++i)
 		Msg.Name[i] = FString(InMsg.name[i].c_str());
 
-	Msg.Position.SetNum(InMsg.position.size());
-	for (int32 i = 0; i < InMsg.position.size(); ++i)
-		Msg.Position[i] = InMsg.position[i];
+	ConvertArray(InMsg.position, Msg.Position);
 
-	Msg.Velocity.SetNum(InMsg.velocity.size());
-	for (int32 i = 0; i < InMsg.velocity.size(); ++i)
-		Msg.Velocity[i] = InMsg.velocity[i];
+	ConvertArray(InMsg.velocity, Msg.Velocity);
 
-	Msg.Effort.SetNum(InMsg.effort.size());
-	for (int32 i = 0; i < InMsg.effort.size(); ++i)
-		Msg.Effort[i] = InMsg.effort[i];
+	ConvertArray(InMsg.effort, Msg.Effort);
 
 	return Msg;
 }
@@ -1505,13 +1444,9 @@ inline FAGX_SensorMsgsJoy Convert(const agxROS2::sensorMsgs::Joy& InMsg)
 	FAGX_SensorMsgsJoy Msg;
 	Msg.Header = Convert(InMsg.header);
 
-	Msg.Axes.SetNum(InMsg.axes.size());
-	for (int32 i = 0; i < InMsg.axes.size(); ++i)
-		Msg.Axes[i] = InMsg.axes[i];
+	ConvertArray(InMsg.axes, Msg.Axes);
 
-	Msg.Buttons.SetNum(InMsg.buttons.size());
-	for (int32 i = 0; i < InMsg.buttons.size(); ++i)
-		Msg.Buttons[i] = InMsg.buttons[i];
+	ConvertArray(InMsg.buttons, Msg.Buttons);
 
 	return Msg;
 }
@@ -1540,9 +1475,7 @@ inline FAGX_SensorMsgsLaserEcho Convert(const agxROS2::sensorMsgs::LaserEcho& In
 {
 	FAGX_SensorMsgsLaserEcho Msg;
 
-	Msg.Echoes.SetNum(InMsg.echoes.size());
-	for (int32 i = 0; i < InMsg.echoes.size(); ++i)
-		Msg.Echoes[i] = InMsg.echoes[i];
+	ConvertArray(InMsg.echoes, Msg.Echoes);
 
 	return Msg;
 }
@@ -1559,13 +1492,9 @@ inline FAGX_SensorMsgsLaserScan Convert(const agxROS2::sensorMsgs::LaserScan& In
 	Msg.RangeMin = InMsg.range_min;
 	Msg.RangeMax = InMsg.range_max;
 
-	Msg.Ranges.SetNum(InMsg.ranges.size());
-	for (int32 i = 0; i < InMsg.ranges.size(); ++i)
-		Msg.Ranges[i] = InMsg.ranges[i];
+	ConvertArray(InMsg.ranges, Msg.Ranges);
 
-	Msg.Intensities.SetNum(InMsg.intensities.size());
-	for (int32 i = 0; i < InMsg.intensities.size(); ++i)
-		Msg.Intensities[i] = InMsg.intensities[i];
+	ConvertArray(InMsg.intensities, Msg.Intensities);
 
 	return Msg;
 }
@@ -1729,11 +1658,7 @@ inline FAGX_SensorMsgsPointCloud2 Convert(const agxROS2::sensorMsgs::PointCloud2
 	Msg.PointStep = static_cast<int64>(InMsg.point_step);
 	Msg.RowStep = static_cast<int64>(InMsg.row_step);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Byte : InMsg.data)
-	{
-		Msg.Data.Add(Byte);
-	}
+	ConvertArray(InMsg.data, Msg.Data);
 
 	Msg.IsDense = InMsg.is_dense;
 
@@ -1776,11 +1701,7 @@ inline FAGX_SensorMsgsCameraInfo Convert(const agxROS2::sensorMsgs::CameraInfo&
 	Msg.Width = static_cast<int64>(InMsg.width);
 	Msg.DistortionModel = InMsg.distortion_model.c_str();
 
-	Msg.D.Reserve(InMsg.d.size());
-	for (const auto& D : InMsg.d)
-	{
-		Msg.D.Add(D);
-	}
+	ConvertArray(InMsg.d, Msg.D);
 
 	for (int i = 0; i < 9; ++i)
 	{
@@ -1868,11 +1789,7 @@ inline agxROS2::sensorMsgs::ChannelFloat32 Convert(const FAGX_SensorMsgsChannelF
 	agxROS2::sensorMsgs::ChannelFloat32 Msg;
 	Msg.name = TCHAR_TO_UTF8(*InMsg.Name);
 
-	Msg.values.reserve(InMsg.Values.Num());
-	for (float Value : InMsg.Values)
-	{
-		Msg.values.push_back(Value);
-	}
+	ConvertArray(InMsg.Values, Msg.values);
 
 	return Msg;
 }
@@ -1883,11 +1800,7 @@ inline agxROS2::sensorMsgs::CompressedImage Convert(const FAGX_SensorMsgsCompres
 	Msg.header = Convert(InMsg.Header);
 	Msg.format = TCHAR_TO_UTF8(*InMsg.Format);
 
-	Msg.data.reserve(InMsg.Data.Num());
-	for (uint8 Value : InMsg.Data)
-	{
-		Msg.data.push_back(Value);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -1922,11 +1835,7 @@ inline agxROS2::sensorMsgs::Image Convert(const FAGX_SensorMsgsImage& InMsg)
 	Msg.is_bigendian = InMsg.IsBigendian;
 	Msg.step = static_cast<uint32_t>(InMsg.Step);
 
-	Msg.data.reserve(InMsg.Data.Num());
-	for (uint8 Value : InMsg.Data)
-	{
-		Msg.data.push_back(Value);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -1973,23 +1882,11 @@ inline agxROS2::sensorMsgs::JointState Convert(const FAGX_SensorMsgsJointState&
 		Msg.name.push_back(TCHAR_TO_UTF8(*Value));
 	}
 
-	Msg.position.reserve(InMsg.Position.Num());
-	for (double Value : InMsg.Position)
-	{
-		Msg.position.push_back(Value);
-	}
+	ConvertArray(InMsg.Position, Msg.position);
 
-	Msg.velocity.reserve(InMsg.Velocity.Num());
-	for (double Value : InMsg.Velocity)
-	{
-		Msg.velocity.push_back(Value);
-	}
+	ConvertArray(InMsg.Velocity, Msg.velocity);
 
-	Msg.effort.reserve(InMsg.Effort.Num());
-	for (double Value : InMsg.Effort)
-	{
-		Msg.effort.push_back(Value);
-	}
+	ConvertArray(InMsg.Effort, Msg.effort);
 
 	return Msg;
 }
@@ -1999,17 +1896,9 @@ inline agxROS2::sensorMsgs::Joy Convert(const FAGX_SensorMsgsJoy& InMsg)
 	agxROS2::sensorMsgs::Joy Msg;
 	Msg.header = Convert(InMsg.Header);
 
-	Msg.axes.reserve(InMsg.Axes.Num());
-	for (float Value : InMsg.Axes)
-	{
-		Msg.axes.push_back(Value);
-	}
+	ConvertArray(InMsg.Axes, Msg.axes);
 
-	Msg.buttons.reserve(InMsg.Buttons.Num());
-	for (int32 Value : InMsg.Buttons)
-	{
-		Msg.buttons.push_back(Value);
-	}
+	ConvertArray(InMsg.Buttons, Msg.buttons);
 
 	return Msg;
 }
@@ -2041,11 +1930,7 @@ inline agxROS2::sensorMsgs::LaserEcho Convert(const FAGX_SensorMsgsLaserEcho& In
 {
 	agxROS2::sensorMsgs::LaserEcho Msg;
 
-	Msg.echoes.reserve(InMsg.Echoes.Num());
-	for (float Value : InMsg.Echoes)
-	{
-		Msg.echoes.push_back(Value);
-	}
+	ConvertArray(InMsg.Echoes, Msg.echoes);
 
 	return Msg;
 }
@@ -2062,17 +1947,9 @@ inline agxROS2::sensorMsgs::LaserScan Convert(const FAGX_SensorMsgsLaserScan& In
 	Msg.range_min = InMsg.RangeMin;
 	Msg.range_max = InMsg.RangeMax;
 
-	Msg.ranges.reserve(InMsg.Ranges.Num());
-	for (float Value : InMsg.Ranges)
-	{
-		Msg.ranges.push_back(Value);
-	}
+	ConvertArray(InMsg.Ranges, Msg.ranges);
 
-	Msg.intensities.reserve(InMsg.Intensities.Num());
-	for (float Value : InMsg.Intensities)
-	{
-		Msg.intensities.push_back(Value);
-	}
+	ConvertArray(InMsg.Intensities, Msg.intensities);
 
 	return Msg;
 }
@@ -2231,11 +2108,7 @@ inline agxROS2::sensorMsgs::PointCloud2 Convert(const FAGX_SensorMsgsPointCloud2
 	Msg.row_step = InMsg.RowStep;
 	Msg.is_dense = InMsg.IsDense;
 
-	Msg.data.reserve(InMsg.Data.Num());
-	for (uint8 Value : InMsg.Data)
-	{
-		Msg.data.push_back(Value);
-	}
+	ConvertArray(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -2273,11 +2146,7 @@ inline agxROS2::sensorMsgs::CameraInfo Convert(const FAGX_SensorMsgsCameraInfo&
 	Msg.width = static_cast<uint32_t>(InMsg.Width);
 	Msg.distortion_model = TCHAR_TO_UTF8(*InMsg.DistortionModel);
 
-	Msg.d.reserve(InMsg.D.Num());
-	for (double Value : InMsg.D)
-	{
-		Msg.d.push_back(Value);
-	}
+	ConvertArray(InMsg.D, Msg.d);
 
 	{
 		const int32 Maxk = std::min(InMsg.K.Num(), 9);
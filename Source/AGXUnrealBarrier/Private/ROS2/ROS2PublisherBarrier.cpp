@@ -7,9 +7,23 @@
 #include "AGXROS2Types.h"
 #include "ROS2/AGX_ROS2Messages.h"
 #include "ROS2/ROS2Conversions.h"
+#include "Sensors/AGX_LidarOutputTypes.h"
+#include "Sensors/LidarOutputPositionIntensityBarrier.h"
+#include "Sensors/SensorRef.h"
 #include "TypeConversions.h"
 #include "Utilities/ROS2Utilities.h"
 
+// AGX Dynamics includes.
+#include "BeginAGXIncludes.h"
+#include <agxSensor/RaytraceOutput.h>
+#include "EndAGXIncludes.h"
+
+// Unreal Engine includes.
+#include "Math/VectorRegister.h"
+
+// Standard library includes.
+#include <cstring>
+
 // Helper macros to minimize amount of code needed in large switch-statement.
 #define AGX_SEND_ROS2_MSGS(PubType, MsgType)                                                       \
 	{                                                                                              \
@@ -38,6 +52,95 @@
 		return;                                                       \
 	}
 
+namespace ROS2PublisherBarrier_helpers
+{
+	// Matches the layout of the native XYZ_VEC3_F32 + INTENSITY_F32 Lidar output and of the
+	// PointCloud2 message written by the SendPointCloud2XYZI functions.
+	struct FPointXYZI
+	{
+		float X;
+		float Y;
+		float Z;
+		float Intensity;
+	};
+
+	static_assert(sizeof(FPointXYZI) == 16);
+	static_assert(sizeof(FAGX_LidarOutputPositionIntensityData) == sizeof(FPointXYZI));
+
+	// Centimeter to meter.
+	constexpr float CmToM = 0.01f;
+
+	const FPublisherPointCloud2* GetPointCloud2Publisher(
+		const FROS2Publisher* Native, EAGX_ROS2MessageType MessageType)
+	{
+		if (MessageType != EAGX_ROS2MessageType::SensorMsgsPointCloud2)
+		{
+			UE_LOG(
+				LogAGX, Error,
+				TEXT("FROS2PublisherBarrier::SendPointCloud2XYZI called on a Publisher that is not "
+					 "of type sensor_msgs::PointCloud2. The message will not be sent."));
+			return nullptr;
+		}
+
+		auto Pub = dynamic_cast<const FPublisherPointCloud2*>(Native);
+		if (Pub == nullptr)
+		{
+			UE_LOG(
+				LogAGX, Error,
+				TEXT("Unexpected internal error: unable to downcast to the correct Publisher type "
+					 "in FROS2PublisherBarrier::SendPointCloud2XYZI. The message will not be "
+					 "sent."));
+		}
+
+		return Pub;
+	}
+
+	agxROS2::sensorMsgs::PointField MakePointField(const char* Name, uint32 Offset)
+	{
+		agxROS2::sensorMsgs::PointField Field;
+		Field.name = Name;
+		Field.offset = Offset;
+		Field.datatype = 7; // FLOAT32.
+		Field.count = 1;
+		return Field;
+	}
+
+	/**
+	 * Setup everything but the point data, which is sized but left for the caller to write.
+	 */
+	agxROS2::sensorMsgs::PointCloud2 MakePointCloud2XYZI(
+		int32 NumPoints, double TimeStamp, const FString& FrameId)
+	{
+		agxROS2::sensorMsgs::PointCloud2 Msg;
+		Msg.header.stamp.sec = static_cast<int32>(TimeStamp);
+		Msg.header.stamp.nanosec =
+			static_cast<uint32>(static_cast<int64>(TimeStamp * 1.0E9) % 1000000000);
+		Msg.header.frame_id = TCHAR_TO_UTF8(*FrameId);
+
+		Msg.fields.reserve(4);
+		Msg.fields.push_back(MakePointField("x", 0));
+		Msg.fields.push_back(MakePointField("y", 4));
+		Msg.fields.push_back(MakePointField("z", 8));
+		Msg.fields.push_back(MakePointField("intensity", 12));
+
+		// The points are unordered, so height is 1 and width is the number of points.
+		Msg.height = 1;
+		Msg.width = static_cast<uint32>(NumPoints);
+		Msg.point_step = sizeof(FPointXYZI);
+		Msg.row_step = Msg.width * Msg.point_step;
+		Msg.is_bigendian = !PLATFORM_LITTLE_ENDIAN;
+		Msg.is_dense = true;
+		Msg.data.resize(static_cast<size_t>(NumPoints) * sizeof(FPointXYZI));
+		return Msg;
+	}
+
+	void Send(const FPublisherPointCloud2& Pub, agxROS2::sensorMsgs::PointCloud2& Msg)
+	{
+		Pub.Native->sendMessage(Msg);
+		AGX_ROS2Utilities::FreeContainers(Msg);
+	}
+}
+
 FROS2PublisherBarrier::FROS2PublisherBarrier()
 {
 }
@@ -488,6 +591,91 @@ bool FROS2PublisherBarrier::SendMsg(const FAGX_ROS2Message& Msg) const
 	return false;
 }
 
+bool FROS2PublisherBarrier::SendPointCloud2XYZI(
+	const FLidarOutputPositionIntensityBarrier& Output, double TimeStamp,
+	const FString& FrameId) const
+{
+	using namespace ROS2PublisherBarrier_helpers;
+	check(HasNative());
+	check(Output.HasNative());
+
+	const FPublisherPointCloud2* Pub = GetPointCloud2Publisher(Native.get(), MessageType);
+	if (Pub == nullptr)
+		return false;
+
+	agxSensor::RtOutput* OutputAGX = Output.GetNative()->Native;
+	if (OutputAGX->getElementSize() != sizeof(FPointXYZI))
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("FROS2PublisherBarrier::SendPointCloud2XYZI got a Lidar Output with unexpected "
+				 "element size %d. The message will not be sent."),
+			static_cast<int32>(OutputAGX->getElementSize()));
+		return false;
+	}
+
+	agxSensor::BinaryOutputView<FPointXYZI> ViewAGX = OutputAGX->view<FPointXYZI>();
+	const int32 NumPoints = static_cast<int32>(ViewAGX.size());
+
+	// AGX Dynamics already uses ROS2 units and coordinates, so no conversion is needed.
+	agxROS2::sensorMsgs::PointCloud2 Msg = MakePointCloud2XYZI(NumPoints, TimeStamp, FrameId);
+	if (NumPoints > 0)
+		std::memcpy(Msg.data.data(), &ViewAGX[0], Msg.data.size());
+
+	Send(*Pub, Msg);
+	return true;
+}
+
+bool FROS2PublisherBarrier::SendPointCloud2XYZI(
+	const TArray<FAGX_LidarOutputPositionIntensityData>& Data, double TimeStamp,
+	const FString& FrameId) const
+{
+	using namespace ROS2PublisherBarrier_helpers;
+	check(HasNative());
+
+	const FPublisherPointCloud2* Pub = GetPointCloud2Publisher(Native.get(), MessageType);
+	if (Pub == nullptr)
+		return false;
+
+	const int32 NumPoints = Data.Num();
+	agxROS2::sensorMsgs::PointCloud2 Msg = MakePointCloud2XYZI(NumPoints, TimeStamp, FrameId);
+
+	// The input is already interleaved as x, y, z, intensity, so each point is converted with a
+	// single four-wide multiply. Y is negated since Unreal is left handed and ROS2 right handed.
+	const VectorRegister4Float ToROS = MakeVectorRegisterFloat(CmToM, -CmToM, CmToM, 1.f);
+	const float* Source = reinterpret_cast<const float*>(Data.GetData());
+	float* Target = reinterpret_cast<float*>(Msg.data.data());
+	for (int32 I = 0; I < NumPoints; ++I)
+	{
+		VectorStore(VectorMultiply(VectorLoad(Source + I * 4), ToROS), Target + I * 4);
+	}
+
+	Send(*Pub, Msg);
+	return true;
+}
+
+bool FROS2PublisherBarrier::SendPointCloud2XYZI(
+	const float* X, const float* Y, const float* Z, const float* Intensity, int32 NumPoints,
+	double TimeStamp, const FString& FrameId) const
+{
+	using namespace ROS2PublisherBarrier_helpers;
+	check(HasNative());
+
+	const FPublisherPointCloud2* Pub = GetPointCloud2Publisher(Native.get(), MessageType);
+	if (Pub == nullptr)
+		return false;
+
+	agxROS2::sensorMsgs::PointCloud2 Msg = MakePointCloud2XYZI(NumPoints, TimeStamp, FrameId);
+	FPointXYZI* Target = reinterpret_cast<FPointXYZI*>(Msg.data.data());
+	for (int32 I = 0; I < NumPoints; ++I)
+	{
+		Target[I] = {X[I] * CmToM, Y[I] * -CmToM, Z[I] * CmToM, Intensity[I]};
+	}
+
+	Send(*Pub, Msg);
+	return true;
+}
+
 void FROS2PublisherBarrier::ReleaseNative()
 {
 	Native = nullptr;
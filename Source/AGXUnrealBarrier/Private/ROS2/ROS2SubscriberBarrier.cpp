@@ -15,7 +15,12 @@
 #include <agxROS2/ROS2Util.h>
 #include "EndAGXIncludes.h"
 
+// Standard library includes.
+#include <utility>
+
 // Helper macros to minimize amount of code needed in large switch-statement.
+// With bLatestOnly set, all messages waiting in the native queue are taken but only the newest is
+// converted.
 #define AGX_RECEIVE_ROS2_MSGS(SubType, MsgTypeUnreal, MsgTypeROS2)                              \
 	{                                                                                           \
 		if (auto Sub = dynamic_cast<const SubType*>(Native.get()))                              \
@@ -23,6 +28,13 @@
 			MsgTypeROS2 MsgAGX;                                                                 \
 			if (Sub->Native->receiveMessage(MsgAGX))                                            \
 			{                                                                                   \
+				if (bLatestOnly)                                                                \
+				{                                                                               \
+					MsgTypeROS2 NextAGX;                                                        \
+					while (Sub->Native->receiveMessage(NextAGX))                                \
+						std::swap(MsgAGX, NextAGX);                                             \
+					agxROS2::freeContainerMemory(NextAGX);                                      \
+				}                                                                               \
 				*static_cast<MsgTypeUnreal*>(&OutMsg) = Convert(MsgAGX);                        \
 				agxROS2::freeContainerMemory(MsgAGX);                                           \
 				return true;                                                                    \
@@ -306,6 +318,16 @@ void FROS2SubscriberBarrier::ReleaseNative()
 }
 
 bool FROS2SubscriberBarrier::ReceiveMessage(FAGX_ROS2Message& OutMsg) const
+{
+	return Receive(OutMsg, false);
+}
+
+bool FROS2SubscriberBarrier::ReceiveLatestMessage(FAGX_ROS2Message& OutMsg) const
+{
+	return Receive(OutMsg, true);
+}
+
+bool FROS2SubscriberBarrier::Receive(FAGX_ROS2Message& OutMsg, bool bLatestOnly) const
 {
 	using namespace agxROS2::agxMsgs;
 	using namespace agxROS2::builtinInterfaces;
@@ -0,0 +1,137 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#include "ROS2/ROS2TestUtilities.h"
+
+// AGX Dynamics for Unreal includes.
+#include "ROS2/ROS2Conversions.h"
+#include "Utilities/ROS2Utilities.h"
+
+// Unreal Engine includes.
+#include "HAL/PlatformTime.h"
+
+namespace ROS2TestUtilities_helpers
+{
+	template <typename MessageType>
+	MessageType RoundTrip(
+		const MessageType& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+	{
+		const double ToNativeStart = FPlatformTime::Seconds();
+		auto MsgAGX = Convert(Msg);
+		OutToNativeTime = FPlatformTime::Seconds() - ToNativeStart;
+
+		const double FromNativeStart = FPlatformTime::Seconds();
+		MessageType Result = Convert(MsgAGX);
+		OutFromNativeTime = FPlatformTime::Seconds() - FromNativeStart;
+
+		AGX_ROS2Utilities::FreeContainers(MsgAGX);
+		return Result;
+	}
+}
+
+FAGX_AgxMsgsAny FROS2TestUtilities::RoundTrip(
+	const FAGX_AgxMsgsAny& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsByteMultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsByteMultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsFloat32MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsFloat32MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsFloat64MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsFloat64MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsInt8MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsInt8MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsInt16MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsInt16MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsInt32MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsInt32MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsInt64MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsInt64MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsUInt8MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsUInt8MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsUInt16MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsUInt16MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsUInt32MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsUInt32MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_StdMsgsUInt64MultiArray FROS2TestUtilities::RoundTrip(
+	const FAGX_StdMsgsUInt64MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_SensorMsgsCompressedImage FROS2TestUtilities::RoundTrip(
+	const FAGX_SensorMsgsCompressedImage& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_SensorMsgsImage FROS2TestUtilities::RoundTrip(
+	const FAGX_SensorMsgsImage& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_SensorMsgsJointState FROS2TestUtilities::RoundTrip(
+	const FAGX_SensorMsgsJointState& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_SensorMsgsJoy FROS2TestUtilities::RoundTrip(
+	const FAGX_SensorMsgsJoy& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_SensorMsgsLaserScan FROS2TestUtilities::RoundTrip(
+	const FAGX_SensorMsgsLaserScan& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
+
+FAGX_SensorMsgsPointCloud2 FROS2TestUtilities::RoundTrip(
+	const FAGX_SensorMsgsPointCloud2& Msg, double& OutToNativeTime, double& OutFromNativeTime)
+{
+	return ROS2TestUtilities_helpers::RoundTrip(Msg, OutToNativeTime, OutFromNativeTime);
+}
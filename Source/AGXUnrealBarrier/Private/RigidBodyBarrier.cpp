@@ -325,6 +325,48 @@ void FRigidBodyBarrier::AllocateNative()
 	MassProperties.BindTo(*NativeRef);
 }
 
+void FRigidBodyBarrier::AllocateNativeClone(
+	const FRigidBodyBarrier& Prototype, const TArray<const FShapeBarrier*>& PrototypeShapes,
+	TArray<uintptr_t>& OutShapeAddresses)
+{
+	check(!HasNative());
+	check(Prototype.HasNative());
+	agx::RigidBody* Source = Prototype.NativeRef->Native.get();
+	NativeRef->Native = Source->clone();
+	MassProperties.BindTo(*NativeRef);
+
+	// The geometries, and the shapes within each geometry, are cloned in order. A shape is found
+	// in the clone at the same geometry and shape index as in the prototype.
+	const agxCollide::GeometryRefVector& SourceGeometries = Source->getGeometries();
+	const agxCollide::GeometryRefVector& CloneGeometries = NativeRef->Native->getGeometries();
+	OutShapeAddresses.Init(0, PrototypeShapes.Num());
+	for (int32 I = 0; I < PrototypeShapes.Num(); ++I)
+	{
+		const FShapeBarrier* Shape = PrototypeShapes[I];
+		if (Shape == nullptr || !Shape->HasNative())
+			continue;
+
+		const FGeometryAndShapeRef& ShapeRef = *Shape->GetNative();
+		for (size_t G = 0; G < SourceGeometries.size() && G < CloneGeometries.size(); ++G)
+		{
+			if (SourceGeometries[G].get() != ShapeRef.NativeGeometry.get())
+				continue;
+
+			const agxCollide::ShapeRefVector& SourceShapes = SourceGeometries[G]->getShapes();
+			const agxCollide::ShapeRefVector& CloneShapes = CloneGeometries[G]->getShapes();
+			for (size_t S = 0; S < SourceShapes.size() && S < CloneShapes.size(); ++S)
+			{
+				if (SourceShapes[S].get() == ShapeRef.NativeShape.get())
+				{
+					OutShapeAddresses[I] = reinterpret_cast<uintptr_t>(CloneShapes[S].get());
+					break;
+				}
+			}
+			break;
+		}
+	}
+}
+
 FRigidBodyRef* FRigidBodyBarrier::GetNative()
 {
 	check(HasNative());
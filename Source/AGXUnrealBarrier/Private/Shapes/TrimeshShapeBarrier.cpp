@@ -9,6 +9,8 @@
 
 // AGX Dynamics includes.
 #include "BeginAGXIncludes.h"
+#include <agxCollide/Convex.h>
+#include <agxCollide/Geometry.h>
 #include <agxCollide/Trimesh.h>
 #include "EndAGXIncludes.h"
 
@@ -282,6 +284,78 @@ void FTrimeshShapeBarrier::AllocateNative(
 	// Temporary allocation parameters structure destroyed by smart pointer.
 }
 
+void FTrimeshShapeBarrier::AllocateNativeShared(const FTrimeshShapeBarrier& Source)
+{
+	check(Source.HasNative());
+	// AllocationParameters stores a reference to the name, so it must outlive the allocation.
+	const FString SourceName = Source.GetSourceName();
+	{
+		std::shared_ptr<AllocationParameters> Params =
+			std::make_shared<AllocationParameters>(SourceName);
+		Params->SharedSource = &Source;
+
+		TemporaryAllocationParameters = Params;
+
+		FShapeBarrier::AllocateNative(); // Will implicitly invoke AllocateNativeShape().
+	}
+}
+
+void FTrimeshShapeBarrier::AllocateNativeConvexDecomposition(
+	const TArray<TArray<FVector>>& HullVertices, const TArray<TArray<FTriIndices>>& HullIndices,
+	bool bClockwise, const FString& SourceName)
+{
+	check(HullVertices.Num() > 0);
+	check(HullVertices.Num() == HullIndices.Num());
+
+	{
+		// The first hull is created through the regular shape allocation path so that the
+		// barrier's NativeShape is set up the same way as for a single Trimesh.
+
+		std::shared_ptr<AllocationParameters> Params =
+			std::make_shared<AllocationParameters>(SourceName);
+		Params->Vertices = &HullVertices[0];
+		Params->TriIndices = &HullIndices[0];
+		Params->bClockwise = bClockwise;
+		Params->bConvex = true;
+
+		TemporaryAllocationParameters = Params;
+
+		FShapeBarrier::AllocateNative(); // Will implicitly invoke AllocateNativeShape().
+	}
+
+	const agxCollide::Trimesh::TrimeshOptionsFlags OptionsMask =
+		bClockwise ? agxCollide::Trimesh::TrimeshOptionsFlags::CLOCKWISE_ORIENTATION
+				   : static_cast<agxCollide::Trimesh::TrimeshOptionsFlags>(0);
+	const agx::String NativeSourceName = Convert(SourceName);
+
+	for (int32 I = 1; I < HullVertices.Num(); ++I)
+	{
+		const agx::Vec3Vector NativeVertices = ConvertVertices(HullVertices[I]);
+		const agx::UInt32Vector NativeIndices = ConvertIndices(HullIndices[I]);
+		agxCollide::ConvexRef Convex = new agxCollide::Convex(
+			&NativeVertices, &NativeIndices, NativeSourceName.c_str(), OptionsMask);
+		NativeRef->NativeGeometry->add(Convex);
+	}
+}
+
+int32 FTrimeshShapeBarrier::GetNumConvexHulls() const
+{
+	if (!HasNative())
+	{
+		return 0;
+	}
+
+	int32 NumConvex = 0;
+	for (const agxCollide::ShapeRef& Shape : NativeRef->NativeGeometry->getShapes())
+	{
+		if (Shape->getType() == agxCollide::Shape::CONVEX)
+		{
+			++NumConvex;
+		}
+	}
+	return NumConvex;
+}
+
 void FTrimeshShapeBarrier::AllocateNativeShape()
 {
 	check(!HasNative());
@@ -291,6 +365,13 @@ void FTrimeshShapeBarrier::AllocateNativeShape()
 	std::shared_ptr<AllocationParameters> Params = TemporaryAllocationParameters.lock();
 	check(Params != nullptr);
 
+	if (Params->SharedSource != nullptr)
+	{
+		// A cloned Trimesh references the same collision mesh data as the original.
+		NativeRef->NativeShape = Params->SharedSource->GetNative()->NativeShape->clone();
+		return;
+	}
+
 	// Transfer to native buffers.
 	const agx::Vec3Vector NativeVertices = ConvertVertices(*Params->Vertices);
 	const agx::UInt32Vector NativeIndices = ConvertIndices(*Params->TriIndices);
@@ -301,6 +382,13 @@ void FTrimeshShapeBarrier::AllocateNativeShape()
 
 	// Create the native object.
 
+	if (Params->bConvex)
+	{
+		NativeRef->NativeShape = new agxCollide::Convex(
+			&NativeVertices, &NativeIndices, Convert(Params->SourceName).c_str(), OptionsMask);
+		return;
+	}
+
 	NativeRef->NativeShape = new agxCollide::Trimesh(
 		&NativeVertices, &NativeIndices, Convert(Params->SourceName).c_str(), OptionsMask);
 }
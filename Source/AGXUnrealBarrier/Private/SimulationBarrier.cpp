@@ -84,6 +84,30 @@ bool FSimulationBarrier::Add(FShapeBarrier& Shape)
 	return NativeRef->Native->add(Shape.GetNative()->NativeGeometry);
 }
 
+bool FSimulationBarrier::Add(
+	const TArray<FRigidBodyBarrier*>& Bodies, const TArray<FShapeBarrier*>& Shapes,
+	TArray<int32>& OutFailedBodies, TArray<int32>& OutFailedShapes)
+{
+	check(HasNative());
+	agxSDK::Simulation* Simulation = NativeRef->Native.get();
+
+	for (int32 I = 0; I < Bodies.Num(); ++I)
+	{
+		check(Bodies[I]->HasNative());
+		if (!Simulation->add(Bodies[I]->GetNative()->Native, /*addGeometries*/ false))
+			OutFailedBodies.Add(I);
+	}
+
+	for (int32 I = 0; I < Shapes.Num(); ++I)
+	{
+		check(Shapes[I]->HasNative());
+		if (!Simulation->add(Shapes[I]->GetNative()->NativeGeometry))
+			OutFailedShapes.Add(I);
+	}
+
+	return OutFailedBodies.Num() == 0 && OutFailedShapes.Num() == 0;
+}
+
 bool FSimulationBarrier::Add(FShapeMaterialBarrier& Material)
 {
 	check(HasNative());
@@ -18,6 +18,7 @@
 // AGX Dynamics includes.
 #include "BeginAGXIncludes.h"
 #include <agx/Material.h>
+#include <agxWire/RenderIterator.h>
 #include "EndAGXIncludes.h"
 
 FWireBarrier::FWireBarrier()
@@ -251,7 +252,7 @@ double FWireBarrier::GetTension() const
 	check(HasNative());
 	agxWire::WireSegmentTensionData Data = NativeRef->Native->getTension(agx::Real(0.0));
 
-	/// \todo Do tension need conversion to Unreal units?
+	// Forces are in Newton in both AGX Dynamics and AGX Dynamics for Unreal.
 	return Data.raw;
 }
 
@@ -308,6 +309,64 @@ FWireRenderIteratorBarrier FWireBarrier::GetRenderEndIterator() const
 	return {std::make_unique<agxWire::RenderIterator>(NativeRef->Native->getRenderEndIterator())};
 }
 
+void FWireBarrier::GetRenderNodes(
+	TArray<FVector>& OutLocations, TArray<EWireNodeType>* OutTypes,
+	TArray<double>* OutTensions) const
+{
+	check(HasNative());
+	OutLocations.Reset();
+	if (OutTypes != nullptr)
+		OutTypes->Reset();
+	if (OutTensions != nullptr)
+		OutTensions->Reset();
+
+	agxWire::Wire* Wire = NativeRef->Native.get();
+	agx::Real Tension {0.0};
+	for (agxWire::RenderIterator It = Wire->getRenderBeginIterator(),
+								 End = Wire->getRenderEndIterator();
+		 It != End; It.inc())
+	{
+		const agxWire::Node* Node = It.get();
+		const agxWire::Node::Type Type = Node->getType();
+		OutLocations.Add(ConvertDisplacement(Node->getWorldPosition()));
+
+		if (OutTypes != nullptr)
+			OutTypes->Add(Convert(Type));
+
+		if (OutTensions != nullptr)
+		{
+			// Looking the tension up by distance from start walks the wire from the beginning,
+			// which is quadratic in the number of nodes. Instead the tension is read from the
+			// nodes that own tension data, the nodes that end a lumped segment. Contact and Eye
+			// nodes lie within a segment and are given the tension of the segment they are on,
+			// which is carried over from the previous node.
+			if (Type != agxWire::Node::CONTACT && Type != agxWire::Node::SHAPE_CONTACT &&
+				Type != agxWire::Node::EYE)
+			{
+				Tension = Wire->getTension(Node).raw;
+			}
+
+			// Forces are in Newton in both AGX Dynamics and AGX Dynamics for Unreal.
+			OutTensions->Add(Tension);
+		}
+	}
+}
+
+FBox FWireBarrier::GetRenderNodeBounds() const
+{
+	check(HasNative());
+	FBox Bounds(ForceInit);
+	agxWire::Wire* Wire = NativeRef->Native.get();
+	for (agxWire::RenderIterator It = Wire->getRenderBeginIterator(),
+								 End = Wire->getRenderEndIterator();
+		 It != End; It.inc())
+	{
+		Bounds += ConvertDisplacement(It.get()->getWorldPosition());
+	}
+
+	return Bounds;
+}
+
 bool FWireBarrier::IsLumpedNode(const FWireNodeBarrier& Node) const
 {
 	check(HasNative());
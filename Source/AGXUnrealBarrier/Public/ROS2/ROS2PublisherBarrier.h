@@ -8,9 +8,11 @@
 // Standard library includes.
 #include <memory>
 
+struct FAGX_LidarOutputPositionIntensityData;
 struct FAGX_ROS2Message;
 struct FAGX_ROS2Qos;
 struct FROS2Publisher;
+class FLidarOutputPositionIntensityBarrier;
 
 class AGXUNREALBARRIER_API FROS2PublisherBarrier
 {
@@ -37,6 +39,37 @@ public:
 	// causes link error on Windows.
 	bool SendMsg(const FAGX_ROS2Message& Msg) const;
 
+	/**
+	 * The SendPointCloud2XYZI functions write Lidar points straight into a native
+	 * sensor_msgs::PointCloud2 message, bypassing FAGX_SensorMsgsPointCloud2. The message has the
+	 * float32 fields x, y, z [m] and intensity, i.e. 16 bytes per point, in ROS2 coordinates and in
+	 * the byte order of the platform. Only valid for Publishers of type SensorMsgsPointCloud2.
+	 */
+
+	/**
+	 * Send the current data of a native Lidar Output. The native data is already in ROS2 units and
+	 * coordinates and is copied into the message as a single block.
+	 */
+	bool SendPointCloud2XYZI(
+		const FLidarOutputPositionIntensityBarrier& Output, double TimeStamp,
+		const FString& FrameId) const;
+
+	/**
+	 * Send interleaved points given in Unreal units and coordinates [cm], such as the data read
+	 * from a Lidar Output Position Intensity.
+	 */
+	bool SendPointCloud2XYZI(
+		const TArray<FAGX_LidarOutputPositionIntensityData>& Data, double TimeStamp,
+		const FString& FrameId) const;
+
+	/**
+	 * Send points stored as one array per field, given in Unreal units and coordinates [cm]. Each
+	 * array must hold NumPoints elements.
+	 */
+	bool SendPointCloud2XYZI(
+		const float* X, const float* Y, const float* Z, const float* Intensity, int32 NumPoints,
+		double TimeStamp, const FString& FrameId) const;
+
 private:
 	FROS2PublisherBarrier(const FROS2PublisherBarrier&) = delete;
 	void operator=(const FROS2PublisherBarrier&) = delete;
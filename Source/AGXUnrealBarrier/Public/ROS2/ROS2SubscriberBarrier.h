@@ -31,11 +31,22 @@ public:
 
 	void ReleaseNative();
 
+	/**
+	 * Receive the oldest message waiting in the native queue.
+	 */
 	bool ReceiveMessage(FAGX_ROS2Message& OutMsg) const;
 
+	/**
+	 * Receive the newest message waiting in the native queue, discarding all older ones. Only the
+	 * newest message is converted.
+	 */
+	bool ReceiveLatestMessage(FAGX_ROS2Message& OutMsg) const;
+
 	EAGX_ROS2MessageType GetMessageType() const;
 
 private:
+	bool Receive(FAGX_ROS2Message& OutMsg, bool bLatestOnly) const;
+
 	FROS2SubscriberBarrier(const FROS2SubscriberBarrier&) = delete;
 	void operator=(const FROS2SubscriberBarrier&) = delete;
 
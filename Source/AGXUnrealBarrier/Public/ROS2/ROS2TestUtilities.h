@@ -0,0 +1,63 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "ROS2/AGX_ROS2Messages.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+/**
+ * Convenience class made for internal Unit Tests to reach the ROS2 message conversions, which are
+ * private to the AGXUnrealBarrier module.
+ *
+ * Each RoundTrip converts the message to its agxROS2 representation and back, without sending it,
+ * and reports the time spent in each direction [s].
+ */
+class AGXUNREALBARRIER_API FROS2TestUtilities
+{
+public:
+	static FAGX_AgxMsgsAny RoundTrip(
+		const FAGX_AgxMsgsAny& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_StdMsgsByteMultiArray RoundTrip(
+		const FAGX_StdMsgsByteMultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_StdMsgsFloat32MultiArray RoundTrip(
+		const FAGX_StdMsgsFloat32MultiArray& Msg, double& OutToNativeTime,
+		double& OutFromNativeTime);
+	static FAGX_StdMsgsFloat64MultiArray RoundTrip(
+		const FAGX_StdMsgsFloat64MultiArray& Msg, double& OutToNativeTime,
+		double& OutFromNativeTime);
+	static FAGX_StdMsgsInt8MultiArray RoundTrip(
+		const FAGX_StdMsgsInt8MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_StdMsgsInt16MultiArray RoundTrip(
+		const FAGX_StdMsgsInt16MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_StdMsgsInt32MultiArray RoundTrip(
+		const FAGX_StdMsgsInt32MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_StdMsgsInt64MultiArray RoundTrip(
+		const FAGX_StdMsgsInt64MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_StdMsgsUInt8MultiArray RoundTrip(
+		const FAGX_StdMsgsUInt8MultiArray& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_StdMsgsUInt16MultiArray RoundTrip(
+		const FAGX_StdMsgsUInt16MultiArray& Msg, double& OutToNativeTime,
+		double& OutFromNativeTime);
+	static FAGX_StdMsgsUInt32MultiArray RoundTrip(
+		const FAGX_StdMsgsUInt32MultiArray& Msg, double& OutToNativeTime,
+		double& OutFromNativeTime);
+	static FAGX_StdMsgsUInt64MultiArray RoundTrip(
+		const FAGX_StdMsgsUInt64MultiArray& Msg, double& OutToNativeTime,
+		double& OutFromNativeTime);
+	static FAGX_SensorMsgsCompressedImage RoundTrip(
+		const FAGX_SensorMsgsCompressedImage& Msg, double& OutToNativeTime,
+		double& OutFromNativeTime);
+	static FAGX_SensorMsgsImage RoundTrip(
+		const FAGX_SensorMsgsImage& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_SensorMsgsJointState RoundTrip(
+		const FAGX_SensorMsgsJointState& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_SensorMsgsJoy RoundTrip(
+		const FAGX_SensorMsgsJoy& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_SensorMsgsLaserScan RoundTrip(
+		const FAGX_SensorMsgsLaserScan& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+	static FAGX_SensorMsgsPointCloud2 RoundTrip(
+		const FAGX_SensorMsgsPointCloud2& Msg, double& OutToNativeTime, double& OutFromNativeTime);
+};
@@ -105,6 +105,22 @@ public:
 
 	bool HasNative() const;
 	void AllocateNative();
+
+	/**
+	 * Allocate a native that is a clone of the Prototype's native, including its geometries and
+	 * their shapes, materials and collision groups. Much cheaper than allocating a native and
+	 * configuring it, and its shapes, property by property when many identical Rigid Bodies are
+	 * created.
+	 *
+	 * @param Prototype The Rigid Body to clone.
+	 * @param PrototypeShapes Shapes of the Prototype whose counterparts in the clone are requested.
+	 * @param OutShapeAddresses The address of the cloned counterpart of each Prototype Shape, to be
+	 * passed to FShapeBarrier::SetNativeAddress. Zero for a Shape that isn't part of the Prototype.
+	 */
+	void AllocateNativeClone(
+		const FRigidBodyBarrier& Prototype, const TArray<const FShapeBarrier*>& PrototypeShapes,
+		TArray<uintptr_t>& OutShapeAddresses);
+
 	FRigidBodyRef* GetNative();
 	const FRigidBodyRef* GetNative() const;
 
@@ -89,6 +89,30 @@ public:
 		const TArray<FVector>& Vertices, const TArray<FTriIndices>& TriIndices, bool bClockwise,
 		const FString& SourceName);
 
+	/**
+	 * Allocate a native Trimesh that shares the collision mesh data of the given Trimesh instead
+	 * of creating its own. Cheaper than AllocateNative, both in time and memory, when many shapes
+	 * use the same triangle data.
+	 */
+	void AllocateNativeShared(const FTrimeshShapeBarrier& Source);
+
+	/**
+	 * Allocate a native Geometry holding one AGX Dynamics Convex shape per given hull instead of a
+	 * single Trimesh. Each hull must be convex, the first one becomes the barrier's main shape and
+	 * the rest are added to the same Geometry.
+	 *
+	 * The getters on this barrier only report the data of the first hull.
+	 */
+	void AllocateNativeConvexDecomposition(
+		const TArray<TArray<FVector>>& HullVertices,
+		const TArray<TArray<FTriIndices>>& HullIndices, bool bClockwise,
+		const FString& SourceName);
+
+	/**
+	 * @return The number of Convex shapes in the native Geometry, or 0 if the native is a Trimesh.
+	 */
+	int32 GetNumConvexHulls() const;
+
 private:
 	virtual void AllocateNativeShape() override;
 	virtual void ReleaseNativeShape() override;
@@ -102,6 +126,8 @@ private:
 		const TArray<FVector>* Vertices;
 		const TArray<FTriIndices>* TriIndices;
 		bool bClockwise;
+		bool bConvex {false};
+		const FTrimeshShapeBarrier* SharedSource {nullptr};
 		const FString& SourceName;
 
 		AllocationParameters(const FString& InSourceName)
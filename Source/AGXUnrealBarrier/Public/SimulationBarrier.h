@@ -10,6 +10,7 @@
 #include "Contacts/ShapeContactBarrier.h"
 
 // Unreal Engine includes.
+#include "Containers/Array.h"
 #include "Containers/UnrealString.h"
 
 // Standard library includes.
@@ -54,6 +55,19 @@ public:
 	bool Add(FTireBarrier& Tire);
 	bool Add(FWireBarrier& Wire);
 
+	/**
+	 * Add many Rigid Bodies and Shapes in a single pass, all Rigid Bodies before any Shape. AGX
+	 * Dynamics has no bulk insertion, so each object is still inserted individually, but without
+	 * a round trip through the Barrier per object.
+	 *
+	 * @param OutFailedBodies Indices into Bodies of the Rigid Bodies that could not be added.
+	 * @param OutFailedShapes Indices into Shapes of the Shapes that could not be added.
+	 * @return True if all Rigid Bodies and Shapes were added.
+	 */
+	bool Add(
+		const TArray<FRigidBodyBarrier*>& Bodies, const TArray<FShapeBarrier*>& Shapes,
+		TArray<int32>& OutFailedBodies, TArray<int32>& OutFailedShapes);
+
 	bool Remove(FConstraintBarrier& Constraint);
 	bool Remove(FContactMaterialBarrier& ContactMaterial);
 
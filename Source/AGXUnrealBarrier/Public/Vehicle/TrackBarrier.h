@@ -97,6 +97,9 @@ public:
 	/**
 	 * Get the transform of the center point of all track nodes. Scale is set to LocalScale and
 	 * location is offset by LocalOffset * Rotation. Used for track rendering while playing.
+	 *
+	 * The node poses are first read into structure-of-arrays buffers and then transformed in a
+	 * single pass, so prefer one call per track over per-node queries.
 	 */
 	void GetNodeTransforms(
 		TArray<FTransform>& OutTransforms, const FVector& LocalScale, const FVector& LocalOffset,
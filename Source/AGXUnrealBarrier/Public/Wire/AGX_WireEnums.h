@@ -104,3 +104,17 @@ enum class EWinchSide : uint8
 	Location,
 	Rotation
 };
+
+/**
+ * How a Wire Component renders itself.
+ */
+UENUM(BlueprintType)
+enum class EWireRenderMode : uint8
+{
+	// One cylinder and one sphere Instanced Static Mesh instance per wire segment.
+	InstancedMeshes,
+
+	// A single smooth tube through the wire nodes. Only the node positions are sent to the render
+	// thread, where the tube is generated with a resolution depending on the view distance.
+	Tube
+};
@@ -112,6 +112,24 @@ public:
 	FWireRenderIteratorBarrier GetRenderBeginIterator() const;
 	FWireRenderIteratorBarrier GetRenderEndIterator() const;
 
+	/**
+	 * Write the world location of every render node [cm] to OutLocations in a single pass over the
+	 * render list. If OutTypes and/or OutTensions are given, the node types and the wire tension at
+	 * each node [N] are written as well. Contact and Eye nodes get the tension of the lumped
+	 * segment they lie on.
+	 *
+	 * The arrays are reset but keep their allocations, so passing the same arrays every frame
+	 * avoids both per-node barrier objects and heap allocations.
+	 */
+	void GetRenderNodes(
+		TArray<FVector>& OutLocations, TArray<EWireNodeType>* OutTypes = nullptr,
+		TArray<double>* OutTensions = nullptr) const;
+
+	/**
+	 * @return The world space bounding box of the current render node locations [cm].
+	 */
+	FBox GetRenderNodeBounds() const;
+
 	bool IsLumpedNode(const FWireNodeBarrier& Node) const;
 	bool IsLumpedNode(const FWireRenderIteratorBarrier& Node) const;
 
@@ -0,0 +1,225 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "ROS2/AGX_ROS2Messages.h"
+#include "Sensors/AGX_LidarPointCloudFrame.h"
+#include "Utilities/AGX_ROS2Utilities.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+/**
+ * Test the pooling and compaction of Lidar point cloud frames, and their conversion to
+ * sensor_msgs::PointCloud2.
+ */
+BEGIN_DEFINE_SPEC(
+	FAGX_LidarPointCloudFrameSpec, "AGXUnreal.Spec.LidarPointCloudFrame",
+	AgxAutomationCommon::DefaultTestFlags)
+END_DEFINE_SPEC(FAGX_LidarPointCloudFrameSpec)
+
+namespace AGX_LidarPointCloudFrameSpec_helpers
+{
+	// Points I = 0..NumPoints-1 at (I, 10 I, 100 I) with intensity I / 10 and ray (I, 2 I).
+	void Fill(FAGX_LidarPointCloudFrame& Frame, int32 NumPoints)
+	{
+		const int32 First = Frame.AddUninitialized(NumPoints, /*bRayIndices*/ true);
+		for (int32 I = 0; I < NumPoints; ++I)
+		{
+			Frame.X[First + I] = static_cast<float>(I);
+			Frame.Y[First + I] = static_cast<float>(10 * I);
+			Frame.Z[First + I] = static_cast<float>(100 * I);
+			Frame.Intensity[First + I] = static_cast<float>(I) / 10.f;
+			Frame.TimeOffset[First + I] = static_cast<float>(I);
+			Frame.Ring[First + I] = static_cast<uint16>(I);
+			Frame.Column[First + I] = static_cast<uint16>(2 * I);
+		}
+	}
+}
+
+void FAGX_LidarPointCloudFrameSpec::Define()
+{
+	using namespace AGX_LidarPointCloudFrameSpec_helpers;
+
+	Describe(
+		"Acquiring frames from a pool",
+		[this]()
+		{
+			It("should reuse the memory of a released frame",
+			   [this]()
+			   {
+				   auto Pool = MakeShared<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe>(1);
+				   const FAGX_LidarPointCloudFrame* FirstAddress = nullptr;
+				   {
+					   auto Frame = Pool->Acquire();
+					   Frame->TimeStamp = 1.0;
+					   Fill(*Frame, 64);
+					   FirstAddress = &Frame.Get();
+					   TestEqual(TEXT("Free frames while in use"), Pool->GetNumFree(), 0);
+				   }
+				   TestEqual(TEXT("Free frames after release"), Pool->GetNumFree(), 1);
+
+				   auto Frame = Pool->Acquire();
+				   TestEqual(TEXT("Free frames after reacquire"), Pool->GetNumFree(), 0);
+				   TestTrue(TEXT("The frame should be reused."), &Frame.Get() == FirstAddress);
+				   TestEqual(TEXT("Reused frame size"), Frame->Num(), 0);
+				   TestEqual(TEXT("Reused frame time stamp"), Frame->TimeStamp, 0.0);
+				   TestEqual(TEXT("Ring indices"), Frame->Ring.Num(), 0);
+				   TestTrue(TEXT("The memory should be kept."), Frame->X.Max() >= 64);
+			   });
+
+			It("should free released frames when the pool is full",
+			   [this]()
+			   {
+				   auto Pool = MakeShared<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe>(1);
+				   {
+					   auto A = Pool->Acquire();
+					   auto B = Pool->Acquire();
+				   }
+				   TestEqual(TEXT("Free frames"), Pool->GetNumFree(), 1);
+			   });
+
+			It("should release frames that outlive the pool",
+			   [this]()
+			   {
+				   auto Pool = MakeShared<FAGX_LidarPointCloudFramePool, ESPMode::ThreadSafe>(1);
+				   auto Frame = Pool->Acquire();
+				   Fill(*Frame, 4);
+				   Pool.Reset();
+				   TestEqual(TEXT("Frame size"), Frame->Num(), 4);
+				   // Releasing the frame now deletes it instead of returning it to the pool.
+			   });
+		});
+
+	Describe(
+		"Compacting a frame",
+		[this]()
+		{
+			It("should keep the marked points in order",
+			   [this]()
+			   {
+				   FAGX_LidarPointCloudFrame Frame;
+				   Fill(Frame, 2);
+				   Fill(Frame, 5);
+				   const int32 Capacity = Frame.X.Max();
+
+				   // Keep points 0, 2 and 3 of the second Fill.
+				   const TArray<uint8> Keep {1, 0, 1, 1, 0};
+				   Frame.Compact(2, Keep);
+
+				   if (!TestEqual(TEXT("Number of points"), Frame.Num(), 5))
+					   return;
+				   TestTrue(TEXT("Ray indices"), Frame.HasRayIndices());
+				   TestEqual(TEXT("Capacity"), Frame.X.Max(), Capacity);
+
+				   const TArray<int32> Expected {0, 1, 0, 2, 3};
+				   for (int32 I = 0; I < Expected.Num(); ++I)
+				   {
+					   const int32 E = Expected[I];
+					   TestEqual(TEXT("X"), Frame.X[I], static_cast<float>(E));
+					   TestEqual(TEXT("Y"), Frame.Y[I], static_cast<float>(10 * E));
+					   TestEqual(TEXT("Z"), Frame.Z[I], static_cast<float>(100 * E));
+					   TestEqual(
+						   TEXT("Intensity"), Frame.Intensity[I], static_cast<float>(E) / 10.f);
+					   TestEqual(TEXT("Time offset"), Frame.TimeOffset[I], static_cast<float>(E));
+					   TestEqual(TEXT("Ring"), Frame.Ring[I], static_cast<uint16>(E));
+					   TestEqual(TEXT("Column"), Frame.Column[I], static_cast<uint16>(2 * E));
+				   }
+			   });
+
+			It("should remove all points when none are kept",
+			   [this]()
+			   {
+				   FAGX_LidarPointCloudFrame Frame;
+				   Fill(Frame, 3);
+				   Frame.Compact(0, TArray<uint8> {0, 0, 0});
+				   TestEqual(TEXT("Number of points"), Frame.Num(), 0);
+				   TestEqual(TEXT("Number of rings"), Frame.Ring.Num(), 0);
+			   });
+		});
+
+	Describe(
+		"Appending a frame",
+		[this]()
+		{
+			It("should add the points with time offsets relative to the frame time stamp",
+			   [this]()
+			   {
+				   FAGX_LidarPointCloudFrame Frame;
+				   Frame.TimeStamp = 1.0;
+				   Fill(Frame, 2);
+				   FAGX_LidarPointCloudFrame Other;
+				   Other.TimeStamp = 1.5;
+				   Fill(Other, 3);
+
+				   Frame.Append(Other);
+				   if (!TestEqual(TEXT("Number of points"), Frame.Num(), 5))
+					   return;
+				   TestEqual(TEXT("Time stamp"), Frame.TimeStamp, 1.0);
+				   TestTrue(TEXT("Ray indices"), Frame.HasRayIndices());
+				   TestEqual(TEXT("X"), Frame.X[4], 2.f);
+				   TestEqual(TEXT("Time offset"), Frame.TimeOffset[4], 2.5f);
+				   TestEqual(TEXT("Column"), Frame.Column[4], static_cast<uint16>(4));
+			   });
+
+			It("should drop the ray indices if the appended frame has none",
+			   [this]()
+			   {
+				   FAGX_LidarPointCloudFrame Frame;
+				   Fill(Frame, 2);
+				   FAGX_LidarPointCloudFrame Other;
+				   Other.Add(FVector(1.0, 2.0, 3.0), 0.5f, 0.f);
+
+				   Frame.Append(Other);
+				   TestEqual(TEXT("Number of points"), Frame.Num(), 3);
+				   TestEqual(TEXT("Number of rings"), Frame.Ring.Num(), 0);
+				   TestEqual(TEXT("Number of columns"), Frame.Column.Num(), 0);
+			   });
+
+			It("should take the time stamp of the appended frame when empty",
+			   [this]()
+			   {
+				   FAGX_LidarPointCloudFrame Frame;
+				   FAGX_LidarPointCloudFrame Other;
+				   Other.TimeStamp = 3.0;
+				   Fill(Other, 2);
+
+				   Frame.Append(Other);
+				   TestEqual(TEXT("Time stamp"), Frame.TimeStamp, 3.0);
+				   TestEqual(TEXT("Time offset"), Frame.TimeOffset[1], 1.f);
+				   TestTrue(TEXT("Ray indices"), Frame.HasRayIndices());
+			   });
+		});
+
+	Describe(
+		"Converting a frame to PointCloud2",
+		[this]()
+		{
+			It("should write native byte order floats in ROS coordinates",
+			   [this]()
+			   {
+				   FAGX_LidarPointCloudFrame Frame;
+				   Frame.TimeStamp = 2.5;
+				   Fill(Frame, 3);
+
+				   const FAGX_SensorMsgsPointCloud2 Msg =
+					   FAGX_ROS2Utilities::ConvertXYZ(Frame, /*ROSCoordinates*/ true, TEXT("lid"));
+				   TestEqual(TEXT("Big endian"), Msg.IsBigendian, !PLATFORM_LITTLE_ENDIAN);
+				   TestEqual(TEXT("Width"), static_cast<int64>(Msg.Width), int64(3));
+				   TestEqual(TEXT("Point step"), static_cast<int64>(Msg.PointStep), int64(16));
+				   if (!TestEqual(TEXT("Data size"), Msg.Data.Num(), 3 * 16))
+					   return;
+
+				   const float* Data = reinterpret_cast<const float*>(Msg.Data.GetData());
+				   for (int32 I = 0; I < 3; ++I)
+				   {
+					   // [cm] to [m], and Y flipped for right handed coordinates.
+					   TestEqual(TEXT("x"), Data[I * 4 + 0], static_cast<float>(I) / 100.f);
+					   TestEqual(TEXT("y"), Data[I * 4 + 1], -static_cast<float>(10 * I) / 100.f);
+					   TestEqual(TEXT("z"), Data[I * 4 + 2], static_cast<float>(100 * I) / 100.f);
+					   TestEqual(TEXT("intensity"), Data[I * 4 + 3], static_cast<float>(I) / 10.f);
+				   }
+			   });
+		});
+}
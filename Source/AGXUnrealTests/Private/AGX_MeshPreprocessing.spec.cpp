@@ -0,0 +1,295 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "Shapes/AGX_MeshPreprocessingSettings.h"
+#include "Utilities/AGX_MeshPreprocessing.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+	FAGX_MeshPreprocessingSpec, "AGXUnreal.Spec.MeshPreprocessing",
+	AgxAutomationCommon::DefaultTestFlags)
+
+/// Create a wavy grid of Size x Size quads, two triangles per quad, all facing +Z.
+void MakeGrid(int32 Size, TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices);
+
+/// Give every triangle its own three vertices, with a small offset on the first corner.
+void Explode(
+	const TArray<FVector>& Vertices, const TArray<FTriIndices>& Indices, double Offset,
+	TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices);
+
+/// Create a closed UV sphere with consistently oriented triangles.
+void MakeSphere(
+	int32 Rings, int32 Segments, TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices);
+
+bool AreIndicesValid(const TArray<FVector>& Vertices, const TArray<FTriIndices>& Indices);
+
+/// True if every edge is shared by exactly two triangles that traverse it in opposite directions.
+bool IsClosedManifold(const TArray<FTriIndices>& Indices);
+
+END_DEFINE_SPEC(FAGX_MeshPreprocessingSpec)
+
+void FAGX_MeshPreprocessingSpec::MakeGrid(
+	int32 Size, TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices)
+{
+	for (int32 Y = 0; Y <= Size; ++Y)
+	{
+		for (int32 X = 0; X <= Size; ++X)
+		{
+			OutVertices.Add(FVector(X, Y, 0.1 * FMath::Sin(X * 0.3)));
+		}
+	}
+
+	for (int32 Y = 0; Y < Size; ++Y)
+	{
+		for (int32 X = 0; X < Size; ++X)
+		{
+			const int32 A = Y * (Size + 1) + X;
+			const int32 B = A + 1;
+			const int32 C = A + Size + 1;
+			const int32 D = C + 1;
+			OutIndices.Add({A, B, D});
+			OutIndices.Add({A, D, C});
+		}
+	}
+}
+
+void FAGX_MeshPreprocessingSpec::Explode(
+	const TArray<FVector>& Vertices, const TArray<FTriIndices>& Indices, double Offset,
+	TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices)
+{
+	for (const FTriIndices& Triangle : Indices)
+	{
+		const int32 First = OutVertices.Add(Vertices[Triangle.v0] + FVector(Offset, 0.0, 0.0));
+		OutVertices.Add(Vertices[Triangle.v1]);
+		OutVertices.Add(Vertices[Triangle.v2]);
+		OutIndices.Add({First, First + 1, First + 2});
+	}
+}
+
+void FAGX_MeshPreprocessingSpec::MakeSphere(
+	int32 Rings, int32 Segments, TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices)
+{
+	OutVertices.Add(FVector(0.0, 0.0, 1.0));
+	for (int32 R = 1; R < Rings; ++R)
+	{
+		const double Theta = PI * R / Rings;
+		for (int32 S = 0; S < Segments; ++S)
+		{
+			const double Phi = 2.0 * PI * S / Segments;
+			OutVertices.Add(FVector(
+				FMath::Sin(Theta) * FMath::Cos(Phi), FMath::Sin(Theta) * FMath::Sin(Phi),
+				FMath::Cos(Theta)));
+		}
+	}
+	const int32 Bottom = OutVertices.Add(FVector(0.0, 0.0, -1.0));
+
+	auto RingVertex = [Segments](int32 R, int32 S)
+	{ return 1 + (R - 1) * Segments + S % Segments; };
+	for (int32 S = 0; S < Segments; ++S)
+	{
+		OutIndices.Add({0, RingVertex(1, S), RingVertex(1, S + 1)});
+		for (int32 R = 1; R < Rings - 1; ++R)
+		{
+			const int32 A = RingVertex(R, S);
+			const int32 B = RingVertex(R, S + 1);
+			const int32 C = RingVertex(R + 1, S);
+			const int32 D = RingVertex(R + 1, S + 1);
+			OutIndices.Add({A, C, D});
+			OutIndices.Add({A, D, B});
+		}
+		OutIndices.Add({Bottom, RingVertex(Rings - 1, S + 1), RingVertex(Rings - 1, S)});
+	}
+}
+
+bool FAGX_MeshPreprocessingSpec::AreIndicesValid(
+	const TArray<FVector>& Vertices, const TArray<FTriIndices>& Indices)
+{
+	for (const FTriIndices& Triangle : Indices)
+	{
+		if (!Vertices.IsValidIndex(Triangle.v0) || !Vertices.IsValidIndex(Triangle.v1) ||
+			!Vertices.IsValidIndex(Triangle.v2))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FAGX_MeshPreprocessingSpec::IsClosedManifold(const TArray<FTriIndices>& Indices)
+{
+	TMap<TPair<int32, int32>, int32> DirectedEdges;
+	for (const FTriIndices& Triangle : Indices)
+	{
+		const int32 Corners[] = {Triangle.v0, Triangle.v1, Triangle.v2};
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+			++DirectedEdges.FindOrAdd({Corners[Corner], Corners[(Corner + 1) % 3]});
+	}
+
+	for (const auto& Edge : DirectedEdges)
+	{
+		const int32* Reverse = DirectedEdges.Find({Edge.Key.Value, Edge.Key.Key});
+		if (Edge.Value != 1 || Reverse == nullptr || *Reverse != 1)
+			return false;
+	}
+	return true;
+}
+
+void FAGX_MeshPreprocessingSpec::Define()
+{
+	Describe(
+		"When welding vertices",
+		[this]()
+		{
+			It("should merge vertices within tolerance",
+			   [this]()
+			   {
+				   TArray<FVector> GridVertices;
+				   TArray<FTriIndices> GridIndices;
+				   MakeGrid(10, GridVertices, GridIndices);
+
+				   TArray<FVector> Vertices;
+				   TArray<FTriIndices> Indices;
+				   Explode(GridVertices, GridIndices, 1.0e-4, Vertices, Indices);
+
+				   AGX_MeshPreprocessing::WeldVertices(Vertices, Indices, 1.0e-3);
+				   TestEqual(TEXT("Num vertices"), Vertices.Num(), GridVertices.Num());
+				   TestEqual(TEXT("Num triangles"), Indices.Num(), GridIndices.Num());
+				   TestTrue(TEXT("Valid indices"), AreIndicesValid(Vertices, Indices));
+			   });
+
+			It("should not merge vertices outside tolerance",
+			   [this]()
+			   {
+				   TArray<FVector> GridVertices;
+				   TArray<FTriIndices> GridIndices;
+				   MakeGrid(4, GridVertices, GridIndices);
+
+				   TArray<FVector> Vertices;
+				   TArray<FTriIndices> Indices;
+				   Explode(GridVertices, GridIndices, 1.0e-2, Vertices, Indices);
+				   const TArray<FVector> Exploded = Vertices;
+				   const TArray<FTriIndices> ExplodedIndices = Indices;
+
+				   // Only vertices at exactly the same position are within tolerance.
+				   TSet<FVector> UniquePositions;
+				   UniquePositions.Append(Exploded);
+
+				   const int32 NumMerged =
+					   AGX_MeshPreprocessing::WeldVertices(Vertices, Indices, 1.0e-3);
+				   TestEqual(TEXT("Num vertices"), Vertices.Num(), UniquePositions.Num());
+				   TestEqual(
+					   TEXT("Num merged"), NumMerged, Exploded.Num() - UniquePositions.Num());
+				   TestTrue(TEXT("Valid indices"), AreIndicesValid(Vertices, Indices));
+
+				   // No vertex may have been moved, every corner keeps its original position.
+				   for (int32 I = 0; I < Indices.Num(); ++I)
+				   {
+					   TestEqual(
+						   TEXT("Corner 0"), Vertices[Indices[I].v0],
+						   Exploded[ExplodedIndices[I].v0]);
+					   TestEqual(
+						   TEXT("Corner 1"), Vertices[Indices[I].v1],
+						   Exploded[ExplodedIndices[I].v1]);
+					   TestEqual(
+						   TEXT("Corner 2"), Vertices[Indices[I].v2],
+						   Exploded[ExplodedIndices[I].v2]);
+				   }
+			   });
+
+			It("should handle a tolerance much smaller than the vertex coordinates",
+			   [this]()
+			   {
+				   TArray<FVector> Vertices {
+					   FVector(1.0e6, -1.0e6, 1.0e6), FVector(1.0e6, -1.0e6, 1.0e6),
+					   FVector(-1.0e6, 1.0e6, 0.0)};
+				   TArray<FTriIndices> Indices {{0, 1, 2}};
+
+				   const int32 NumMerged =
+					   AGX_MeshPreprocessing::WeldVertices(Vertices, Indices, 1.0e-300);
+				   TestEqual(TEXT("Num merged"), NumMerged, 1);
+				   TestEqual(TEXT("Num vertices"), Vertices.Num(), 2);
+				   TestTrue(TEXT("Valid indices"), AreIndicesValid(Vertices, Indices));
+			   });
+		});
+
+	Describe(
+		"When removing degenerate triangles",
+		[this]()
+		{
+			It("should remove triangles with repeated corners or zero area",
+			   [this]()
+			   {
+				   TArray<FVector> Vertices {
+					   FVector(0.0, 0.0, 0.0), FVector(1.0, 0.0, 0.0), FVector(0.0, 1.0, 0.0),
+					   FVector(2.0, 0.0, 0.0)};
+				   TArray<FTriIndices> Indices {{0, 1, 2}, {0, 1, 1}, {0, 1, 3}};
+
+				   const int32 NumRemoved =
+					   AGX_MeshPreprocessing::RemoveDegenerateTriangles(Vertices, Indices);
+				   TestEqual(TEXT("Num removed"), NumRemoved, 2);
+				   TestEqual(TEXT("Num triangles"), Indices.Num(), 1);
+			   });
+		});
+
+	Describe(
+		"When decimating",
+		[this]()
+		{
+			It("should reach the target without flipping triangles",
+			   [this]()
+			   {
+				   TArray<FVector> Vertices;
+				   TArray<FTriIndices> Indices;
+				   MakeGrid(30, Vertices, Indices);
+
+				   AGX_MeshPreprocessing::Decimate(Vertices, Indices, 200);
+				   TestTrue(TEXT("Reached target"), Indices.Num() <= 200);
+				   TestTrue(TEXT("Valid indices"), AreIndicesValid(Vertices, Indices));
+
+				   for (const FTriIndices& Triangle : Indices)
+				   {
+					   const FVector Normal = FVector::CrossProduct(
+						   Vertices[Triangle.v1] - Vertices[Triangle.v0],
+						   Vertices[Triangle.v2] - Vertices[Triangle.v0]);
+					   TestTrue(TEXT("Facing up"), Normal.Z > 0.0);
+				   }
+			   });
+
+			It("should keep a closed mesh closed and manifold",
+			   [this]()
+			   {
+				   TArray<FVector> Vertices;
+				   TArray<FTriIndices> Indices;
+				   MakeSphere(16, 24, Vertices, Indices);
+				   const int32 NumTriangles = Indices.Num();
+				   TestTrue(TEXT("Input closed"), IsClosedManifold(Indices));
+
+				   AGX_MeshPreprocessing::Decimate(Vertices, Indices, 40);
+				   TestTrue(TEXT("Decimated"), Indices.Num() < NumTriangles);
+				   TestTrue(TEXT("Valid indices"), AreIndicesValid(Vertices, Indices));
+				   TestTrue(TEXT("Output closed"), IsClosedManifold(Indices));
+
+				   // Euler characteristic of a sphere, V - E + F = 2 with E = 3F / 2.
+				   TestEqual(
+					   TEXT("Genus zero"), Vertices.Num() - Indices.Num() * 3 / 2 + Indices.Num(),
+					   2);
+			   });
+
+			It("should do nothing when already below the target",
+			   [this]()
+			   {
+				   TArray<FVector> Vertices;
+				   TArray<FTriIndices> Indices;
+				   MakeGrid(3, Vertices, Indices);
+
+				   TestEqual(
+					   TEXT("Num removed"), AGX_MeshPreprocessing::Decimate(Vertices, Indices, 100),
+					   0);
+				   TestEqual(TEXT("Num triangles"), Indices.Num(), 18);
+			   });
+		});
+}
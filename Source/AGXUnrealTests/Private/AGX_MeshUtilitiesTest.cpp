@@ -126,6 +126,41 @@ namespace
 
 		return MeshGenerationTest_Helper::IsMeshDataValid(Positions, Normals, Indices, TexCoords);
 	}
+
+	// The corners of a box, plus points inside and on the faces that are not hull vertices.
+	bool ConvexHullTriangulationTest(const FVector& HalfSize)
+	{
+		TArray<FVector> Vertices;
+		for (int32 I = 0; I < 8; ++I)
+		{
+			Vertices.Add(FVector(
+				(I & 1) ? HalfSize.X : -HalfSize.X, (I & 2) ? HalfSize.Y : -HalfSize.Y,
+				(I & 4) ? HalfSize.Z : -HalfSize.Z));
+		}
+		Vertices.Add(FVector::ZeroVector);
+		Vertices.Add(FVector(HalfSize.X, 0.0, 0.0));
+		Vertices.Add(HalfSize * 0.5);
+
+		TArray<FTriIndices> Indices;
+		if (!AGX_MeshUtilities::TriangulateConvexHull(Vertices, Indices))
+			return false;
+
+		if (Vertices.Num() != 8 || Indices.Num() != 12)
+			return false;
+
+		// Every triangle must face away from the center, using Unreal Engine's front face winding.
+		for (const FTriIndices& Triangle : Indices)
+		{
+			const FVector& A = Vertices[Triangle.v0];
+			const FVector& B = Vertices[Triangle.v1];
+			const FVector& C = Vertices[Triangle.v2];
+			const FVector Normal = FVector::CrossProduct(C - A, B - A);
+			if (FVector::DotProduct(Normal, (A + B + C) / 3.0) <= 0.0)
+				return false;
+		}
+
+		return true;
+	}
 }
 
 bool FAGX_MeshUtilitiesTest::RunTest(const FString&)
@@ -156,5 +191,11 @@ bool FAGX_MeshUtilitiesTest::RunTest(const FString&)
 	Result = ::CapsuleMeshGenerationTest(1.5f, 2.5f, 13, 11);
 	TestEqual("Capsule Mesh Generation Test 1.5f, 2.5f, 13, 11", Result, true);
 
+	// Convex hull triangulation tests.
+	Result = ::ConvexHullTriangulationTest({0.5, 0.5, 0.5});
+	TestEqual("Convex Hull Triangulation Test 0.5, 0.5, 0.5", Result, true);
+	Result = ::ConvexHullTriangulationTest({150.0, 20.0, 3.0});
+	TestEqual("Convex Hull Triangulation Test 150.0, 20.0, 3.0", Result, true);
+
 	return true;
 }
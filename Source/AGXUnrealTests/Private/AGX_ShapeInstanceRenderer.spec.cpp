@@ -0,0 +1,195 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "Shapes/AGX_BoxShapeComponent.h"
+#include "Shapes/AGX_ShapeInstanceRenderer.h"
+#include "Utilities/AGX_ObjectUtilities.h"
+
+// Unreal Engine includes.
+#include "Components/InstancedStaticMeshComponent.h"
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/AutomationTest.h"
+
+/**
+ * Test that the Shape Instance Renderer follows changes to the visibility, material and shadow
+ * casting of the Shapes it renders.
+ */
+BEGIN_DEFINE_SPEC(
+	FAGX_ShapeInstanceRendererSpec, "AGXUnreal.Spec.ShapeInstanceRenderer",
+	AgxAutomationCommon::DefaultTestFlags)
+
+UWorld* World {nullptr};
+AAGX_ShapeInstanceRenderer* Renderer {nullptr};
+UAGX_BoxShapeComponent* Box {nullptr};
+
+END_DEFINE_SPEC(FAGX_ShapeInstanceRendererSpec)
+
+namespace AGX_ShapeInstanceRendererSpec_helpers
+{
+	int32 GetInstanceCount(const UInstancedStaticMeshComponent* Instances)
+	{
+		return Instances != nullptr ? Instances->GetInstanceCount() : 0;
+	}
+}
+
+void FAGX_ShapeInstanceRendererSpec::Define()
+{
+	using namespace AGX_ShapeInstanceRendererSpec_helpers;
+
+	BeforeEach(
+		[this]()
+		{
+			// A temporary world so that we don't put stuff that shouldn't be there in the main
+			// world.
+			World = UWorld::CreateWorld(
+				EWorldType::Game, false, TEXT("Shape Instance Renderer Test World"),
+				GetTransientPackage());
+			Renderer = World->SpawnActor<AAGX_ShapeInstanceRenderer>();
+			AActor* Owner = World->SpawnActor<AActor>();
+			Box = NewObject<UAGX_BoxShapeComponent>(Owner);
+			Owner->SetRootComponent(Box);
+			Box->RegisterComponent();
+		});
+
+	AfterEach(
+		[this]()
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+			Renderer = nullptr;
+			Box = nullptr;
+		});
+
+	Describe(
+		"Adding and removing a Shape",
+		[this]()
+		{
+			It("should render the Shape as an instance until it is removed",
+			   [this]()
+			   {
+				   TestTrue(TEXT("The Box should be added."), Renderer->Add(*Box));
+				   TestTrue(TEXT("The Box should be instanced."), Box->IsVisualInstanced());
+				   UInstancedStaticMeshComponent* Instances = Renderer->GetInstances(*Box);
+				   TestNotNull(TEXT("The Box should be rendered."), Instances);
+				   TestEqual(TEXT("Instance count"), GetInstanceCount(Instances), 1);
+
+				   Renderer->Remove(*Box);
+				   TestFalse(TEXT("The Box should not be instanced."), Box->IsVisualInstanced());
+				   TestNull(TEXT("The Box should not be rendered."), Renderer->GetInstances(*Box));
+				   TestEqual(TEXT("Instance count"), GetInstanceCount(Instances), 0);
+			   });
+		});
+
+	Describe(
+		"Changing the visibility of a Shape",
+		[this]()
+		{
+			It("should remove and restore the instance when the visibility changes",
+			   [this]()
+			   {
+				   Renderer->Add(*Box);
+				   UInstancedStaticMeshComponent* Instances = Renderer->GetInstances(*Box);
+
+				   Box->SetVisibility(false);
+				   TestNull(
+					   TEXT("A hidden Box should not be rendered."), Renderer->GetInstances(*Box));
+				   TestEqual(TEXT("Instance count"), GetInstanceCount(Instances), 0);
+				   TestEqual(TEXT("Hidden Shapes are registered"), Renderer->GetNumInstances(), 1);
+
+				   Box->SetVisibility(true);
+				   TestEqual(
+					   TEXT("A visible Box should be rendered."), Renderer->GetInstances(*Box),
+					   Instances);
+				   TestEqual(TEXT("Instance count"), GetInstanceCount(Instances), 1);
+			   });
+
+			It("should remove and restore the instance when hidden in game changes",
+			   [this]()
+			   {
+				   Renderer->Add(*Box);
+				   UInstancedStaticMeshComponent* Instances = Renderer->GetInstances(*Box);
+
+				   Box->SetHiddenInGame(true);
+				   TestNull(
+					   TEXT("A hidden Box should not be rendered."), Renderer->GetInstances(*Box));
+				   TestEqual(TEXT("Instance count"), GetInstanceCount(Instances), 0);
+
+				   Box->SetHiddenInGame(false);
+				   TestEqual(
+					   TEXT("A visible Box should be rendered."), Renderer->GetInstances(*Box),
+					   Instances);
+				   TestEqual(TEXT("Instance count"), GetInstanceCount(Instances), 1);
+			   });
+
+			It("should not render a Shape that is hidden when added",
+			   [this]()
+			   {
+				   Box->SetVisibility(false);
+				   TestTrue(TEXT("The Box should be added."), Renderer->Add(*Box));
+				   TestNull(
+					   TEXT("A hidden Box should not be rendered."), Renderer->GetInstances(*Box));
+
+				   Box->SetVisibility(true);
+				   TestNotNull(
+					   TEXT("A visible Box should be rendered."), Renderer->GetInstances(*Box));
+			   });
+		});
+
+	Describe(
+		"Changing the material of a Shape",
+		[this]()
+		{
+			It("should move the instance to a batch with the new material",
+			   [this]()
+			   {
+				   UMaterialInterface* Material =
+					   FAGX_ObjectUtilities::GetAssetFromPath<UMaterialInterface>(
+						   TEXT("Material'/Engine/BasicShapes/BasicShapeMaterial."
+								"BasicShapeMaterial'"));
+				   if (!TestNotNull(TEXT("Engine material"), Material))
+					   return;
+
+				   Renderer->Add(*Box);
+				   UInstancedStaticMeshComponent* Before = Renderer->GetInstances(*Box);
+
+				   Box->SetMaterial(0, Material);
+				   UInstancedStaticMeshComponent* After = Renderer->GetInstances(*Box);
+				   if (!TestNotNull(TEXT("The Box should be rendered."), After))
+					   return;
+
+				   TestNotEqual(TEXT("The Box should change batch."), After, Before);
+				   TestEqual(TEXT("Batch material"), After->GetMaterial(0), Material);
+				   TestEqual(TEXT("Old instance count"), GetInstanceCount(Before), 0);
+				   TestEqual(TEXT("New instance count"), GetInstanceCount(After), 1);
+			   });
+		});
+
+	Describe(
+		"Changing the shadow casting of a Shape",
+		[this]()
+		{
+			It("should move the instance to a batch with the new shadow casting on Tick",
+			   [this]()
+			   {
+				   Renderer->Add(*Box);
+				   UInstancedStaticMeshComponent* Before = Renderer->GetInstances(*Box);
+
+				   Box->SetCastShadow(!Box->CastShadow);
+				   Renderer->Tick(0.0f);
+				   UInstancedStaticMeshComponent* After = Renderer->GetInstances(*Box);
+				   if (!TestNotNull(TEXT("The Box should be rendered."), After))
+					   return;
+
+				   TestNotEqual(TEXT("The Box should change batch."), After, Before);
+				   TestEqual(
+					   TEXT("Batch shadow casting"), static_cast<bool>(After->CastShadow),
+					   static_cast<bool>(Box->CastShadow));
+				   TestEqual(TEXT("Old instance count"), GetInstanceCount(Before), 0);
+				   TestEqual(TEXT("New instance count"), GetInstanceCount(After), 1);
+			   });
+		});
+}
@@ -2,6 +2,7 @@
 
 // AGX Dynamics for Unreal includes.
 #include "AgxAutomationCommon.h"
+#include "Wire/AGX_WireAdaptiveResolution.h"
 #include "Wire/AGX_WireComponent.h"
 
 // Unreal Engine includes.
@@ -10,6 +11,18 @@
 BEGIN_DEFINE_SPEC(FAGX_WireComponentSpec, "AGXUnreal.Spec.WireComponent", AgxAutomationCommon::DefaultTestFlags)
 END_DEFINE_SPEC(FAGX_WireComponentSpec)
 
+namespace AGX_WireComponentSpec_helpers
+{
+	// Three render nodes where the wire bends by the given angle at the middle node [deg].
+	TArray<FVector> MakeBentWire(double Angle)
+	{
+		const double Radians = FMath::DegreesToRadians(Angle);
+		return {
+			FVector(-100.0, 0.0, 0.0), FVector::ZeroVector,
+			100.0 * FVector(FMath::Cos(Radians), FMath::Sin(Radians), 0.0)};
+	}
+}
+
 void FAGX_WireComponentSpec::Define()
 {
 	Describe(
@@ -51,4 +64,208 @@ void FAGX_WireComponentSpec::Define()
 					Wire->MarkAsGarbage();
 				});
 		});
+
+	Describe(
+		"When capturing and restoring the Route Cache",
+		[this]()
+		{
+			It("should not use the Route Cache by default",
+				[this]()
+				{
+					UAGX_WireComponent* Wire = NewObject<UAGX_WireComponent>();
+					TestFalse("Use Route Cache.", Wire->bUseRouteCache);
+					TestTrue("Route Cache is empty.", Wire->RouteCache.IsEmpty());
+					TestFalse("Empty Route Cache is valid.", Wire->IsRouteCacheValid());
+
+					Wire->MarkAsGarbage();
+				});
+
+			It("should restore the captured node locations",
+				[this]()
+				{
+					UAGX_WireComponent* Wire = NewObject<UAGX_WireComponent>();
+					Wire->SetWorldLocationAndRotation(
+						FVector(100.0, 200.0, 300.0), FRotator(0.0, 90.0, 0.0));
+					const TArray<FVector> Locations {
+						FVector(100.0, 200.0, 300.0), FVector(150.0, 200.0, 280.0),
+						FVector(200.0, 210.0, 270.0), FVector(250.0, 200.0, 300.0)};
+					const TArray<EWireNodeType> Types {
+						EWireNodeType::Free, EWireNodeType::Free, EWireNodeType::Contact,
+						EWireNodeType::Free};
+
+					TestTrue("Captured.", Wire->CaptureRouteCacheFrom(Locations, Types));
+					TestTrue("Route Cache is valid.", Wire->IsRouteCacheValid());
+					if (!TestEqual("Number of spans.", Wire->RouteCache.GetNumSpans(), 1))
+						return;
+
+					// Begin Play restores the nodes by transforming the span back to world.
+					const TArrayView<const FVector> Span = Wire->RouteCache.GetSpan(0);
+					if (!TestEqual("Number of nodes.", Span.Num(), Locations.Num()))
+						return;
+
+					const FTransform& WireTransform = Wire->GetComponentTransform();
+					for (int32 I = 0; I < Span.Num(); ++I)
+					{
+						TestEqual(
+							"Restored location.", WireTransform.TransformPosition(Span[I]),
+							Locations[I], 1e-6);
+					}
+
+					Wire->MarkAsGarbage();
+				});
+
+			It("should be invalidated by a changed Route Node",
+				[this]()
+				{
+					UAGX_WireComponent* Wire = NewObject<UAGX_WireComponent>();
+					const TArray<FVector> Locations {FVector::ZeroVector, FVector(100.0, 0.0, 0.0)};
+					const TArray<EWireNodeType> Types {EWireNodeType::Free, EWireNodeType::Free};
+					TestTrue("Captured.", Wire->CaptureRouteCacheFrom(Locations, Types));
+					TestTrue("Route Cache is valid.", Wire->IsRouteCacheValid());
+
+					FWireRoutingNode& RouteNode = Wire->RouteNodes[1];
+					const FVector LocalLocation = RouteNode.Frame.LocalLocation;
+					RouteNode.Frame.LocalLocation += FVector(0.0, 0.0, 10.0);
+					TestFalse("Valid after moving a Free node.", Wire->IsRouteCacheValid());
+
+					RouteNode.Frame.LocalLocation = LocalLocation;
+					TestTrue("Valid after moving the node back.", Wire->IsRouteCacheValid());
+
+					Wire->AddNodeAtLocationAtIndex(FVector(50.0, 0.0, 0.0), 1);
+					TestFalse("Valid after adding a node.", Wire->IsRouteCacheValid());
+
+					Wire->MarkAsGarbage();
+				});
+
+			It("should be invalidated by a changed winch Pulled In Length",
+				[this]()
+				{
+					UAGX_WireComponent* Wire = NewObject<UAGX_WireComponent>();
+					Wire->BeginWinchType = EWireWinchOwnerType::Wire;
+					const TArray<FVector> Locations {FVector::ZeroVector, FVector(100.0, 0.0, 0.0)};
+					const TArray<EWireNodeType> Types {EWireNodeType::Free, EWireNodeType::Free};
+					TestTrue("Captured.", Wire->CaptureRouteCacheFrom(Locations, Types));
+					TestTrue("Route Cache is valid.", Wire->IsRouteCacheValid());
+
+					Wire->OwnedBeginWinch.PulledInLength += 100.0;
+					TestFalse("Valid after changing Pulled In Length.", Wire->IsRouteCacheValid());
+
+					Wire->MarkAsGarbage();
+				});
+		});
+
+	Describe(
+		"When computing the adaptive segment length",
+		[this]()
+		{
+			// Default settings: Finest 10 cm, Coarsest 200 cm, Full Refinement Angle 20 deg,
+			// Slack Tension 1 N.
+			const TArray<EWireNodeType> FreeTypes {
+				EWireNodeType::Free, EWireNodeType::Free, EWireNodeType::Free};
+			const TArray<double> Taut {100.0, 100.0, 100.0};
+			const TArray<double> Slack {0.0, 0.0, 0.0};
+
+			It("should use the coarsest segment length for a straight taut wire",
+				[this, FreeTypes, Taut]()
+				{
+					using namespace AGX_WireComponentSpec_helpers;
+					FAGX_WireAdaptiveResolution Resolution;
+					TestEqual(
+						"Segment length.",
+						Resolution.ComputeSegmentLength(MakeBentWire(0.0), FreeTypes, Taut, 5.0),
+						200.0);
+				});
+
+			It("should refine a bent wire by its bend angle",
+				[this, FreeTypes, Taut]()
+				{
+					using namespace AGX_WireComponentSpec_helpers;
+					FAGX_WireAdaptiveResolution Resolution;
+					Resolution.bAllowFinerThanMinSegmentLength = true;
+					TestEqual(
+						"Half refinement angle.",
+						Resolution.ComputeSegmentLength(MakeBentWire(10.0), FreeTypes, Taut, 50.0),
+						105.0, 1e-6);
+					TestEqual(
+						"Full refinement angle.",
+						Resolution.ComputeSegmentLength(MakeBentWire(90.0), FreeTypes, Taut, 50.0),
+						10.0);
+				});
+
+			It("should not refine below Min Segment Length unless allowed",
+				[this, FreeTypes, Taut]()
+				{
+					using namespace AGX_WireComponentSpec_helpers;
+					FAGX_WireAdaptiveResolution Resolution;
+					TestEqual(
+						"Bent wire.",
+						Resolution.ComputeSegmentLength(MakeBentWire(90.0), FreeTypes, Taut, 50.0),
+						50.0);
+
+					Resolution.bAllowFinerThanMinSegmentLength = true;
+					TestEqual(
+						"Bent wire, finer allowed.",
+						Resolution.ComputeSegmentLength(MakeBentWire(90.0), FreeTypes, Taut, 50.0),
+						10.0);
+				});
+
+			It("should use Min Segment Length for a slack wire",
+				[this, FreeTypes, Slack]()
+				{
+					using namespace AGX_WireComponentSpec_helpers;
+					FAGX_WireAdaptiveResolution Resolution;
+					TestEqual(
+						"Segment length.",
+						Resolution.ComputeSegmentLength(MakeBentWire(0.0), FreeTypes, Slack, 50.0),
+						50.0);
+				});
+
+			It("should use the finest segment length at contacts",
+				[this, Taut]()
+				{
+					using namespace AGX_WireComponentSpec_helpers;
+					FAGX_WireAdaptiveResolution Resolution;
+					const TArray<EWireNodeType> Types {
+						EWireNodeType::Free, EWireNodeType::ShapeContact, EWireNodeType::Free};
+					TestEqual(
+						"Contact.",
+						Resolution.ComputeSegmentLength(MakeBentWire(0.0), Types, Taut, 50.0),
+						50.0);
+
+					Resolution.bAllowFinerThanMinSegmentLength = true;
+					TestEqual(
+						"Contact, finer allowed.",
+						Resolution.ComputeSegmentLength(MakeBentWire(0.0), Types, Taut, 50.0),
+						10.0);
+				});
+
+			It("should refine at Eye nodes by their bend angle",
+				[this, Taut]()
+				{
+					using namespace AGX_WireComponentSpec_helpers;
+					FAGX_WireAdaptiveResolution Resolution;
+					Resolution.bAllowFinerThanMinSegmentLength = true;
+					const TArray<EWireNodeType> Types {
+						EWireNodeType::Free, EWireNodeType::Eye, EWireNodeType::Free};
+					TestEqual(
+						"Straight through the Eye.",
+						Resolution.ComputeSegmentLength(MakeBentWire(0.0), Types, Taut, 50.0),
+						200.0);
+					TestEqual(
+						"Bent at the Eye.",
+						Resolution.ComputeSegmentLength(MakeBentWire(90.0), Types, Taut, 50.0),
+						10.0);
+				});
+
+			It("should only change the segment length beyond the hysteresis",
+				[this]()
+				{
+					// Default Hysteresis is 0.25.
+					FAGX_WireAdaptiveResolution Resolution;
+					TestFalse("Within hysteresis.", Resolution.ShouldChange(100.0, 120.0));
+					TestFalse("Within hysteresis.", Resolution.ShouldChange(100.0, 80.0));
+					TestTrue("Coarser beyond hysteresis.", Resolution.ShouldChange(100.0, 130.0));
+					TestTrue("Finer beyond hysteresis.", Resolution.ShouldChange(100.0, 70.0));
+				});
+		});
 }
@@ -0,0 +1,275 @@
+// Copyright 2025, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "ROS2/AGX_ROS2Messages.h"
+#include "ROS2/ROS2TestUtilities.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+// Standard library includes.
+#include <limits>
+
+/**
+ * Micro-benchmark and round-trip tests for the conversion between Unreal and agxROS2 messages.
+ *
+ * The conversions are run directly through FROS2TestUtilities, so the timings contain only the
+ * conversion and not any DDS write or take. The timings are reported as info messages. Every
+ * message is also checked to be unchanged by a conversion to agxROS2 and back, including the
+ * integer types that Blueprint-facing messages store in wider or signed integers.
+ */
+BEGIN_DEFINE_SPEC(
+	FROS2ConversionBenchmarkSpec, "AGXUnreal.Barrier.ROS2.ConversionBenchmark",
+	AgxAutomationCommon::DefaultTestFlags)
+
+static constexpr int32 NumIterations = 20;
+
+/// Convert the message to agxROS2 and back once and check that the result equals the message.
+template <typename MessageType>
+void TestRoundTrip(const MessageType& Message);
+
+/// Convert the message to agxROS2 and back NumIterations times and report the average times.
+template <typename MessageType>
+void Benchmark(const FString& Name, const MessageType& Message);
+
+END_DEFINE_SPEC(FROS2ConversionBenchmarkSpec)
+
+namespace ROS2ConversionBenchmarkSpec_helpers
+{
+	template <typename MessageType>
+	bool AreEqual(const MessageType& A, const MessageType& B)
+	{
+		// Compares every property, recursing into nested structs and arrays.
+		return MessageType::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+	}
+
+	template <typename ElementType>
+	void SetLayout(FAGX_StdMsgsMultiArrayLayout& Layout, const TArray<ElementType>& Data)
+	{
+		FAGX_StdMsgsMultiArrayDimension& Dim = Layout.Dim.AddDefaulted_GetRef();
+		Dim.Label = TEXT("x");
+		Dim.Size = Data.Num();
+		Dim.Stride = Data.Num();
+	}
+
+	template <typename MessageType, typename ElementType>
+	MessageType MakeMultiArray(std::initializer_list<ElementType> Values)
+	{
+		MessageType Message;
+		Message.Data = Values;
+		SetLayout(Message.Layout, Message.Data);
+		return Message;
+	}
+}
+
+template <typename MessageType>
+void FROS2ConversionBenchmarkSpec::TestRoundTrip(const MessageType& Message)
+{
+	using namespace ROS2ConversionBenchmarkSpec_helpers;
+
+	double ToNativeTime;
+	double FromNativeTime;
+	const MessageType Result = FROS2TestUtilities::RoundTrip(Message, ToNativeTime, FromNativeTime);
+	TestTrue(
+		FString::Printf(
+			TEXT("%s should be unchanged by a round trip."),
+			*MessageType::StaticStruct()->GetName()),
+		AreEqual(Message, Result));
+}
+
+template <typename MessageType>
+void FROS2ConversionBenchmarkSpec::Benchmark(const FString& Name, const MessageType& Message)
+{
+	using namespace ROS2ConversionBenchmarkSpec_helpers;
+
+	double ToNativeTotal = 0.0;
+	double FromNativeTotal = 0.0;
+	MessageType Result;
+	for (int32 I = 0; I < NumIterations; ++I)
+	{
+		double ToNativeTime;
+		double FromNativeTime;
+		Result = FROS2TestUtilities::RoundTrip(Message, ToNativeTime, FromNativeTime);
+		ToNativeTotal += ToNativeTime;
+		FromNativeTotal += FromNativeTime;
+	}
+
+	TestTrue(TEXT("The message should be unchanged by a round trip."), AreEqual(Message, Result));
+	AddInfo(FString::Printf(
+		TEXT("%s: to agxROS2 %.3f ms, from agxROS2 %.3f ms."), *Name,
+		1000.0 * ToNativeTotal / NumIterations, 1000.0 * FromNativeTotal / NumIterations));
+}
+
+void FROS2ConversionBenchmarkSpec::Define()
+{
+	using namespace ROS2ConversionBenchmarkSpec_helpers;
+
+	Describe(
+		"Converting large messages",
+		[this]()
+		{
+			It("should convert a 1080p RGB8 image",
+			   [this]()
+			   {
+				   FAGX_SensorMsgsImage Image;
+				   Image.Width = 1920;
+				   Image.Height = 1080;
+				   Image.Encoding = TEXT("rgb8");
+				   Image.Step = Image.Width * 3;
+				   Image.Data.SetNumUninitialized(static_cast<int32>(Image.Step * Image.Height));
+				   for (int32 I = 0; I < Image.Data.Num(); ++I)
+					   Image.Data[I] = static_cast<uint8>(I);
+
+				   Benchmark(TEXT("1080p RGB8 image"), Image);
+			   });
+
+			It("should convert a float array with 1M elements",
+			   [this]()
+			   {
+				   FAGX_StdMsgsFloat32MultiArray Array;
+				   Array.Data.SetNumUninitialized(1 << 20);
+				   for (int32 I = 0; I < Array.Data.Num(); ++I)
+					   Array.Data[I] = static_cast<float>(I);
+				   SetLayout(Array.Layout, Array.Data);
+
+				   Benchmark(TEXT("1M element float array"), Array);
+			   });
+		});
+
+	Describe(
+		"Round trip of multi-arrays",
+		[this]()
+		{
+			It("should preserve byte arrays",
+			   [this]()
+			   {
+				   TestRoundTrip(
+					   MakeMultiArray<FAGX_StdMsgsByteMultiArray, uint8>({0, 1, 127, 128, 255}));
+			   });
+
+			It("should preserve float arrays",
+			   [this]()
+			   {
+				   constexpr float Min = std::numeric_limits<float>::denorm_min();
+				   constexpr float Max = std::numeric_limits<float>::max();
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsFloat32MultiArray, float>(
+					   {-Max, -1.5f, 0.f, Min, 1.5f, Max}));
+
+				   constexpr double MinD = std::numeric_limits<double>::denorm_min();
+				   constexpr double MaxD = std::numeric_limits<double>::max();
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsFloat64MultiArray, double>(
+					   {-MaxD, -1.5, 0.0, MinD, 1.5, MaxD}));
+			   });
+
+			It("should preserve signed integer arrays",
+			   [this]()
+			   {
+				   // Int8 and Int16 are stored as int32 in the Unreal messages.
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsInt8MultiArray, int32>(
+					   {MIN_int8, -1, 0, 1, MAX_int8}));
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsInt16MultiArray, int32>(
+					   {MIN_int16, -1, 0, 1, MAX_int16}));
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsInt32MultiArray, int32>(
+					   {MIN_int32, -1, 0, 1, MAX_int32}));
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsInt64MultiArray, int64>(
+					   {MIN_int64, -1, 0, 1, MAX_int64}));
+			   });
+
+			It("should preserve unsigned integer arrays",
+			   [this]()
+			   {
+				   // UInt16 and UInt32 are stored in wider signed integers in the Unreal
+				   // messages, so their whole range must survive the round trip.
+				   TestRoundTrip(
+					   MakeMultiArray<FAGX_StdMsgsUInt8MultiArray, uint8>({0, 1, 127, 128, 255}));
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsUInt16MultiArray, int32>(
+					   {0, 1, MAX_int16, MAX_int16 + 1, MAX_uint16}));
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsUInt32MultiArray, int64>(
+					   {0, 1, MAX_int32, int64(MAX_int32) + 1, MAX_uint32}));
+			   });
+
+			It("should reinterpret uint64 arrays stored as int64",
+			   [this]()
+			   {
+				   // Values above MAX_int64 are stored as negative int64 in the Unreal message. The
+				   // bit pattern must survive the round trip through the native uint64 array.
+				   TestRoundTrip(MakeMultiArray<FAGX_StdMsgsUInt64MultiArray, int64>(
+					   {0, 1, MAX_int64, MIN_int64, -1}));
+			   });
+		});
+
+	Describe(
+		"Round trip of messages with arrays",
+		[this]()
+		{
+			It("should preserve agx_msgs::Any",
+			   [this]()
+			   {
+				   FAGX_AgxMsgsAny Any;
+				   Any.Data = {0, 1, 127, 128, 255};
+				   TestRoundTrip(Any);
+			   });
+
+			It("should preserve images",
+			   [this]()
+			   {
+				   FAGX_SensorMsgsImage Image;
+				   Image.Header.FrameId = TEXT("camera");
+				   Image.Width = 2;
+				   Image.Height = 2;
+				   Image.Encoding = TEXT("mono8");
+				   Image.Step = 2;
+				   Image.Data = {0, 127, 128, 255};
+				   TestRoundTrip(Image);
+
+				   FAGX_SensorMsgsCompressedImage Compressed;
+				   Compressed.Format = TEXT("png");
+				   Compressed.Data = {0, 127, 128, 255};
+				   TestRoundTrip(Compressed);
+			   });
+
+			It("should preserve point clouds",
+			   [this]()
+			   {
+				   FAGX_SensorMsgsPointCloud2 Cloud;
+				   Cloud.Width = 2;
+				   Cloud.Height = 1;
+				   FAGX_SensorMsgsPointField& Field = Cloud.Fields.AddDefaulted_GetRef();
+				   Field.Name = TEXT("x");
+				   Field.Offset = 0;
+				   Field.Datatype = 7; // FLOAT32.
+				   Field.Count = 1;
+				   Cloud.PointStep = 4;
+				   Cloud.RowStep = 8;
+				   Cloud.Data = {0, 0, 128, 63, 0, 0, 0, 64};
+				   Cloud.IsDense = true;
+				   TestRoundTrip(Cloud);
+			   });
+
+			It("should preserve joint states, joys and laser scans",
+			   [this]()
+			   {
+				   FAGX_SensorMsgsJointState JointState;
+				   JointState.Name = {TEXT("a"), TEXT("b")};
+				   JointState.Position = {-1.0, 1.0};
+				   JointState.Velocity = {0.5, -0.5};
+				   JointState.Effort = {10.0, -10.0};
+				   TestRoundTrip(JointState);
+
+				   FAGX_SensorMsgsJoy Joy;
+				   Joy.Axes = {-1.f, 0.f, 1.f};
+				   Joy.Buttons = {MIN_int32, 0, 1, MAX_int32};
+				   TestRoundTrip(Joy);
+
+				   FAGX_SensorMsgsLaserScan Scan;
+				   Scan.AngleMin = -1.f;
+				   Scan.AngleMax = 1.f;
+				   Scan.RangeMax = 100.f;
+				   Scan.Ranges = {0.5f, 1.f, 99.f};
+				   Scan.Intensities = {0.f, 0.25f, 1.f};
+				   TestRoundTrip(Scan);
+			   });
+		});
+}